@@ -15,7 +15,8 @@
 # ******************************************************************************
 """Provide a layer of abstraction for the ngraph++ runtime environment."""
 import logging
-from typing import List, Union
+import threading
+from typing import List, Sequence, Union
 
 import numpy as np
 
@@ -69,6 +70,10 @@ class Computation(object):
         self.parameters = ng_function.get_parameters()
         self.results = ng_function.get_results()
         self.handle = self.runtime.backend.compile(self.function)
+        # Wrap NumPy arrays in tensors instead of copying them, disable to always copy
+        self.zero_copy = True
+        # Guards the preallocated tensors used when copying, calls may come from several threads
+        self._copy_lock = threading.Lock()
 
         self.tensor_views = []  # type: List[Tensor]
         for parameter in self.parameters:
@@ -87,22 +92,89 @@ class Computation(object):
         return '<Computation: {}({})>'.format(self.function.get_name(), params_string)
 
     def __call__(self, *input_values):  # type: (*NumericData) -> List[NumericData]
-        """Run computation on input values and return result."""
+        """Run computation on input values and return result.
+
+        Inputs that are C-contiguous, suitably aligned ndarrays of the parameter's type and shape
+        are used by the backend in place, other inputs are first copied into new aligned arrays.
+        Results are computed directly into new ndarrays. The GIL is released while the backend
+        computes, so a Computation may be called from several threads at once.
+        """
+        if not self.zero_copy:
+            return self._call_with_copies(input_values)
+
+        input_views = []  # type: List[Tensor]
         for tensor_view, value in zip(self.tensor_views, input_values):
             if not isinstance(value, np.ndarray):
                 value = np.array(value)
-            Computation._write_ndarray_to_tensor_view(value, tensor_view)
-
-        self.handle.call(self.result_views, self.tensor_views)
+            if not self._can_wrap(value, tensor_view):
+                value = Computation._aligned_copy(value, tensor_view)
+            input_views.append(self.runtime.backend.create_tensor(
+                tensor_view.element_type, tensor_view.shape, value))
 
         results = []
+        result_views = []  # type: List[Tensor]
         for result_view in self.result_views:
-            result = np.ndarray(result_view.shape, dtype=get_dtype(result_view.element_type))
-            Computation._read_tensor_view_to_ndarray(result_view, result)
+            result = Computation._aligned_ndarray(result_view.shape,
+                                                  get_dtype(result_view.element_type))
+            result_views.append(self.runtime.backend.create_tensor(
+                result_view.element_type, result_view.shape, result))
             results.append(result)
 
+        self.handle.call(result_views, input_views)
+        return results
+
+    def _call_with_copies(self, input_values):  # type: (Sequence[NumericData]) -> List[NumericData]
+        """Run computation on the preallocated tensors, copying inputs and results."""
+        with self._copy_lock:
+            for tensor_view, value in zip(self.tensor_views, input_values):
+                if not isinstance(value, np.ndarray):
+                    value = np.array(value)
+                Computation._write_ndarray_to_tensor_view(value, tensor_view)
+
+            self.handle.call(self.result_views, self.tensor_views)
+
+            results = []
+            for result_view in self.result_views:
+                result = np.ndarray(result_view.shape, dtype=get_dtype(result_view.element_type))
+                Computation._read_tensor_view_to_ndarray(result_view, result)
+                results.append(result)
+
         return results
 
+    @staticmethod
+    def _can_wrap(value, tensor_view):  # type: (np.ndarray, Tensor) -> bool
+        """Return True if the backend can use the memory of value as tensor_view's data."""
+        return (value.flags['C_CONTIGUOUS'] and
+                value.dtype == get_dtype(tensor_view.element_type) and
+                list(value.shape) == list(tensor_view.shape) and
+                value.ctypes.data % Backend.tensor_alignment == 0)
+
+    @staticmethod
+    def _aligned_ndarray(shape, dtype):  # type: (List[int], np.dtype) -> np.ndarray
+        """Return an uninitialized ndarray whose data the backend can use in place."""
+        shape = list(shape)
+        size = int(np.prod(shape)) * dtype.itemsize
+        alignment = Backend.tensor_alignment
+        buffer = np.empty(size + alignment, dtype=np.uint8)
+        offset = -buffer.ctypes.data % alignment
+        return buffer[offset:offset + size].view(dtype).reshape(shape)
+
+    @staticmethod
+    def _aligned_copy(value, tensor_view):  # type: (np.ndarray, Tensor) -> np.ndarray
+        """Return a copy of value the backend can use in place as tensor_view's data."""
+        tensor_view_dtype = get_dtype(tensor_view.element_type)
+        if list(tensor_view.shape) != list(value.shape) and len(value.shape) > 0:
+            raise UserInputError("Provided tensor's shape: %s does not match the expected: %s.",
+                                 list(value.shape), list(tensor_view.shape))
+        if value.dtype != tensor_view_dtype:
+            log.warning(
+                'Attempting to write a %s value to a %s tensor. Will attempt type conversion.',
+                value.dtype,
+                tensor_view.element_type)
+        result = Computation._aligned_ndarray(tensor_view.shape, tensor_view_dtype)
+        result[...] = value
+        return result
+
     def serialize(self, indent=0):  # type: (int) -> str
         """Serialize function (compute graph) to a JSON string.
 
@@ -17,6 +17,9 @@
 #include <pybind11/pybind11.h>
 #include <pybind11/stl.h>
 
+#include <cstdint>
+#include <string>
+
 #include "ngraph/runtime/backend.hpp"
 #include "ngraph/runtime/tensor.hpp"
 #include "pyngraph/runtime/backend.hpp"
@@ -30,6 +33,38 @@ static std::shared_ptr<ngraph::runtime::Executable> compile(ngraph::runtime::Bac
     return self->compile(func, enable_performance_data);
 }
 
+// Alignment of the buffers the CPU backend allocates, wrapped buffers must have at least this
+static constexpr size_t tensor_alignment = 64;
+
+static std::shared_ptr<ngraph::runtime::Tensor>
+    create_tensor_from_buffer(ngraph::runtime::Backend* self,
+                              const ngraph::element::Type& element_type,
+                              const ngraph::Shape& shape,
+                              py::buffer buffer)
+{
+    py::buffer_info info = buffer.request();
+    size_t byte_size = ngraph::shape_size(shape) * element_type.size();
+    if (static_cast<size_t>(info.size * info.itemsize) != byte_size)
+    {
+        throw py::value_error("Buffer size does not match the tensor shape and element type");
+    }
+    auto stride = info.itemsize;
+    for (size_t i = static_cast<size_t>(info.ndim); i > 0; --i)
+    {
+        if (info.shape[i - 1] > 1 && info.strides[i - 1] != stride)
+        {
+            throw py::value_error("Buffer is not C-contiguous");
+        }
+        stride *= info.shape[i - 1];
+    }
+    if (reinterpret_cast<uintptr_t>(info.ptr) % tensor_alignment != 0)
+    {
+        throw py::value_error("Buffer is not aligned to " + std::to_string(tensor_alignment) +
+                              " bytes");
+    }
+    return self->create_tensor(element_type, shape, info.ptr);
+}
+
 static std::shared_ptr<ngraph::runtime::Backend> create(const std::string& type)
 {
     bool must_support_dynamic = false;
@@ -47,5 +82,8 @@ void regclass_pyngraph_runtime_Backend(py::module m)
                 (std::shared_ptr<ngraph::runtime::Tensor>(ngraph::runtime::Backend::*)(
                     const ngraph::element::Type&, const ngraph::Shape&)) &
                     ngraph::runtime::Backend::create_tensor);
+    // The tensor uses the memory of the buffer, which is kept alive as long as the tensor
+    backend.def("create_tensor", &create_tensor_from_buffer, py::keep_alive<0, 4>());
+    backend.attr("tensor_alignment") = tensor_alignment;
     backend.def("compile", &compile);
 }
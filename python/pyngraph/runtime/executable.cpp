@@ -32,7 +32,9 @@ void regclass_pyngraph_runtime_Executable(py::module m)
                    (bool (ngraph::runtime::Executable::*)(
                        const std::vector<std::shared_ptr<ngraph::runtime::Tensor>>&,
                        const std::vector<std::shared_ptr<ngraph::runtime::Tensor>>&)) &
-                       ngraph::runtime::Executable::call);
+                       ngraph::runtime::Executable::call,
+                   // Other Python threads run while the backend computes
+                   py::call_guard<py::gil_scoped_release>());
     executable.def(
         "get_performance_data",
         (std::vector<ngraph::runtime::PerformanceCounter>(ngraph::runtime::Executable::*)()) &
@@ -38,8 +38,8 @@ void regclass_pyngraph_runtime_Tensor(py::module m)
     py::class_<ngraph::runtime::Tensor, std::shared_ptr<ngraph::runtime::Tensor>> tensor(m,
                                                                                          "Tensor");
     tensor.doc() = "ngraph.impl.runtime.Tensor wraps ngraph::runtime::Tensor";
-    tensor.def("write", &write_);
-    tensor.def("read", &read_);
+    tensor.def("write", &write_, py::call_guard<py::gil_scoped_release>());
+    tensor.def("read", &read_, py::call_guard<py::gil_scoped_release>());
 
     tensor.def_property_readonly("shape", &ngraph::runtime::Tensor::get_shape);
     tensor.def_property_readonly("element_count", &ngraph::runtime::Tensor::get_element_count);
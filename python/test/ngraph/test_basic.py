@@ -16,9 +16,11 @@
 import numpy as np
 import pytest
 import json
+import threading
 
 import ngraph as ng
 from ngraph.exceptions import UserInputError
+from ngraph.impl.runtime import Backend
 
 import test
 from test.ngraph.util import get_runtime, run_op_node
@@ -51,6 +53,62 @@ def test_simple_computation_on_ndarrays(dtype):
     assert np.allclose(result, np.array([[630, 704], [782, 864]], dtype=dtype))
 
 
+@pytest.mark.skip_on_gpu
+def test_computation_without_copies():
+    runtime = get_runtime()
+
+    shape = [4, 4]
+    parameter_a = ng.parameter(shape, dtype=np.float32, name='A')
+    parameter_b = ng.parameter(shape, dtype=np.float32, name='B')
+    computation = runtime.computation(parameter_a * parameter_b, parameter_a, parameter_b)
+
+    value_a = computation._aligned_ndarray(shape, np.dtype(np.float32))
+    value_a[:] = np.arange(16, dtype=np.float32).reshape(shape)
+    # A Fortran-ordered input is not contiguous in C order and is copied instead
+    value_b = np.asfortranarray(np.full(shape, 2, dtype=np.float32))
+    first_result = computation(value_a, value_b)[0]
+    assert first_result.ctypes.data % Backend.tensor_alignment == 0
+    assert np.allclose(first_result, value_a * 2)
+
+    # Every call returns new arrays
+    value_a[:] = 1
+    second_result = computation(value_a, value_b)[0]
+    assert np.allclose(second_result, np.full(shape, 2))
+    assert np.allclose(first_result, np.arange(16).reshape(shape) * 2)
+
+    computation.zero_copy = False
+    assert np.allclose(computation(value_a, value_b)[0], np.full(shape, 2))
+
+
+
+@pytest.mark.skip_on_gpu
+@pytest.mark.parametrize('zero_copy', [True, False])
+def test_computation_from_threads(zero_copy):
+    runtime = get_runtime()
+
+    shape = [64, 64]
+    parameter_a = ng.parameter(shape, dtype=np.float32, name='A')
+    parameter_b = ng.parameter(shape, dtype=np.float32, name='B')
+    computation = runtime.computation(parameter_a * parameter_b, parameter_a, parameter_b)
+    computation.zero_copy = zero_copy
+
+    # Fortran-ordered inputs cannot be wrapped, so each call has to copy them
+    value_b = np.asfortranarray(np.full(shape, 2, dtype=np.float32))
+    errors = []
+
+    def run(value):
+        value_a = np.asfortranarray(np.full(shape, value, dtype=np.float32))
+        for _ in range(50):
+            if not np.allclose(computation(value_a, value_b)[0], value * 2):
+                errors.append(value)
+
+    threads = [threading.Thread(target=run, args=(value,)) for value in range(4)]
+    for thread in threads:
+        thread.start()
+    for thread in threads:
+        thread.join()
+    assert not errors
+
 def test_serialization():
     dtype = np.float32
     backend_name = test.BACKEND_NAME
@@ -14,6 +14,8 @@
 // limitations under the License.
 //*****************************************************************************
 
+#include <algorithm>
+
 #include "ngraph/descriptor/input.hpp"
 #include "ngraph/descriptor/output.hpp"
 #include "ngraph/node.hpp"
@@ -42,6 +44,22 @@ descriptor::Input::Input(Node* node, size_t index)
 {
 }
 
+descriptor::Input::Input(Input&& input) noexcept
+    : m_src_node(std::move(input.m_src_node))
+    , m_node(input.m_node)
+    , m_index(input.m_index)
+    , m_output(input.m_output)
+    , m_is_relevant_to_shape(input.m_is_relevant_to_shape)
+    , m_is_relevant_to_value(input.m_is_relevant_to_value)
+{
+    if (m_output != nullptr)
+    {
+        // Take the place of input in the output's users so their order is unchanged
+        std::replace(m_output->m_inputs.begin(), m_output->m_inputs.end(), &input, this);
+        input.m_output = nullptr;
+    }
+}
+
 descriptor::Input::~Input()
 {
     remove_output();
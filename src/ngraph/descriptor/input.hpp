@@ -32,6 +32,7 @@ namespace ngraph
         class NGRAPH_API Input
         {
             friend class ngraph::Node;
+            friend class Output;
 
         public:
             /// \param node The node that owns this input
@@ -100,7 +101,9 @@ namespace ngraph
             const element::Type& get_element_type() const;
 
             Input(const Input&) = default;
-            Input(Input&&) = default;
+            /// \brief Takes over the connection of input, so the inputs of a node can be kept
+            ///        in a vector
+            Input(Input&& input) noexcept;
             Input& operator=(const Input&) = default;
 
         protected:
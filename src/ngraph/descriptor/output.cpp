@@ -30,6 +30,19 @@ descriptor::Output::Output(Node* node, size_t index, const shared_ptr<Tensor>& t
 {
 }
 
+descriptor::Output::Output(Output&& output) noexcept
+    : m_node(output.m_node)
+    , m_index(output.m_index)
+    , m_tensor(std::move(output.m_tensor))
+    , m_inputs(std::move(output.m_inputs))
+{
+    for (Input* input : m_inputs)
+    {
+        input->m_output = this;
+    }
+    output.m_inputs.clear();
+}
+
 // Add an input to the vector of inputs that use this output.
 void descriptor::Output::add_input(Input* input)
 {
@@ -24,7 +24,7 @@
 
 namespace ngraph
 {
-    // The forward declaration of Node is needed here because Node has a deque of
+    // The forward declaration of Node is needed here because Node has a vector of
     // Outputs, and Output is an incomplete type at this point. STL containers of
     // incomplete type have undefined behavior according to the C++11 standard, and
     // in practice including node.hpp here was causing compilation errors on some
@@ -36,6 +36,8 @@ namespace ngraph
         // Describes an output tensor of an op
         class NGRAPH_API Output
         {
+            friend class Input;
+
         public:
             /// \param node Node that owns this output.
             /// \param index Position of the output tensor in all output tensors
@@ -43,6 +45,7 @@ namespace ngraph
             Output(Node* node, size_t index, const std::shared_ptr<Tensor>& tensor);
 
             std::shared_ptr<Node> get_node() const;
+            Node* get_raw_pointer_node() const { return m_node; }
             size_t get_index() const { return m_index; }
             std::shared_ptr<Tensor> get_tensor_ptr() const { return m_tensor; }
             void set_tensor_ptr(const std::shared_ptr<Tensor>& tensor) { m_tensor = tensor; }
@@ -61,7 +64,9 @@ namespace ngraph
             const element::Type& get_element_type() const;
 
             Output(const Output&) = default;
-            Output(Output&&) = default;
+            /// \brief Takes over the inputs connected to output, so the outputs of a node can be
+            ///        kept in a vector
+            Output(Output&& output) noexcept;
             Output& operator=(const Output&) = default;
 
         protected:
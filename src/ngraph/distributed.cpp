@@ -44,12 +44,38 @@ std::ostream& reduction::operator<<(std::ostream& out, const reduction::Type& ob
     return out << as_string(obj);
 }
 
+namespace
+{
+    class CompletedDistributedRequest : public DistributedRequest
+    {
+    public:
+        void wait() override {}
+    };
+}
+
+std::shared_ptr<DistributedRequest> DistributedInterface::all_reduce_async(
+    void* in, void* out, element::Type_t element_type, reduction::Type reduce_type, size_t count)
+{
+    all_reduce(in, out, element_type, reduce_type, count);
+    return std::make_shared<CompletedDistributedRequest>();
+}
+
+std::shared_ptr<DistributedRequest> DistributedInterface::broadcast_async(
+    void* in, element::Type_t element_type, size_t count, int root_id)
+{
+    broadcast(in, element_type, count, root_id);
+    return std::make_shared<CompletedDistributedRequest>();
+}
+
 static std::unique_ptr<DistributedInterface> s_distributed_interface;
 
-void ngraph::set_distributed_interface(std::unique_ptr<DistributedInterface> distributed_interface)
+std::unique_ptr<DistributedInterface>
+    ngraph::set_distributed_interface(std::unique_ptr<DistributedInterface> distributed_interface)
 {
-    NGRAPH_DEBUG << "Setting distributed interface to: " << distributed_interface->get_name();
-    s_distributed_interface = std::move(distributed_interface);
+    NGRAPH_DEBUG << "Setting distributed interface to: "
+                 << (distributed_interface ? distributed_interface->get_name() : "default");
+    std::swap(s_distributed_interface, distributed_interface);
+    return distributed_interface;
 }
 
 DistributedInterface* ngraph::get_distributed_interface()
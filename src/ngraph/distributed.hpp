@@ -53,6 +53,16 @@ namespace ngraph
         const DiscreteTypeInfo& get_type_info() const override { return type_info; }
     };
 
+    /// \brief A collective started by one of the `*_async` calls of DistributedInterface.
+    class DistributedRequest
+    {
+    public:
+        virtual ~DistributedRequest() {}
+        /// \brief Blocks until the collective is complete. May be called more than once, and
+        ///        from any thread; calls after the first one return immediately.
+        virtual void wait() = 0;
+    };
+
     class DistributedInterface
     {
     public:
@@ -72,8 +82,27 @@ namespace ngraph
         virtual void recv(void* in, element::Type_t element_type, size_t count, int src_id) = 0;
         virtual void
             send(const void* in, element::Type_t element_type, size_t count, int dest_id) = 0;
+
+        /// \brief Starts an all_reduce and returns without waiting for it to complete.
+        ///
+        /// `in` may be reused as soon as the call returns, `out` must stay valid and must not
+        /// be read until the request has been waited for. All ranks must start their
+        /// collectives in the same order. The default implementation runs all_reduce and
+        /// returns a completed request.
+        virtual std::shared_ptr<DistributedRequest> all_reduce_async(void* in,
+                                                                     void* out,
+                                                                     element::Type_t element_type,
+                                                                     reduction::Type reduce_type,
+                                                                     size_t count);
+        /// \brief Starts a broadcast and returns without waiting for it to complete. `in` must
+        ///        stay valid and must not be used until the request has been waited for.
+        virtual std::shared_ptr<DistributedRequest>
+            broadcast_async(void* in, element::Type_t element_type, size_t count, int root_id);
     };
 
-    void set_distributed_interface(std::unique_ptr<DistributedInterface> distributed_interface);
+    /// \brief Installs the interface used by distributed ops and returns the previous one, which
+    ///        may be null. Installing null selects the default interface on next use.
+    std::unique_ptr<DistributedInterface>
+        set_distributed_interface(std::unique_ptr<DistributedInterface> distributed_interface);
     DistributedInterface* get_distributed_interface();
 }
@@ -22,6 +22,9 @@
 #include "ngraph/distributed.hpp"
 
 #ifdef NGRAPH_DISTRIBUTED_OMPI_ENABLE
+#include <cstring>
+#include <memory>
+#include <mutex>
 #include <string>
 
 #include <mpi.h>
@@ -83,39 +86,36 @@ namespace ngraph
                             reduction::Type reduce_type,
                             size_t count) override
             {
-                auto data_type = MPI_FLOAT;
+                MPI_Allreduce(in,
+                              out,
+                              count,
+                              all_reduce_data_type(element_type),
+                              all_reduce_op(reduce_type),
+                              MPI_COMM_WORLD);
+            }
 
-                if (element_type == element::Type_t::f32)
-                {
-                    data_type = MPI_FLOAT;
-                }
-                else if (element_type == element::Type_t::f64)
-                {
-                    data_type = MPI_DOUBLE;
-                }
-                else
+            std::shared_ptr<DistributedRequest> all_reduce_async(void* in,
+                                                                 void* out,
+                                                                 element::Type_t element_type,
+                                                                 reduction::Type reduce_type,
+                                                                 size_t count) override
+            {
+                auto data_type = all_reduce_data_type(element_type);
+                auto mpi_reduce_type = all_reduce_op(reduce_type);
+                // Reduce in place so that the caller can reuse the input right away
+                if (in != out)
                 {
-                    throw std::runtime_error("AllReduce op supports only f32 and f64 types");
+                    std::memcpy(out, in, count * element::Type(element_type).size());
                 }
-
-                decltype(MPI_SUM) mpi_reduce_type;
-#if defined(__GNUC__) && !(__GNUC__ == 4 && __GNUC_MINOR__ == 8)
-#pragma GCC diagnostic push
-#pragma GCC diagnostic error "-Wswitch"
-#pragma GCC diagnostic error "-Wswitch-enum"
-#endif
-                switch (reduce_type)
-                {
-                case reduction::Type::SUM: mpi_reduce_type = MPI_SUM; break;
-                case reduction::Type::PROD: mpi_reduce_type = MPI_PROD; break;
-                case reduction::Type::MIN: mpi_reduce_type = MPI_MIN; break;
-                case reduction::Type::MAX: mpi_reduce_type = MPI_MAX; break;
-                }
-#if defined(__GNUC__) && !(__GNUC__ == 4 && __GNUC_MINOR__ == 8)
-#pragma GCC diagnostic pop
-#endif
-
-                MPI_Allreduce(in, out, count, data_type, mpi_reduce_type, MPI_COMM_WORLD);
+                auto request = std::make_shared<OpenMPIRequest>();
+                MPI_Iallreduce(MPI_IN_PLACE,
+                               out,
+                               count,
+                               data_type,
+                               mpi_reduce_type,
+                               MPI_COMM_WORLD,
+                               &request->m_request);
+                return request;
             }
 
             void broadcast(void* in,
@@ -137,6 +137,27 @@ namespace ngraph
                 MPI_Bcast(in, count, data_type, root_id, MPI_COMM_WORLD);
             }
 
+            std::shared_ptr<DistributedRequest> broadcast_async(void* in,
+                                                                element::Type_t element_type,
+                                                                size_t count,
+                                                                int root_id) override
+            {
+                auto data_type = MPI_FLOAT;
+
+                if (element_type == element::Type_t::f64)
+                {
+                    data_type = MPI_DOUBLE;
+                }
+                else if (element_type != element::Type_t::f32)
+                {
+                    throw std::runtime_error(
+                        "BroadcastDistributed op supports only f32 and f64 types");
+                }
+                auto request = std::make_shared<OpenMPIRequest>();
+                MPI_Ibcast(in, count, data_type, root_id, MPI_COMM_WORLD, &request->m_request);
+                return request;
+            }
+
             void recv(void* in, element::Type_t element_type, size_t count, int src_id) override
             {
                 auto data_type = MPI_FLOAT;
@@ -173,6 +194,66 @@ namespace ngraph
             }
 
         protected:
+            class OpenMPIRequest : public DistributedRequest
+            {
+            public:
+                void wait() override
+                {
+                    std::lock_guard<std::mutex> lock(m_mutex);
+                    if (m_request != MPI_REQUEST_NULL)
+                    {
+                        // MPI_Wait resets the request to MPI_REQUEST_NULL
+                        MPI_Wait(&m_request, MPI_STATUS_IGNORE);
+                    }
+                }
+
+                MPI_Request m_request = MPI_REQUEST_NULL;
+
+            private:
+                std::mutex m_mutex;
+            };
+
+            MPI_Datatype all_reduce_data_type(element::Type_t element_type)
+            {
+                auto data_type = MPI_FLOAT;
+
+                if (element_type == element::Type_t::f32)
+                {
+                    data_type = MPI_FLOAT;
+                }
+                else if (element_type == element::Type_t::f64)
+                {
+                    data_type = MPI_DOUBLE;
+                }
+                else
+                {
+                    throw std::runtime_error("AllReduce op supports only f32 and f64 types");
+                }
+
+                return data_type;
+            }
+
+            MPI_Op all_reduce_op(reduction::Type reduce_type)
+            {
+                decltype(MPI_SUM) mpi_reduce_type = MPI_SUM;
+#if defined(__GNUC__) && !(__GNUC__ == 4 && __GNUC_MINOR__ == 8)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic error "-Wswitch"
+#pragma GCC diagnostic error "-Wswitch-enum"
+#endif
+                switch (reduce_type)
+                {
+                case reduction::Type::SUM: mpi_reduce_type = MPI_SUM; break;
+                case reduction::Type::PROD: mpi_reduce_type = MPI_PROD; break;
+                case reduction::Type::MIN: mpi_reduce_type = MPI_MIN; break;
+                case reduction::Type::MAX: mpi_reduce_type = MPI_MAX; break;
+                }
+#if defined(__GNUC__) && !(__GNUC__ == 4 && __GNUC_MINOR__ == 8)
+#pragma GCC diagnostic pop
+#endif
+                return mpi_reduce_type;
+            }
+
             MPI_Datatype ngraph_type_to_mpi_type(element::Type_t& n_type)
             {
                 MPI_Datatype m_type = MPI_FLOAT;
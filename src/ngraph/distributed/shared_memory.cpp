@@ -0,0 +1,459 @@
+//*****************************************************************************
+// Copyright 2017-2019 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#ifndef _WIN32
+
+#include <algorithm>
+#include <atomic>
+#include <cstdio>
+#include <cstring>
+#include <exception>
+#include <sys/mman.h>
+#include <sys/wait.h>
+#include <unistd.h>
+
+#include "ngraph/check.hpp"
+#include "ngraph/distributed/shared_memory.hpp"
+#include "ngraph/except.hpp"
+
+using namespace std;
+using namespace ngraph;
+
+namespace
+{
+    constexpr size_t alignment = 64;
+
+    size_t align(size_t size) { return (size + alignment - 1) / alignment * alignment; }
+
+    template <typename T>
+    void reduce(char* out,
+                const vector<const char*>& inputs,
+                size_t count,
+                reduction::Type reduce_type)
+    {
+        T* result = reinterpret_cast<T*>(out);
+        const T* first = reinterpret_cast<const T*>(inputs[0]);
+        copy(first, first + count, result);
+        for (size_t rank = 1; rank < inputs.size(); ++rank)
+        {
+            const T* input = reinterpret_cast<const T*>(inputs[rank]);
+            switch (reduce_type)
+            {
+            case reduction::Type::SUM:
+                for (size_t i = 0; i < count; ++i)
+                {
+                    result[i] += input[i];
+                }
+                break;
+            case reduction::Type::PROD:
+                for (size_t i = 0; i < count; ++i)
+                {
+                    result[i] *= input[i];
+                }
+                break;
+            case reduction::Type::MIN:
+                for (size_t i = 0; i < count; ++i)
+                {
+                    result[i] = min(result[i], input[i]);
+                }
+                break;
+            case reduction::Type::MAX:
+                for (size_t i = 0; i < count; ++i)
+                {
+                    result[i] = max(result[i], input[i]);
+                }
+                break;
+            }
+        }
+    }
+
+    void reduce(element::Type_t element_type,
+                char* out,
+                const vector<const char*>& inputs,
+                size_t count,
+                reduction::Type reduce_type)
+    {
+        switch (element_type)
+        {
+        case element::Type_t::f32: reduce<float>(out, inputs, count, reduce_type); break;
+        case element::Type_t::f64: reduce<double>(out, inputs, count, reduce_type); break;
+        case element::Type_t::i8: reduce<int8_t>(out, inputs, count, reduce_type); break;
+        case element::Type_t::i16: reduce<int16_t>(out, inputs, count, reduce_type); break;
+        case element::Type_t::i32: reduce<int32_t>(out, inputs, count, reduce_type); break;
+        case element::Type_t::i64: reduce<int64_t>(out, inputs, count, reduce_type); break;
+        case element::Type_t::u8: reduce<uint8_t>(out, inputs, count, reduce_type); break;
+        case element::Type_t::u16: reduce<uint16_t>(out, inputs, count, reduce_type); break;
+        case element::Type_t::u32: reduce<uint32_t>(out, inputs, count, reduce_type); break;
+        case element::Type_t::u64: reduce<uint64_t>(out, inputs, count, reduce_type); break;
+        default: throw ngraph_error("AllReduce does not support this element type");
+        }
+    }
+
+    void check_reduce_element_type(element::Type_t element_type)
+    {
+        switch (element_type)
+        {
+        case element::Type_t::f32:
+        case element::Type_t::f64:
+        case element::Type_t::i8:
+        case element::Type_t::i16:
+        case element::Type_t::i32:
+        case element::Type_t::i64:
+        case element::Type_t::u8:
+        case element::Type_t::u16:
+        case element::Type_t::u32:
+        case element::Type_t::u64: break;
+        default:
+            throw ngraph_error("AllReduce does not support element type " +
+                               element::Type(element_type).get_type_name());
+        }
+    }
+}
+
+/// \brief The barrier state at the start of the shared mapping
+struct distributed::SharedMemoryDistributedInterface::Header
+{
+    atomic<uint64_t> arrived{0};
+    atomic<uint64_t> generation{0};
+};
+
+/// \brief A one-way channel between two ranks, followed by its data
+struct distributed::SharedMemoryDistributedInterface::Channel
+{
+    atomic<uint32_t> full{0};
+};
+
+class distributed::SharedMemoryDistributedInterface::Request : public DistributedRequest
+{
+public:
+    void wait() override
+    {
+        unique_lock<mutex> lock(m_mutex);
+        m_completed.wait(lock, [this] { return m_done; });
+        if (m_exception)
+        {
+            rethrow_exception(m_exception);
+        }
+    }
+
+    void complete(exception_ptr exception)
+    {
+        {
+            lock_guard<mutex> lock(m_mutex);
+            m_done = true;
+            m_exception = exception;
+        }
+        m_completed.notify_all();
+    }
+
+private:
+    mutex m_mutex;
+    condition_variable m_completed;
+    bool m_done = false;
+    exception_ptr m_exception;
+};
+
+distributed::SharedMemoryDistributedInterface::SharedMemoryDistributedInterface(
+    int size, size_t buffer_size, const string& name)
+    : m_name(name)
+    , m_size(size)
+    , m_buffer_size(align(max(buffer_size, alignment)))
+{
+    NGRAPH_CHECK(size > 0, "A process group needs at least one process");
+    m_channel_size = align(max(m_buffer_size / m_size, alignment));
+    m_mapping_size = alignment + m_size * m_buffer_size +
+                     m_size * m_size * (alignment + m_channel_size);
+    m_mapping =
+        mmap(nullptr, m_mapping_size, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_ANONYMOUS, -1, 0);
+    if (m_mapping == MAP_FAILED)
+    {
+        throw ngraph_error("Cannot map " + to_string(m_mapping_size) + " bytes of shared memory");
+    }
+    m_header = new (m_mapping) Header();
+    for (int src_id = 0; src_id < m_size; ++src_id)
+    {
+        for (int dest_id = 0; dest_id < m_size; ++dest_id)
+        {
+            new (&get_channel(src_id, dest_id)) Channel();
+        }
+    }
+}
+
+distributed::SharedMemoryDistributedInterface::~SharedMemoryDistributedInterface()
+{
+    {
+        lock_guard<mutex> lock(m_queue_mutex);
+        m_stop = true;
+    }
+    m_queue_changed.notify_all();
+    if (m_worker.joinable())
+    {
+        m_worker.join();
+    }
+    munmap(m_mapping, m_mapping_size);
+}
+
+int distributed::SharedMemoryDistributedInterface::fork_ranks()
+{
+    NGRAPH_CHECK(m_rank == 0 && m_children.empty(), "The ranks are already forked");
+    // Threads do not survive fork, the worker must be started by every rank
+    NGRAPH_CHECK(!m_worker.joinable(), "Ranks must be forked before starting collectives");
+    fflush(nullptr);
+    for (int rank = 1; rank < m_size; ++rank)
+    {
+        pid_t pid = fork();
+        if (pid < 0)
+        {
+            throw ngraph_error("Cannot fork the process of rank " + to_string(rank));
+        }
+        if (pid == 0)
+        {
+            m_rank = rank;
+            m_children.clear();
+            return m_rank;
+        }
+        m_children.push_back(pid);
+    }
+    return m_rank;
+}
+
+bool distributed::SharedMemoryDistributedInterface::join_ranks()
+{
+    NGRAPH_CHECK(m_rank == 0, "Only rank 0 can join the other ranks");
+    bool success = true;
+    for (pid_t pid : m_children)
+    {
+        int status = 0;
+        if (waitpid(pid, &status, 0) != pid || !WIFEXITED(status) || WEXITSTATUS(status) != 0)
+        {
+            success = false;
+        }
+    }
+    m_children.clear();
+    return success;
+}
+
+void distributed::SharedMemoryDistributedInterface::log_print(const string& timestamp,
+                                                              const vector<char>& buf)
+{
+    printf("%s [%s RANK: %d]: %s\n", timestamp.c_str(), m_name.c_str(), m_rank, buf.data());
+}
+
+void distributed::SharedMemoryDistributedInterface::all_reduce(void* in,
+                                                               void* out,
+                                                               element::Type_t element_type,
+                                                               reduction::Type reduce_type,
+                                                               size_t count)
+{
+    // Collectives go through the queue to keep the same order on all ranks
+    all_reduce_async(in, out, element_type, reduce_type, count)->wait();
+}
+
+void distributed::SharedMemoryDistributedInterface::broadcast(void* in,
+                                                              element::Type_t element_type,
+                                                              size_t count,
+                                                              int root_id)
+{
+    broadcast_async(in, element_type, count, root_id)->wait();
+}
+
+void distributed::SharedMemoryDistributedInterface::recv(void* in,
+                                                         element::Type_t element_type,
+                                                         size_t count,
+                                                         int src_id)
+{
+    Channel& channel = get_channel(src_id, m_rank);
+    const char* channel_data = reinterpret_cast<const char*>(&channel) + alignment;
+    char* data = static_cast<char*>(in);
+    size_t byte_size = count * element::Type(element_type).size();
+    for (size_t offset = 0; offset < byte_size; offset += m_channel_size)
+    {
+        while (channel.full.load(memory_order_acquire) == 0)
+        {
+            this_thread::yield();
+        }
+        memcpy(data + offset, channel_data, min(m_channel_size, byte_size - offset));
+        channel.full.store(0, memory_order_release);
+    }
+}
+
+void distributed::SharedMemoryDistributedInterface::send(const void* in,
+                                                         element::Type_t element_type,
+                                                         size_t count,
+                                                         int dest_id)
+{
+    Channel& channel = get_channel(m_rank, dest_id);
+    char* channel_data = reinterpret_cast<char*>(&channel) + alignment;
+    const char* data = static_cast<const char*>(in);
+    size_t byte_size = count * element::Type(element_type).size();
+    for (size_t offset = 0; offset < byte_size; offset += m_channel_size)
+    {
+        while (channel.full.load(memory_order_acquire) != 0)
+        {
+            this_thread::yield();
+        }
+        memcpy(channel_data, data + offset, min(m_channel_size, byte_size - offset));
+        channel.full.store(1, memory_order_release);
+    }
+}
+
+shared_ptr<DistributedRequest>
+    distributed::SharedMemoryDistributedInterface::all_reduce_async(void* in,
+                                                                    void* out,
+                                                                    element::Type_t element_type,
+                                                                    reduction::Type reduce_type,
+                                                                    size_t count)
+{
+    check_reduce_element_type(element_type);
+    // Reduce in place so that the caller can reuse the input right away
+    if (in != out)
+    {
+        memcpy(out, in, count * element::Type(element_type).size());
+    }
+    return enqueue([this, out, element_type, reduce_type, count]() {
+        run_all_reduce(out, element_type, reduce_type, count);
+    });
+}
+
+shared_ptr<DistributedRequest> distributed::SharedMemoryDistributedInterface::broadcast_async(
+    void* in, element::Type_t element_type, size_t count, int root_id)
+{
+    NGRAPH_CHECK(root_id >= 0 && root_id < m_size, "Invalid broadcast root ", root_id);
+    size_t byte_size = count * element::Type(element_type).size();
+    return enqueue([this, in, byte_size, root_id]() { run_broadcast(in, byte_size, root_id); });
+}
+
+shared_ptr<DistributedRequest>
+    distributed::SharedMemoryDistributedInterface::enqueue(function<void()> collective)
+{
+    auto request = make_shared<Request>();
+    {
+        lock_guard<mutex> lock(m_queue_mutex);
+        m_queue.emplace_back(move(collective), request);
+        if (!m_worker.joinable())
+        {
+            m_worker = thread(&SharedMemoryDistributedInterface::run_worker, this);
+        }
+    }
+    m_queue_changed.notify_one();
+    return request;
+}
+
+void distributed::SharedMemoryDistributedInterface::run_worker()
+{
+    while (true)
+    {
+        pair<function<void()>, shared_ptr<Request>> item;
+        {
+            unique_lock<mutex> lock(m_queue_mutex);
+            m_queue_changed.wait(lock, [this] { return m_stop || !m_queue.empty(); });
+            if (m_queue.empty())
+            {
+                return;
+            }
+            item = move(m_queue.front());
+            m_queue.pop_front();
+        }
+        try
+        {
+            item.first();
+            item.second->complete(nullptr);
+        }
+        catch (...)
+        {
+            item.second->complete(current_exception());
+        }
+    }
+}
+
+void distributed::SharedMemoryDistributedInterface::barrier()
+{
+    uint64_t generation = m_header->generation.load(memory_order_acquire);
+    if (m_header->arrived.fetch_add(1, memory_order_acq_rel) + 1 == static_cast<uint64_t>(m_size))
+    {
+        m_header->arrived.store(0, memory_order_relaxed);
+        m_header->generation.fetch_add(1, memory_order_release);
+    }
+    else
+    {
+        while (m_header->generation.load(memory_order_acquire) == generation)
+        {
+            this_thread::yield();
+        }
+    }
+}
+
+char* distributed::SharedMemoryDistributedInterface::get_buffer(int rank) const
+{
+    return static_cast<char*>(m_mapping) + alignment + rank * m_buffer_size;
+}
+
+distributed::SharedMemoryDistributedInterface::Channel&
+    distributed::SharedMemoryDistributedInterface::get_channel(int src_id, int dest_id) const
+{
+    NGRAPH_CHECK(src_id >= 0 && src_id < m_size && dest_id >= 0 && dest_id < m_size,
+                 "Invalid rank");
+    char* channels = get_buffer(m_size);
+    return *reinterpret_cast<Channel*>(channels +
+                                       (src_id * m_size + dest_id) * (alignment + m_channel_size));
+}
+
+void distributed::SharedMemoryDistributedInterface::run_all_reduce(void* out,
+                                                                   element::Type_t element_type,
+                                                                   reduction::Type reduce_type,
+                                                                   size_t count)
+{
+    size_t element_size = element::Type(element_type).size();
+    size_t chunk = m_buffer_size / element_size;
+    vector<const char*> inputs(m_size);
+    for (int rank = 0; rank < m_size; ++rank)
+    {
+        inputs[rank] = get_buffer(rank);
+    }
+    char* data = static_cast<char*>(out);
+    for (size_t offset = 0; offset < count; offset += chunk)
+    {
+        size_t n = min(chunk, count - offset);
+        memcpy(get_buffer(m_rank), data + offset * element_size, n * element_size);
+        barrier();
+        reduce(element_type, data + offset * element_size, inputs, n, reduce_type);
+        // Nobody writes its buffer again before everybody has read it
+        barrier();
+    }
+}
+
+void distributed::SharedMemoryDistributedInterface::run_broadcast(void* in,
+                                                                  size_t byte_size,
+                                                                  int root_id)
+{
+    char* data = static_cast<char*>(in);
+    for (size_t offset = 0; offset < byte_size; offset += m_buffer_size)
+    {
+        size_t n = min(m_buffer_size, byte_size - offset);
+        if (m_rank == root_id)
+        {
+            memcpy(get_buffer(root_id), data + offset, n);
+        }
+        barrier();
+        if (m_rank != root_id)
+        {
+            memcpy(data + offset, get_buffer(root_id), n);
+        }
+        barrier();
+    }
+}
+
+#endif
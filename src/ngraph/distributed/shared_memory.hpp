@@ -0,0 +1,139 @@
+//*****************************************************************************
+// Copyright 2017-2019 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#pragma once
+
+#ifndef _WIN32
+
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <sys/types.h>
+#include <thread>
+#include <vector>
+
+#include "ngraph/distributed.hpp"
+#include "ngraph/ngraph_visibility.hpp"
+
+namespace ngraph
+{
+    namespace distributed
+    {
+        /// \brief A DistributedInterface for a group of processes forked on the local machine,
+        ///        which exchange data through an anonymous shared memory mapping.
+        ///
+        /// Meant for testing distributed graphs without an MPI installation:
+        /// \code
+        ///     auto comm = new SharedMemoryDistributedInterface(4);
+        ///     int rank = comm->fork_ranks();
+        ///     set_distributed_interface(std::unique_ptr<DistributedInterface>(comm));
+        ///     ... run the distributed graph ...
+        ///     if (rank != 0) { _exit(0); }
+        ///     bool success = comm->join_ranks();
+        /// \endcode
+        ///
+        /// Collectives, blocking or not, are run one after the other by a worker thread of each
+        /// process, in the order in which they were started. Every rank reduces the whole
+        /// buffer in rank order, so all ranks get the same results.
+        class NGRAPH_API SharedMemoryDistributedInterface : public DistributedInterface
+        {
+        public:
+            /// \brief Maps the shared memory of a group of `size` processes. The calling process
+            ///        is rank 0 of the group.
+            ///
+            /// \param size The number of processes of the group
+            /// \param buffer_size The number of bytes every rank exchanges at a time; larger
+            ///                    collectives are done in several steps
+            SharedMemoryDistributedInterface(int size,
+                                             size_t buffer_size = 1 << 22,
+                                             const std::string& name = "SharedMemory");
+            ~SharedMemoryDistributedInterface() override;
+
+            /// \brief Forks the processes of ranks 1 to size - 1. Must be called before any
+            ///        collective is started.
+            /// \return The rank of the calling process
+            int fork_ranks();
+            /// \brief Waits for the processes of the other ranks to exit. Only rank 0 may call it.
+            /// \return true if all of them exited with status 0
+            bool join_ranks();
+
+            const std::string& get_name() const override { return m_name; }
+            int get_size() override { return m_size; }
+            int get_rank() override { return m_rank; }
+            void log_print(const std::string& timestamp, const std::vector<char>& buf) override;
+
+            void all_reduce(void* in,
+                            void* out,
+                            element::Type_t element_type,
+                            reduction::Type reduce_type,
+                            size_t count) override;
+            void broadcast(void* in,
+                           element::Type_t element_type,
+                           size_t count,
+                           int root_id) override;
+            void recv(void* in, element::Type_t element_type, size_t count, int src_id) override;
+            void send(const void* in,
+                      element::Type_t element_type,
+                      size_t count,
+                      int dest_id) override;
+
+            std::shared_ptr<DistributedRequest> all_reduce_async(void* in,
+                                                                 void* out,
+                                                                 element::Type_t element_type,
+                                                                 reduction::Type reduce_type,
+                                                                 size_t count) override;
+            std::shared_ptr<DistributedRequest> broadcast_async(void* in,
+                                                                element::Type_t element_type,
+                                                                size_t count,
+                                                                int root_id) override;
+
+        private:
+            class Request;
+            struct Header;
+            struct Channel;
+
+            std::shared_ptr<DistributedRequest> enqueue(std::function<void()> collective);
+            void run_worker();
+            void barrier();
+            char* get_buffer(int rank) const;
+            Channel& get_channel(int src_id, int dest_id) const;
+            void run_all_reduce(
+                void* out, element::Type_t element_type, reduction::Type reduce_type, size_t count);
+            void run_broadcast(void* in, size_t byte_size, int root_id);
+
+            std::string m_name;
+            int m_size;
+            int m_rank = 0;
+            size_t m_buffer_size;
+            size_t m_channel_size;
+            size_t m_mapping_size;
+            void* m_mapping;
+            Header* m_header;
+            std::vector<pid_t> m_children;
+
+            std::mutex m_queue_mutex;
+            std::condition_variable m_queue_changed;
+            std::deque<std::pair<std::function<void()>, std::shared_ptr<Request>>> m_queue;
+            bool m_stop = false;
+            std::thread m_worker;
+        };
+    }
+}
+
+#endif
@@ -14,10 +14,18 @@
 // limitations under the License.
 //*****************************************************************************
 
+#include <algorithm>
+#include <atomic>
+#include <cstdlib>
+#include <exception>
 #include <functional>
+#include <thread>
+#include <unordered_map>
+#include <unordered_set>
 
 #include "graph.hpp"
 #include "node.hpp"
+#include "onnx.hpp"
 
 namespace ngraph
 {
@@ -56,24 +64,162 @@ namespace ngraph
                 std::string domain = get_node_domain(node_proto);
                 return (domain.empty() ? "" : domain + ".") + node_proto.op_type();
             }
+
+            // Set on the threads of a parallel import, so subgraphs are imported sequentially
+            static thread_local bool s_import_worker = false;
+
+            // Set by set_import_thread_count, 0 selects the default
+            static std::atomic<std::size_t> s_import_thread_count{0};
+
+            /// \brief Gets the number of threads importing the current graph, 1 on the
+            ///        threads of a parallel import.
+            static std::size_t get_thread_count()
+            {
+                return s_import_worker ? 1 : onnx_import::get_import_thread_count();
+            }
+
+            /// \brief Runs task(i) for each i in [0, count) on up to thread_count threads, the
+            ///        calling thread included. All tasks run even if some fail, then the
+            ///        exception of the first failed task is rethrown.
+            static void parallel_for(std::size_t count,
+                                     std::size_t thread_count,
+                                     const std::function<void(std::size_t)>& task)
+            {
+                thread_count = std::min(thread_count, count);
+                if (thread_count <= 1)
+                {
+                    for (std::size_t i = 0; i < count; ++i)
+                    {
+                        task(i);
+                    }
+                    return;
+                }
+
+                std::atomic<std::size_t> next{0};
+                std::vector<std::exception_ptr> errors(count);
+                auto worker = [&]() {
+                    bool was_worker = s_import_worker;
+                    s_import_worker = true;
+                    for (std::size_t i = next++; i < count; i = next++)
+                    {
+                        try
+                        {
+                            task(i);
+                        }
+                        catch (...)
+                        {
+                            errors[i] = std::current_exception();
+                        }
+                    }
+                    s_import_worker = was_worker;
+                };
+                std::vector<std::thread> threads;
+                for (std::size_t i = 1; i < thread_count; ++i)
+                {
+                    threads.emplace_back(worker);
+                }
+                worker();
+                for (auto& thread : threads)
+                {
+                    thread.join();
+                }
+                for (const auto& error : errors)
+                {
+                    if (error)
+                    {
+                        std::rethrow_exception(error);
+                    }
+                }
+            }
+
+            /// \brief Appends the nodes reachable from roots that have an instance id of at
+            ///        least first_id and are not in visited, in the order they were created.
+            static void collect_new_nodes(const NodeVector& roots,
+                                          std::size_t first_id,
+                                          std::unordered_set<ngraph::Node*>& visited,
+                                          std::vector<ngraph::Node*>& new_nodes)
+            {
+                std::size_t begin = new_nodes.size();
+                std::vector<ngraph::Node*> stack;
+                for (const auto& root : roots)
+                {
+                    stack.push_back(root.get());
+                }
+                while (!stack.empty())
+                {
+                    ngraph::Node* node = stack.back();
+                    stack.pop_back();
+                    if (node->get_instance_id() < first_id || !visited.insert(node).second)
+                    {
+                        continue;
+                    }
+                    new_nodes.push_back(node);
+                    for (std::size_t i = 0; i < node->get_input_size(); ++i)
+                    {
+                        stack.push_back(node->input_value(i).get_node());
+                    }
+                    for (const auto& dependency : node->get_control_dependencies())
+                    {
+                        stack.push_back(dependency.get());
+                    }
+                }
+                // The nodes of one ONNX node are created on one thread, in id order
+                std::sort(new_nodes.begin() + begin,
+                          new_nodes.end(),
+                          [](const ngraph::Node* a, const ngraph::Node* b) {
+                              return a->get_instance_id() < b->get_instance_id();
+                          });
+            }
         } // namespace detail
 
+        void set_import_thread_count(std::size_t thread_count)
+        {
+            detail::s_import_thread_count = thread_count;
+        }
+
+        std::size_t get_import_thread_count()
+        {
+            static const std::size_t default_thread_count = []() -> std::size_t {
+                if (const char* env = std::getenv("NGRAPH_ONNX_IMPORT_THREADS"))
+                {
+                    return std::max<std::size_t>(1, std::strtoul(env, nullptr, 10));
+                }
+                return 1;
+            }();
+            std::size_t thread_count = detail::s_import_thread_count;
+            return thread_count > 0 ? thread_count : default_thread_count;
+        }
+
         Graph::Graph(const onnx::GraphProto& graph_proto, Model& model, const Weights& weights)
             : m_graph_proto{&graph_proto}
             , m_model{&model}
         {
-            // Process all initializers in the graph
+            std::size_t first_id = ngraph::Node::get_next_instance_id();
+            std::size_t thread_count = detail::get_thread_count();
+
+            // Process all initializers in the graph. Decoding them is independent, so the
+            // Constants are created in parallel and added to the cache afterwards.
+            std::vector<const onnx::TensorProto*> initializer_protos;
             for (const auto& initializer_tensor : m_graph_proto->initializer())
             {
                 if (initializer_tensor.has_name())
                 {
-                    Tensor tensor = Tensor{initializer_tensor};
-                    m_initializers.emplace(initializer_tensor.name(), tensor);
-
-                    // For each initializer, create a Constant node and store in cache
-                    m_ng_node_cache.emplace(initializer_tensor.name(), tensor.get_ng_constant());
+                    initializer_protos.push_back(&initializer_tensor);
                 }
             }
+            std::vector<std::shared_ptr<ngraph::Node>> initializer_constants(
+                initializer_protos.size());
+            detail::parallel_for(initializer_protos.size(), thread_count, [&](std::size_t i) {
+                initializer_constants[i] = Tensor{*initializer_protos[i]}.get_ng_constant();
+            });
+            for (std::size_t i = 0; i < initializer_protos.size(); ++i)
+            {
+                const onnx::TensorProto& initializer_tensor = *initializer_protos[i];
+                m_initializers.emplace(initializer_tensor.name(), Tensor{initializer_tensor});
+
+                // For each initializer, store the Constant node in cache
+                m_ng_node_cache.emplace(initializer_tensor.name(), initializer_constants[i]);
+            }
 
             // Process all ONNX graph inputs, convert them to nGraph nodes and store in cache
             for (const auto& input : m_graph_proto->input())
@@ -129,20 +275,143 @@ namespace ngraph
                          detail::to_string(unknown_operators));
 
             // Process ONNX graph nodes, convert to nGraph nodes
-            for (const auto& node_proto : m_graph_proto->node())
+            const auto& node_protos = m_graph_proto->node();
+            m_nodes.reserve(node_protos.size());
+            for (const auto& node_proto : node_protos)
             {
                 m_nodes.emplace_back(node_proto, *this);
-                const Node& node{m_nodes.back()};
+            }
+            std::vector<NodeVector> ng_nodes(m_nodes.size());
+            for (const auto& level : get_node_levels())
+            {
+                // Nodes of one level do not depend on each other. Converting a node adds its
+                // nGraph nodes to the outputs feeding it, so nodes sharing an input are
+                // converted by the same task.
+                std::vector<std::vector<std::size_t>> tasks = group_nodes_by_inputs(level);
+                detail::parallel_for(tasks.size(), thread_count, [&](std::size_t task) {
+                    for (std::size_t index : tasks[task])
+                    {
+                        ng_nodes[index] = m_nodes[index].get_ng_nodes();
+                    }
+                });
+                for (std::size_t index : level)
+                {
+                    const Node& node{m_nodes[index]};
+                    // Iterate over the number of outputs for given node in graph.
+                    // Some of them may be optional and trimmed. See:
+                    // https://github.com/onnx/onnx/blob/master/docs/IR.md#optional-inputs-and-outputs
+                    for (std::size_t i{0}; i < node.get_outputs_size(); ++i)
+                    {
+                        m_ng_node_cache[node.output(i)] = ng_nodes[index].at(i);
+                    }
+                }
+            }
 
-                NodeVector ng_nodes{node.get_ng_nodes()};
-                // Iterate over the number of outputs for given node in graph.
-                // Some of them may be optional and trimmed. See:
-                // https://github.com/onnx/onnx/blob/master/docs/IR.md#optional-inputs-and-outputs
-                for (std::size_t i{0}; i < node.get_outputs_size(); ++i)
+            // Number the nGraph nodes in the order of the ONNX graph, as a sequential import
+            // would, so their names do not depend on the number of threads
+            std::unordered_set<ngraph::Node*> visited;
+            std::vector<ngraph::Node*> new_nodes;
+            detail::collect_new_nodes(initializer_constants, first_id, visited, new_nodes);
+            for (const auto& input : m_graph_proto->input())
+            {
+                detail::collect_new_nodes(
+                    {m_ng_node_cache.at(input.name())}, first_id, visited, new_nodes);
+            }
+            for (const auto& nodes : ng_nodes)
+            {
+                detail::collect_new_nodes(nodes, first_id, visited, new_nodes);
+            }
+            std::size_t id = ngraph::Node::reserve_instance_ids(new_nodes.size());
+            for (ngraph::Node* node : new_nodes)
+            {
+                node->set_instance_id(id++);
+            }
+        }
+
+        std::vector<std::vector<std::size_t>> Graph::get_node_levels() const
+        {
+            // A node is one level above the highest node producing one of its inputs
+            std::unordered_map<std::string, std::size_t> producers;
+            for (std::size_t index = 0; index < m_nodes.size(); ++index)
+            {
+                for (const auto& name : m_graph_proto->node(static_cast<int>(index)).output())
+                {
+                    producers.emplace(name, index);
+                }
+            }
+            std::vector<std::size_t> node_levels(m_nodes.size(), 0);
+            std::vector<std::vector<std::size_t>> levels;
+            for (std::size_t index = 0; index < m_nodes.size(); ++index)
+            {
+                std::size_t level = 0;
+                for (const auto& name : m_graph_proto->node(static_cast<int>(index)).input())
+                {
+                    auto it = producers.find(name);
+                    // Producers that follow the node are not visible to it in ONNX order
+                    if (it != producers.end() && it->second < index)
+                    {
+                        level = std::max(level, node_levels[it->second] + 1);
+                    }
+                }
+                node_levels[index] = level;
+                if (level >= levels.size())
+                {
+                    levels.resize(level + 1);
+                }
+                levels[level].push_back(index);
+            }
+            return levels;
+        }
+
+        std::vector<std::vector<std::size_t>>
+            Graph::group_nodes_by_inputs(const std::vector<std::size_t>& level) const
+        {
+            // Union-find over the positions in level, joined by shared input names
+            std::vector<std::size_t> parents(level.size());
+            for (std::size_t i = 0; i < parents.size(); ++i)
+            {
+                parents[i] = i;
+            }
+            auto find_root = [&parents](std::size_t i) {
+                while (parents[i] != i)
+                {
+                    parents[i] = parents[parents[i]];
+                    i = parents[i];
+                }
+                return i;
+            };
+            // Inputs are compared by nGraph node, converters like Identity map several ONNX
+            // names to one node
+            std::unordered_map<const ngraph::Node*, std::size_t> first_consumers;
+            for (std::size_t i = 0; i < level.size(); ++i)
+            {
+                for (const auto& name : m_graph_proto->node(static_cast<int>(level[i])).input())
+                {
+                    auto input = m_ng_node_cache.find(name);
+                    if (input == m_ng_node_cache.end())
+                    {
+                        continue;
+                    }
+                    auto it = first_consumers.emplace(input->second.get(), i).first;
+                    std::size_t a = find_root(it->second);
+                    std::size_t b = find_root(i);
+                    // The smallest position is the root, so groups keep the ONNX order
+                    parents[std::max(a, b)] = std::min(a, b);
+                }
+            }
+            std::vector<std::vector<std::size_t>> groups;
+            std::vector<std::size_t> group_of_root(level.size());
+            for (std::size_t i = 0; i < level.size(); ++i)
+            {
+                std::size_t root = find_root(i);
+                if (root == i)
                 {
-                    m_ng_node_cache[node.output(i)] = ng_nodes.at(i);
+                    group_of_root[i] = groups.size();
+                    groups.emplace_back();
                 }
+                groups[group_of_root[root]].push_back(level[i]);
             }
+            return groups;
         }
 
         NodeVector Graph::get_ng_outputs() const
@@ -52,6 +52,16 @@ namespace ngraph
             }
 
         private:
+            /// \brief Groups the nodes by their depth in the graph. The nodes of a level only
+            ///        consume the outputs of lower levels. Levels and nodes in a level are in
+            ///        ONNX order.
+            std::vector<std::vector<std::size_t>> get_node_levels() const;
+            /// \brief Splits a level into groups of nodes that share no input node with the
+            ///        nodes of other groups. Must be called once the inputs of the level are
+            ///        in the node cache.
+            std::vector<std::vector<std::size_t>>
+                group_nodes_by_inputs(const std::vector<std::size_t>& level) const;
+
             const onnx::GraphProto* m_graph_proto;
             std::vector<Node> m_nodes;
             std::vector<ValueInfo> m_inputs;
@@ -23,6 +23,7 @@
 #include "ngraph/op/constant.hpp"
 #include "ngraph/shape.hpp"
 #include "ngraph/type/element_type.hpp"
+#include "tensor_external_data.hpp"
 
 namespace ngraph
 {
@@ -381,6 +382,10 @@ namespace ngraph
                 {
                     throw error::tensor::segments_unsupported{};
                 }
+                if (detail::TensorExternalData::is_external(*m_tensor_proto))
+                {
+                    return get_external_data<T>();
+                }
                 return detail::tensor::get_data<T>(*m_tensor_proto);
             }
 
@@ -429,8 +434,33 @@ namespace ngraph
             }
 
             operator TensorProto_DataType() const { return m_tensor_proto->data_type(); }
+            /// \brief Creates a Constant holding the tensor's data. External data is mapped
+            ///        and shared with the Constant, raw data is copied once, without
+            ///        conversion. Other data is converted from the typed protobuf fields.
             std::shared_ptr<ngraph::op::Constant> get_ng_constant() const
             {
+                if (m_tensor_proto->has_segment())
+                {
+                    throw error::tensor::segments_unsupported{};
+                }
+                if (detail::TensorExternalData::is_external(*m_tensor_proto))
+                {
+                    const element::Type& type = get_ng_type();
+                    detail::TensorExternalData external_data{*m_tensor_proto};
+                    return std::make_shared<ngraph::op::Constant>(
+                        type, m_shape, external_data.load(shape_size(m_shape) * type.size()));
+                }
+                if (m_tensor_proto->has_raw_data())
+                {
+                    const element::Type& type = get_ng_type();
+                    NGRAPH_CHECK(m_tensor_proto->raw_data().size() ==
+                                     shape_size(m_shape) * type.size(),
+                                 "Raw data size of tensor '",
+                                 m_tensor_proto->name(),
+                                 "' does not match its shape and type");
+                    return std::make_shared<ngraph::op::Constant>(
+                        type, m_shape, m_tensor_proto->raw_data().data());
+                }
                 switch (m_tensor_proto->data_type())
                 {
                 case onnx::TensorProto_DataType::TensorProto_DataType_BOOL:
@@ -462,6 +492,20 @@ namespace ngraph
             }
 
         private:
+            template <typename T>
+            std::vector<T> get_external_data() const
+            {
+                const element::Type& type = get_ng_type();
+                NGRAPH_CHECK(sizeof(T) == type.size(),
+                             "Cannot read external data of tensor '",
+                             m_tensor_proto->name(),
+                             "' as a different type");
+                auto buffer = detail::TensorExternalData{*m_tensor_proto}.load(
+                    shape_size(m_shape) * type.size());
+                const T* data = buffer->get_ptr<T>();
+                return std::vector<T>(data, data + shape_size(m_shape));
+            }
+
             template <typename T>
             std::shared_ptr<ngraph::op::Constant> make_ng_constant(const element::Type& type) const
             {
@@ -0,0 +1,256 @@
+//*****************************************************************************
+// Copyright 2017-2019 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#include <cstdint>
+#include <fstream>
+
+#ifndef _WIN32
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+#include "ngraph/file_util.hpp"
+#include "tensor_external_data.hpp"
+
+namespace ngraph
+{
+    namespace onnx_import
+    {
+        namespace detail
+        {
+            namespace
+            {
+                // Constants keep their data on this alignment, data at other offsets is copied
+                constexpr size_t data_alignment = 64;
+
+#ifndef _WIN32
+                /// \brief An AlignedBuffer backed by a private mapping of part of a file
+                class MappedFileBuffer : public runtime::AlignedBuffer
+                {
+                public:
+                    MappedFileBuffer(void* mapping,
+                                     size_t mapping_size,
+                                     size_t offset,
+                                     size_t byte_size)
+                        : m_mapping{mapping}
+                        , m_mapping_size{mapping_size}
+                    {
+                        m_aligned_buffer = static_cast<char*>(mapping) + offset;
+                        m_byte_size = byte_size;
+                    }
+
+                    ~MappedFileBuffer() { munmap(m_mapping, m_mapping_size); }
+                private:
+                    void* m_mapping;
+                    size_t m_mapping_size;
+                };
+
+                std::shared_ptr<runtime::AlignedBuffer>
+                    map_file(const std::string& path, size_t offset, size_t byte_size)
+                {
+                    int fd = open(path.c_str(), O_RDONLY);
+                    if (fd < 0)
+                    {
+                        throw error::tensor::invalid_external_data{"cannot open " + path};
+                    }
+                    struct stat info;
+                    if (fstat(fd, &info) != 0 ||
+                        offset + byte_size > static_cast<size_t>(info.st_size))
+                    {
+                        close(fd);
+                        throw error::tensor::invalid_external_data{
+                            path + " is smaller than offset " + std::to_string(offset) +
+                            " plus length " + std::to_string(byte_size)};
+                    }
+                    size_t page_size = static_cast<size_t>(sysconf(_SC_PAGESIZE));
+                    size_t map_offset = offset / page_size * page_size;
+                    size_t map_size = offset - map_offset + byte_size;
+                    // Writable but private: a Constant that modifies its data gets its own
+                    // copy of the pages, the file is never changed
+                    void* mapping = mmap(
+                        nullptr, map_size, PROT_READ | PROT_WRITE, MAP_PRIVATE, fd, map_offset);
+                    close(fd);
+                    std::shared_ptr<runtime::AlignedBuffer> rc;
+                    if (mapping != MAP_FAILED)
+                    {
+                        rc = std::make_shared<MappedFileBuffer>(
+                            mapping, map_size, offset - map_offset, byte_size);
+                    }
+                    return rc;
+                }
+#endif
+
+                std::shared_ptr<runtime::AlignedBuffer>
+                    read_file(const std::string& path, size_t offset, size_t byte_size)
+                {
+                    std::ifstream file{path, std::ios::in | std::ios::binary};
+                    if (!file.is_open())
+                    {
+                        throw error::tensor::invalid_external_data{"cannot open " + path};
+                    }
+                    auto rc = std::make_shared<runtime::AlignedBuffer>(byte_size, data_alignment);
+                    file.seekg(offset);
+                    file.read(rc->get_ptr<char>(), byte_size);
+                    if (!file)
+                    {
+                        throw error::tensor::invalid_external_data{
+                            "cannot read " + std::to_string(byte_size) + " bytes at offset " +
+                            std::to_string(offset) + " of " + path};
+                    }
+                    return rc;
+                }
+
+                /// \brief Rejects locations that are absolute or that lead out of the model
+                ///        directory, as the ONNX checker does
+                void check_location(const onnx::TensorProto& tensor, const std::string& location)
+                {
+                    if (!location.empty() &&
+                        (location[0] == '/' || location[0] == '\\' ||
+                         (location.size() > 1 && location[1] == ':')))
+                    {
+                        throw error::tensor::invalid_external_data{
+                            "location " + location + " of tensor '" + tensor.name() +
+                            "' is an absolute path"};
+                    }
+                    // Depth below the model directory after each component of the path
+                    std::int64_t depth = 0;
+                    std::size_t begin = 0;
+                    while (begin <= location.size())
+                    {
+                        std::size_t end = location.find_first_of("/\\", begin);
+                        if (end == std::string::npos)
+                        {
+                            end = location.size();
+                        }
+                        std::string component = location.substr(begin, end - begin);
+                        if (component == "..")
+                        {
+                            if (--depth < 0)
+                            {
+                                throw error::tensor::invalid_external_data{
+                                    "location " + location + " of tensor '" + tensor.name() +
+                                    "' is outside of the model directory"};
+                            }
+                        }
+                        else if (!component.empty() && component != ".")
+                        {
+                            depth++;
+                        }
+                        begin = end + 1;
+                    }
+                }
+
+                void update_external_data_path(onnx::TensorProto& tensor,
+                                               const std::string& model_directory)
+                {
+                    if (!TensorExternalData::is_external(tensor))
+                    {
+                        return;
+                    }
+                    for (auto& entry : *tensor.mutable_external_data())
+                    {
+                        if (entry.key() == "location")
+                        {
+                            check_location(tensor, entry.value());
+                            entry.set_value(file_util::path_join(model_directory, entry.value()));
+                        }
+                    }
+                }
+            }
+
+            TensorExternalData::TensorExternalData(const onnx::TensorProto& tensor)
+            {
+                for (const auto& entry : tensor.external_data())
+                {
+                    if (entry.key() == "location")
+                    {
+                        m_location = entry.value();
+                    }
+                    else if (entry.key() == "offset")
+                    {
+                        m_offset = std::stoull(entry.value());
+                    }
+                    else if (entry.key() == "length")
+                    {
+                        m_length = std::stoull(entry.value());
+                        m_has_length = true;
+                    }
+                    // The optional checksum is not verified
+                }
+                if (m_location.empty())
+                {
+                    throw error::tensor::invalid_external_data{"tensor '" + tensor.name() +
+                                                               "' has no location"};
+                }
+            }
+
+            bool TensorExternalData::is_external(const onnx::TensorProto& tensor)
+            {
+                return tensor.has_data_location() &&
+                       tensor.data_location() == onnx::TensorProto_DataLocation_EXTERNAL;
+            }
+
+            std::shared_ptr<runtime::AlignedBuffer>
+                TensorExternalData::load(size_t byte_size) const
+            {
+                if (m_has_length && m_length != byte_size)
+                {
+                    throw error::tensor::invalid_external_data{
+                        "length " + std::to_string(m_length) + " of " + m_location +
+                        " does not match the tensor size " + std::to_string(byte_size)};
+                }
+                std::shared_ptr<runtime::AlignedBuffer> rc;
+#ifndef _WIN32
+                if (byte_size > 0 && m_offset % data_alignment == 0)
+                {
+                    rc = map_file(m_location, m_offset, byte_size);
+                }
+#endif
+                if (!rc)
+                {
+                    rc = read_file(m_location, m_offset, byte_size);
+                }
+                return rc;
+            }
+
+            void update_external_data_paths(onnx::ModelProto& model_proto,
+                                            const std::string& model_directory)
+            {
+                onnx::GraphProto* graph = model_proto.mutable_graph();
+                for (auto& initializer : *graph->mutable_initializer())
+                {
+                    update_external_data_path(initializer, model_directory);
+                }
+                for (auto& node : *graph->mutable_node())
+                {
+                    for (auto& attribute : *node.mutable_attribute())
+                    {
+                        if (attribute.has_t())
+                        {
+                            update_external_data_path(*attribute.mutable_t(), model_directory);
+                        }
+                        for (auto& tensor : *attribute.mutable_tensors())
+                        {
+                            update_external_data_path(tensor, model_directory);
+                        }
+                    }
+                }
+            }
+        }
+    }
+}
@@ -0,0 +1,84 @@
+//*****************************************************************************
+// Copyright 2017-2019 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#pragma once
+
+#include <memory>
+#include <onnx/onnx_pb.h>
+#include <string>
+
+#include "ngraph/except.hpp"
+#include "ngraph/runtime/aligned_buffer.hpp"
+
+namespace ngraph
+{
+    namespace onnx_import
+    {
+        namespace error
+        {
+            namespace tensor
+            {
+                struct invalid_external_data : ngraph_error
+                {
+                    explicit invalid_external_data(const std::string& what)
+                        : ngraph_error{"invalid external data: " + what}
+                    {
+                    }
+                };
+            }
+        }
+
+        namespace detail
+        {
+            /// \brief Tensor data stored outside of the model file, following the ONNX external
+            ///        data convention: the `location`, `offset` and `length` entries of the
+            ///        tensor's external_data field.
+            class TensorExternalData
+            {
+            public:
+                explicit TensorExternalData(const onnx::TensorProto& tensor);
+
+                /// \return true if the data of the tensor is stored in an external file
+                static bool is_external(const onnx::TensorProto& tensor);
+
+                /// \brief Maps the data copy-on-write when the file and the offset allow it,
+                ///        otherwise reads it into a new buffer. Mapped pages are shared with the
+                ///        page cache and only loaded when they are used.
+                ///
+                /// \param byte_size The expected size of the data. A length entry, if present,
+                ///                  must match it.
+                std::shared_ptr<runtime::AlignedBuffer> load(size_t byte_size) const;
+
+                const std::string& get_location() const { return m_location; }
+                size_t get_offset() const { return m_offset; }
+
+            private:
+                std::string m_location;
+                size_t m_offset = 0;
+                size_t m_length = 0;
+                bool m_has_length = false;
+            };
+
+            /// \brief Makes the relative locations of the external data in a model relative to
+            ///        the directory of the model file instead of the working directory.
+            ///
+            /// \throws error::tensor::invalid_external_data if a location is absolute or
+            ///         leads out of the model directory
+            void update_external_data_paths(onnx::ModelProto& model_proto,
+                                            const std::string& model_directory);
+        }
+    }
+}
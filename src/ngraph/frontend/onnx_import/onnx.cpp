@@ -21,7 +21,9 @@
 
 #include "core/graph.hpp"
 #include "core/model.hpp"
+#include "core/tensor_external_data.hpp"
 #include "ngraph/except.hpp"
+#include "ngraph/file_util.hpp"
 #include "onnx.hpp"
 #include "ops_bridge.hpp"
 
@@ -50,34 +52,61 @@ namespace ngraph
                 };
 
             } // namespace error
-        }     // namespace detail
 
-        std::shared_ptr<Function> import_onnx_model(std::istream& sin, const Weights& weights)
-        {
-            onnx::ModelProto model_proto;
-            // Try parsing input as a binary protobuf message
-            if (!model_proto.ParseFromIstream(&sin))
+            void parse_model(std::istream& sin, onnx::ModelProto& model_proto)
             {
-                // Rewind to the beginning and clear stream state.
-                sin.clear();
-                sin.seekg(0);
-                google::protobuf::io::IstreamInputStream iistream(&sin);
-                // Try parsing input as a prototxt message
-                if (!google::protobuf::TextFormat::Parse(&iistream, &model_proto))
+                // Try parsing input as a binary protobuf message
+                if (!model_proto.ParseFromIstream(&sin))
                 {
-                    throw detail::error::stream_parse{sin};
+                    // Rewind to the beginning and clear stream state.
+                    sin.clear();
+                    sin.seekg(0);
+                    google::protobuf::io::IstreamInputStream iistream(&sin);
+                    // Try parsing input as a prototxt message
+                    if (!google::protobuf::TextFormat::Parse(&iistream, &model_proto))
+                    {
+                        throw detail::error::stream_parse{sin};
+                    }
                 }
             }
 
-            Model model{model_proto};
-            Graph graph{model_proto.graph(), model, weights};
-            auto function = std::make_shared<Function>(
-                graph.get_ng_outputs(), graph.get_ng_parameters(), graph.get_name());
-            for (std::size_t i{0}; i < function->get_output_size(); ++i)
+            std::shared_ptr<Function> convert_model(const onnx::ModelProto& model_proto,
+                                                    const Weights& weights)
             {
-                function->get_output_op(i)->set_friendly_name(graph.get_outputs().at(i).get_name());
+                // Nodes are validated once, when the function is constructed. Only a sequential
+                // import defers: the worker threads of a parallel import could validate a node
+                // they share on demand at the same time.
+                DeferredValidation deferred(get_import_thread_count() <= 1);
+                Model model{model_proto};
+                Graph graph{model_proto.graph(), model, weights};
+                auto function = std::make_shared<Function>(
+                    graph.get_ng_outputs(), graph.get_ng_parameters(), graph.get_name());
+                // ONNX nodes whose outputs the graph does not use are not part of the function,
+                // validate them so an invalid model fails as it does without deferral. Dead
+                // nodes created internally by an operator are dropped with the graph unvalidated.
+                for (const auto& node : graph.get_nodes())
+                {
+                    for (std::size_t i{0}; i < node.get_outputs_size(); ++i)
+                    {
+                        graph.get_ng_node_from_cache(node.output(i))->validate_if_deferred();
+                    }
+                }
+                for (std::size_t i{0}; i < function->get_output_size(); ++i)
+                {
+                    function->get_output_op(i)->set_friendly_name(
+                        graph.get_outputs().at(i).get_name());
+                }
+                return function;
             }
-            return function;
+        } // namespace detail
+
+        std::shared_ptr<Function> import_onnx_model(std::istream& sin, const Weights& weights)
+        {
+            onnx::ModelProto model_proto;
+            detail::parse_model(sin, model_proto);
+            // External data of a model read from a stream is relative to the working directory
+            detail::update_external_data_paths(model_proto, "");
+            return detail::convert_model(model_proto, weights);
         }
 
         std::shared_ptr<Function> import_onnx_model(const std::string& path, const Weights& weights)
@@ -87,7 +116,13 @@ namespace ngraph
             {
                 throw detail::error::file_open{path};
             }
-            return import_onnx_model(ifs, weights);
+            onnx::ModelProto model_proto;
+            detail::parse_model(ifs, model_proto);
+            // get_directory returns a bare file name unchanged
+            std::string model_directory =
+                path.find('/') == std::string::npos ? "" : file_util::get_directory(path);
+            detail::update_external_data_paths(model_proto, model_directory);
+            return detail::convert_model(model_proto, weights);
         }
 
         void register_operator(const std::string& name,
@@ -67,6 +67,20 @@ namespace ngraph
                                    std::int64_t version,
                                    const std::string& domain = "ai.onnx");
 
+        /// \brief Sets the number of threads used to import the nodes of a graph.
+        ///
+        /// Parallel import is opt-in. By default a graph is imported on the calling thread.
+        ///
+        /// \param thread_count  1 imports on the calling thread only, 0 restores the default:
+        ///                      the NGRAPH_ONNX_IMPORT_THREADS environment variable if set,
+        ///                      otherwise 1.
+        NGRAPH_API
+        void set_import_thread_count(std::size_t thread_count);
+
+        /// \return The number of threads used to import the nodes of a graph.
+        NGRAPH_API
+        std::size_t get_import_thread_count();
+
         /// \brief Convert an ONNX model to nGraph function
         /// The function translated serialized ONNX model to nGraph function. The serialized
         /// ONNX model is read from input stream.
@@ -76,6 +90,8 @@ namespace ngraph
         ///                   and providing through this parameters is invalid (the weights from
         ///                   the model  will take precedence).
         /// \return The function returns a nGraph function representing single output from graph.
+        /// \note Relative locations of tensors stored in external data files are resolved
+        ///       against the current working directory.
         NGRAPH_API
         std::shared_ptr<Function> import_onnx_model(std::istream& sin, const Weights& weights = {});
 
@@ -88,6 +104,9 @@ namespace ngraph
         ///                   and providing through this parameters is invalid (the weights from
         ///                   the model  will take precedence).
         /// \return The function returns a nGraph function representing single output from graph.
+        /// \note Relative locations of tensors stored in external data files are resolved
+        ///       against the directory of the model file. Such files are mapped into memory
+        ///       where possible, so the Constants share their pages instead of copying them.
         NGRAPH_API
         std::shared_ptr<Function> import_onnx_model(const std::string& filename,
                                                     const Weights& weights = {});
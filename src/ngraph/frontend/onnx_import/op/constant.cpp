@@ -33,8 +33,12 @@ namespace ngraph
                     inline std::shared_ptr<default_opset::Constant>
                         __make_ng_constant(const element::Type& type, const Tensor& tensor)
                     {
-                        return std::make_shared<default_opset::Constant>(
-                            type, tensor.get_shape(), tensor.get_data<T>());
+                        // Raw and external data are used as is instead of being read
+                        // into a std::vector<T> first
+                        std::shared_ptr<default_opset::Constant> constant =
+                            tensor.get_ng_constant();
+                        NGRAPH_CHECK(constant->get_element_type() == type);
+                        return constant;
                     }
 
                     template <Tensor::Type>
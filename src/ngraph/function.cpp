@@ -80,7 +80,17 @@ void Function::validate_nodes_and_infer_types()
 
 void Function::init()
 {
-    validate_nodes_and_infer_types();
+    if (DeferredValidation::is_active())
+    {
+        for (auto& node : get_ops())
+        {
+            node->validate_if_deferred();
+        }
+    }
+    else
+    {
+        validate_nodes_and_infer_types();
+    }
 
     traverse_nodes(this,
                    [&](shared_ptr<Node> node) {
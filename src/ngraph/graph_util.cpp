@@ -14,6 +14,7 @@
 // limitations under the License.
 //*****************************************************************************
 
+#include <deque>
 #include <numeric>
 #include <unordered_map>
 #include <unordered_set>
@@ -343,7 +344,8 @@ std::shared_ptr<ngraph::Function> ngraph::clone_function(const ngraph::Function&
         cloned_params.push_back(as_type_ptr<op::Parameter>(node_map.at(param.get())));
     }
 
-    // create and return cloned function
+    // create and return cloned function, the clones were validated as they were made
+    DeferredValidation skip_unchanged;
     return std::make_shared<ngraph::Function>(cloned_results, cloned_params);
 }
 
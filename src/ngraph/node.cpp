@@ -193,13 +193,25 @@ void Node::set_arguments(const NodeVector& arguments)
 void Node::set_arguments(const OutputVector& arguments)
 {
     // Add this node as a user of each argument.
+    m_inputs.reserve(m_inputs.size() + arguments.size());
     size_t i = 0;
     for (auto& output : arguments)
     {
         auto output_node = output.get_node();
+        if (output.get_index() >= output_node->m_outputs.size())
+        {
+            // Some nodes only create their outputs when they are validated
+            output_node->validate_if_deferred();
+        }
         auto& output_descriptor = output_node->get_outputs().at(output.get_index());
         m_inputs.emplace_back(this, i++, output_descriptor);
     }
+    // Also defers the nodes whose constructors leave validation to their Function, like
+    // TensorIterator, which would otherwise not be validated at all
+    if (DeferredValidation::is_active() && !arguments.empty())
+    {
+        m_validation_deferred = true;
+    }
 }
 
 descriptor::Input& Node::get_input_descriptor(size_t position)
@@ -238,7 +250,15 @@ void Node::set_argument(size_t position, const Output<Node>& argument)
 void Node::constructor_validate_and_infer_types()
 {
 #ifdef IN_TRANSITION
-    validate_and_infer_types();
+    // Nodes without inputs, such as Parameter and Constant, have nothing to wait for
+    if (DeferredValidation::is_active() && get_input_size() > 0)
+    {
+        m_validation_deferred = true;
+    }
+    else
+    {
+        validate_and_infer_types();
+    }
 #endif
 }
 
@@ -250,9 +270,56 @@ void Node::delayed_validate_and_infer_types()
 }
 #undef IN_TRANSITION
 
+void Node::validate_deferred() const
+{
+    // Walk the deferred inputs without recursion, the chain may be as deep as the graph
+    DeferredValidation validate_constructors(false);
+    vector<pair<Node*, size_t>> stack{{const_cast<Node*>(this), 0}};
+    while (!stack.empty())
+    {
+        Node* node = stack.back().first;
+        size_t input = stack.back().second++;
+        if (input < node->m_inputs.size())
+        {
+            Node* arg = node->m_inputs[input].get_output().get_raw_pointer_node();
+            if (arg->m_validation_deferred)
+            {
+                stack.push_back({arg, 0});
+            }
+        }
+        else
+        {
+            if (node->m_validation_deferred)
+            {
+                node->revalidate_and_infer_types();
+            }
+            stack.pop_back();
+        }
+    }
+}
+
+static thread_local size_t s_deferred_validation_depth = 0;
+
+DeferredValidation::DeferredValidation(bool defer)
+    : m_saved_depth(s_deferred_validation_depth)
+{
+    s_deferred_validation_depth = defer ? m_saved_depth + 1 : 0;
+}
+
+DeferredValidation::~DeferredValidation()
+{
+    s_deferred_validation_depth = m_saved_depth;
+}
+
+bool DeferredValidation::is_active()
+{
+    return s_deferred_validation_depth > 0;
+}
+
 void Node::set_output_size(size_t n)
 {
     NGRAPH_CHECK(n >= m_outputs.size(), "shrinking ", m_outputs.size(), " to ", n);
+    m_outputs.reserve(n);
     for (size_t i = m_outputs.size(); i < n; ++i)
     {
         // create the descriptors
@@ -287,12 +354,12 @@ void Node::set_output_type(size_t i, const element::Type& element_type, const Pa
     get_output_descriptor(i).get_tensor_ptr()->set_tensor_type(element_type, pshape);
 }
 
-std::deque<descriptor::Output>& Node::get_outputs()
+std::vector<descriptor::Output>& Node::get_outputs()
 {
     return m_outputs;
 }
 
-const std::deque<descriptor::Output>& Node::get_outputs() const
+const std::vector<descriptor::Output>& Node::get_outputs() const
 {
     return m_outputs;
 }
@@ -362,14 +429,32 @@ void Node::set_placement_index(size_t placement)
     m_placement_index = placement;
 }
 
+Node::Extras& Node::get_extras()
+{
+    if (!m_extras)
+    {
+        m_extras.reset(new Extras());
+    }
+    return *m_extras;
+}
+
+const Node::RTMap& Node::get_rt_info() const
+{
+    static const RTMap empty;
+    return m_extras ? m_extras->rt_info : empty;
+}
+
 void Node::add_provenance_group_member(const shared_ptr<Node>& node)
 {
-    m_provenance_group.insert(node);
+    get_extras().provenance_group.insert(node);
 }
 
 void Node::remove_provenance_group_member(const shared_ptr<Node>& node)
 {
-    m_provenance_group.erase(node);
+    if (m_extras)
+    {
+        m_extras->provenance_group.erase(node);
+    }
 }
 
 void Node::replace_provenance_group_member(const shared_ptr<Node>& current_node,
@@ -388,7 +473,8 @@ void Node::replace_provenance_group_member(const shared_ptr<Node>& current_node,
 
 const set<shared_ptr<Node>>& Node::get_provenance_group_members() const
 {
-    return m_provenance_group;
+    static const set<shared_ptr<Node>> empty;
+    return m_extras ? m_extras->provenance_group : empty;
 }
 
 shared_ptr<Node> Node::add_provenance_group_members_above(const OutputVector& base)
@@ -420,7 +506,7 @@ shared_ptr<Node> Node::add_provenance_group_members_above(const OutputVector& ba
         add_provenance_group_member(node->shared_from_this());
         for (auto value : node->input_values())
         {
-            if (m_provenance_group.count(value.get_node_shared_ptr()) == 0)
+            if (m_extras->provenance_group.count(value.get_node_shared_ptr()) == 0)
             {
                 todo.push_back(value.get_node());
             }
@@ -458,13 +544,15 @@ void Node::add_provenance_tags_above(const OutputVector& base,
 
 const std::unordered_set<std::string>& Node::get_provenance_tags() const
 {
-    return m_provenance_tags;
+    static const unordered_set<string> empty;
+    return m_extras ? m_extras->provenance_tags : empty;
 }
 
 void Node::add_provenance_tag(const std::string& tag)
 {
-    m_provenance_tags.insert(tag);
-    for (auto node : m_provenance_group)
+    Extras& extras = get_extras();
+    extras.provenance_tags.insert(tag);
+    for (auto node : extras.provenance_group)
     {
         node->add_provenance_tag(tag);
     }
@@ -472,7 +560,10 @@ void Node::add_provenance_tag(const std::string& tag)
 
 void Node::remove_provenance_tag(const std::string& tag)
 {
-    m_provenance_tags.erase(tag);
+    if (m_extras)
+    {
+        m_extras->provenance_tags.erase(tag);
+    }
 }
 
 void Node::merge_provenance_tags_from(const std::shared_ptr<const Node>& source)
@@ -638,11 +729,13 @@ std::ostream& Node::write_long_description(std::ostream& out) const
 
 size_t Node::get_output_size() const
 {
+    validate_if_deferred();
     return m_outputs.size();
 }
 
 const element::Type& Node::get_output_element_type(size_t i) const
 {
+    validate_if_deferred();
     NGRAPH_CHECK(
         i < m_outputs.size(), "index '", i, "' out of range in get_output_element_type(size_t i)");
     return m_outputs[i].get_element_type();
@@ -659,6 +752,7 @@ const element::Type& Node::get_element_type() const
 
 const Shape& Node::get_output_shape(size_t i) const
 {
+    validate_if_deferred();
     NGRAPH_CHECK(
         i < m_outputs.size(), "index '", i, "' out of range in get_output_shape(size_t i)");
     return m_outputs[i].get_shape();
@@ -666,6 +760,7 @@ const Shape& Node::get_output_shape(size_t i) const
 
 const PartialShape& Node::get_output_partial_shape(size_t i) const
 {
+    validate_if_deferred();
     NGRAPH_CHECK(
         i < m_outputs.size(), "index '", i, "' out of range in get_output_partial_shape(size_t i)");
     return m_outputs[i].get_partial_shape();
@@ -685,6 +780,7 @@ const Shape& Node::get_shape() const
 
 shared_ptr<descriptor::Tensor> Node::get_output_tensor_ptr(size_t i) const
 {
+    validate_if_deferred();
     NGRAPH_CHECK(
         i < m_outputs.size(), "index '", i, "' out of range in get_output_tensor_ptr(size_t i)");
     return m_outputs[i].get_tensor_ptr();
@@ -709,6 +805,7 @@ const std::vector<descriptor::Input*>& Node::get_output_inputs(size_t i) const
 
 descriptor::Tensor& Node::get_output_tensor(size_t i) const
 {
+    validate_if_deferred();
     NGRAPH_CHECK(
         i < m_outputs.size(), "index '", i, "' out of range in get_output_tensor(size_t i)");
     return m_outputs[i].get_tensor();
@@ -739,12 +836,14 @@ const element::Type& Node::get_input_element_type(size_t i) const
 {
     NGRAPH_CHECK(
         i < m_inputs.size(), "index '", i, "' out of range in get_input_element_type(size_t i)");
+    m_inputs[i].get_output().get_raw_pointer_node()->validate_if_deferred();
     return m_inputs[i].get_element_type();
 }
 
 const Shape& Node::get_input_shape(size_t i) const
 {
     NGRAPH_CHECK(i < m_inputs.size(), "index '", i, "' out of range in get_input_shape(size_t i)");
+    m_inputs[i].get_output().get_raw_pointer_node()->validate_if_deferred();
     return m_inputs[i].get_shape();
 }
 
@@ -752,6 +851,7 @@ const PartialShape& Node::get_input_partial_shape(size_t i) const
 {
     NGRAPH_CHECK(
         i < m_inputs.size(), "index '", i, "' out of range in get_input_partial_shape(size_t i)");
+    m_inputs[i].get_output().get_raw_pointer_node()->validate_if_deferred();
     return m_inputs[i].get_partial_shape();
 }
 
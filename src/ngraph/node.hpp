@@ -18,7 +18,6 @@
 
 #include <atomic>
 #include <cstring>
-#include <deque>
 #include <iostream>
 #include <memory>
 #include <set>
@@ -191,7 +190,23 @@ namespace ngraph
         /// Sets the number of outputs
         void set_output_size(size_t output_size);
 
-        void revalidate_and_infer_types() { validate_and_infer_types(); }
+        void revalidate_and_infer_types()
+        {
+            m_validation_deferred = false;
+            validate_and_infer_types();
+        }
+        /// \returns true if the node was constructed in a DeferredValidation scope and has not
+        ///          been validated since
+        bool is_validation_deferred() const { return m_validation_deferred; }
+        /// \brief Validates the node if its validation was deferred, after the deferred nodes
+        ///        it depends on. Nodes that were already validated are skipped.
+        void validate_if_deferred() const
+        {
+            if (m_validation_deferred)
+            {
+                validate_deferred();
+            }
+        }
         // Called after transition
         void delayed_validate_and_infer_types();
 
@@ -262,21 +277,39 @@ namespace ngraph
         virtual bool is_dynamic() const;
         virtual bool has_state() const { return false; }
         size_t get_instance_id() const { return m_instance_id; }
+        /// \return The instance id the next constructed Node will receive. The difference
+        ///         between two calls is the number of Nodes constructed in between.
+        static size_t get_next_instance_id() { return m_next_instance_id.load(); }
+        /// \brief Reserves count consecutive instance ids that no constructed Node will receive.
+        /// \return The first reserved id
+        static size_t reserve_instance_ids(size_t count)
+        {
+            return m_next_instance_id.fetch_add(count);
+        }
+        /// \brief Gives the node a reserved instance id. Nodes that are constructed on several
+        ///        threads are renumbered with this so their ids and names do not depend on the
+        ///        thread schedule. Names of output tensors that were already read keep the
+        ///        old id.
+        void set_instance_id(size_t id)
+        {
+            m_instance_id = id;
+            m_unique_name.clear();
+        }
         friend NGRAPH_API std::ostream& operator<<(std::ostream&, const Node&);
         virtual std::ostream& write_short_description(std::ostream&) const;
         virtual std::ostream& write_long_description(std::ostream&) const;
 
-        std::deque<descriptor::Input>& get_inputs() NGRAPH_DEPRECATED("use inputs() instead")
+        std::vector<descriptor::Input>& get_inputs() NGRAPH_DEPRECATED("use inputs() instead")
         {
             return m_inputs;
         }
-        const std::deque<descriptor::Input>& get_inputs() const
+        const std::vector<descriptor::Input>& get_inputs() const
             NGRAPH_DEPRECATED("use inputs() instead")
         {
             return m_inputs;
         }
-        std::deque<descriptor::Output>& get_outputs() NGRAPH_DEPRECATED("use outputs() instead");
-        const std::deque<descriptor::Output>& get_outputs() const
+        std::vector<descriptor::Output>& get_outputs() NGRAPH_DEPRECATED("use outputs() instead");
+        const std::vector<descriptor::Output>& get_outputs() const
             NGRAPH_DEPRECATED("use outputs() instead");
 
         /// Get control dependencies registered on the node
@@ -413,8 +446,8 @@ namespace ngraph
 
         using RTMap = std::map<std::string, std::shared_ptr<Variant>>;
 
-        RTMap& get_rt_info() { return m_rt_info; }
-        const RTMap& get_rt_info() const { return m_rt_info; }
+        RTMap& get_rt_info() { return get_extras().rt_info; }
+        const RTMap& get_rt_info() const;
         const std::unordered_set<std::string>& get_provenance_tags() const;
         void add_provenance_tag(const std::string& tag);
         template <typename T>
@@ -501,6 +534,16 @@ namespace ngraph
         }
 
     private:
+        /// State most nodes never use, allocated on first use to keep nodes small
+        struct Extras
+        {
+            std::unordered_set<std::string> provenance_tags;
+            std::set<std::shared_ptr<Node>> provenance_group;
+            RTMap rt_info;
+        };
+
+        Extras& get_extras();
+        void validate_deferred() const;
         descriptor::Input& get_input_descriptor(size_t position);
         descriptor::Output& get_output_descriptor(size_t position);
 
@@ -511,19 +554,47 @@ namespace ngraph
         std::string m_friendly_name;
         std::string m_unique_name;
         static std::atomic<size_t> m_next_instance_id;
-        std::unordered_set<std::string> m_provenance_tags;
-        std::set<std::shared_ptr<Node>> m_provenance_group;
-        std::deque<descriptor::Input> m_inputs;
-        std::deque<descriptor::Output> m_outputs;
-        std::unordered_map<Node*, autodiff::Adjoints> m_adjoint_map;
+        // Descriptors refer to each other by address. Input and Output move constructors
+        // update those references when the vectors reallocate.
+        std::vector<descriptor::Input> m_inputs;
+        std::vector<descriptor::Output> m_outputs;
         Placement m_placement = Placement::DEFAULT;
+        // Fits in the padding after m_placement
+        bool m_validation_deferred{false};
         size_t m_placement_index = placement_invalid;
         std::shared_ptr<ngraph::op::util::OpAnnotations> m_op_annotations;
-        std::map<std::string, std::shared_ptr<Variant>> m_rt_info;
+        std::unique_ptr<Extras> m_extras;
     };
 
     using NodeTypeInfo = Node::type_info_t;
 
+    /// \brief While an instance exists, nodes with inputs constructed on this thread skip
+    ///        validation and type inference in their constructors. Scopes may be nested.
+    ///
+    /// Constructing a Function from the deferred nodes in a scope validates each of them once,
+    /// after their arguments, and skips the sort and revalidation of the whole graph that
+    /// Function otherwise does. Nodes that are not deferred are assumed to be valid. A deferred
+    /// node whose outputs are read earlier, for example by a constructor that inspects its
+    /// arguments, is validated on demand, as is one passed to Node::validate_if_deferred.
+    /// Deferred nodes that no Function reaches are not validated when the scope ends, an
+    /// invalid one only fails once it is used.
+    class NGRAPH_API DeferredValidation
+    {
+    public:
+        /// \param defer false to make constructors validate again until the instance is
+        ///        destroyed, as needed while a deferred graph is being validated
+        DeferredValidation(bool defer = true);
+        ~DeferredValidation();
+        DeferredValidation(const DeferredValidation&) = delete;
+        DeferredValidation& operator=(const DeferredValidation&) = delete;
+
+        /// \returns true if constructors on this thread currently defer validation
+        static bool is_active();
+
+    private:
+        size_t m_saved_depth;
+    };
+
     template <typename NodeType>
     class Input
     {
@@ -914,6 +985,10 @@ namespace ngraph
 
     inline Output<Node> Node::output(size_t output_index)
     {
+        if (output_index >= m_outputs.size())
+        {
+            validate_if_deferred();
+        }
         if (output_index >= m_outputs.size())
         {
             throw std::out_of_range("node output index is out of range");
@@ -924,6 +999,10 @@ namespace ngraph
 
     inline Output<const Node> Node::output(size_t output_index) const
     {
+        if (output_index >= m_outputs.size())
+        {
+            validate_if_deferred();
+        }
         if (output_index >= m_outputs.size())
         {
             throw std::out_of_range("node output index is out of range");
@@ -17,8 +17,10 @@
 #include <cmath>
 #include <cstdio>
 
+#include "ngraph/check.hpp"
 #include "ngraph/log.hpp"
 #include "ngraph/op/constant.hpp"
+#include "ngraph/runtime/constant_store.hpp"
 #include "ngraph/util.hpp"
 
 using namespace ngraph;
@@ -47,10 +49,42 @@ string to_cpp_string(T value)
 
 constexpr NodeTypeInfo op::Constant::type_info;
 
+op::Constant::Constant(const element::Type& type,
+                       const Shape& shape,
+                       const shared_ptr<runtime::ConstantLoader>& loader)
+    : m_element_type(type)
+    , m_shape(shape)
+    , m_data(nullptr)
+    , m_loader(loader)
+    , m_loaded(false)
+{
+    NGRAPH_CHECK(m_loader && m_loader->get_size() >= get_data_size(),
+                 "Constant loader is smaller than the constant data");
+    constructor_validate_and_infer_types();
+}
+
 op::Constant::~Constant()
 {
 }
 
+void op::Constant::load_data() const
+{
+    lock_guard<mutex> lock(m_load_mutex);
+    if (m_loaded.load(memory_order_relaxed))
+    {
+        return;
+    }
+    m_data = m_loader->get_data();
+    runtime::ConstantStore& store = runtime::ConstantStore::get();
+    size_t size = get_data_size();
+    if (store.is_enabled() && size > 0)
+    {
+        m_data = store.intern(m_data, size);
+    }
+    m_all_elements_bitwise_identical = are_all_data_elements_bitwise_identical();
+    m_loaded.store(true, memory_order_release);
+}
+
 string op::Constant::convert_value_to_string(size_t index) const
 {
     string rc;
@@ -264,17 +298,62 @@ AxisSet op::Constant::get_axis_set_val() const
 shared_ptr<Node> op::Constant::copy_with_new_args(const NodeVector& new_args) const
 {
     check_new_args_count(this, new_args);
-    return make_shared<Constant>(m_element_type, m_shape, m_data->get_ptr());
+    if (!is_loaded())
+    {
+        return make_shared<Constant>(m_element_type, m_shape, m_loader);
+    }
+    return make_shared<Constant>(m_element_type, m_shape, m_data);
+}
+
+void* op::Constant::get_data_ptr_nc()
+{
+    ensure_loaded();
+    if (m_data && (!m_data_private || m_data.use_count() > 1))
+    {
+        size_t size = get_data_size();
+        auto data = make_shared<runtime::AlignedBuffer>(size, host_alignment());
+        std::memcpy(data->get_ptr(), m_data->get_ptr(), size);
+        m_data = data;
+        m_data_private = true;
+    }
+    return (m_data ? m_data->get_ptr() : nullptr);
+}
+
+void op::Constant::share_data()
+{
+    runtime::ConstantStore& store = runtime::ConstantStore::get();
+    size_t size = get_data_size();
+    if (store.is_enabled() && m_data && size > 0)
+    {
+        m_data = store.intern(m_data, size);
+        m_data_private = false;
+    }
+}
+
+void op::Constant::copy_data(const void* data)
+{
+    runtime::ConstantStore& store = runtime::ConstantStore::get();
+    size_t size = get_data_size();
+    if (store.is_enabled() && size > 0)
+    {
+        m_data = store.intern(data, size);
+        m_data_private = false;
+    }
+    else
+    {
+        m_data = make_shared<runtime::AlignedBuffer>(size, host_alignment());
+        std::memcpy(m_data->get_ptr(), data, size);
+        m_data_private = true;
+    }
 }
 
 template <typename T>
-static bool test_bitwise_identical(const op::Constant* constant)
+static bool test_bitwise_identical(const void* constant_data, size_t size)
 {
-    const size_t size = shape_size(constant->get_shape());
     bool data_is_constant = true;
     if (size > 0)
     {
-        const T* data = constant->get_data_ptr<T>();
+        const T* data = static_cast<const T*>(constant_data);
         const T compare = data[0];
         for (size_t i = 1; i < size; i++)
         {
@@ -290,6 +369,9 @@ static bool test_bitwise_identical(const op::Constant* constant)
 
 bool op::Constant::are_all_data_elements_bitwise_identical() const
 {
+    // Reads m_data directly, as it is called while a lazy Constant is being loaded
+    const void* data = m_data ? m_data->get_ptr() : nullptr;
+    const size_t size = shape_size(m_shape);
     bool rc = false;
 #if defined(__GNUC__) && !(__GNUC__ == 4 && __GNUC_MINOR__ == 8)
 #pragma GCC diagnostic push
@@ -302,7 +384,7 @@ bool op::Constant::are_all_data_elements_bitwise_identical() const
     case element::Type_t::i8:
     case element::Type_t::u8:
     {
-        rc = test_bitwise_identical<uint8_t>(this);
+        rc = test_bitwise_identical<uint8_t>(data, size);
         break;
     }
     case element::Type_t::bf16:
@@ -310,21 +392,21 @@ bool op::Constant::are_all_data_elements_bitwise_identical() const
     case element::Type_t::i16:
     case element::Type_t::u16:
     {
-        rc = test_bitwise_identical<uint16_t>(this);
+        rc = test_bitwise_identical<uint16_t>(data, size);
         break;
     }
     case element::Type_t::f32:
     case element::Type_t::i32:
     case element::Type_t::u32:
     {
-        rc = test_bitwise_identical<uint32_t>(this);
+        rc = test_bitwise_identical<uint32_t>(data, size);
         break;
     }
     case element::Type_t::f64:
     case element::Type_t::i64:
     case element::Type_t::u64:
     {
-        rc = test_bitwise_identical<uint64_t>(this);
+        rc = test_bitwise_identical<uint64_t>(data, size);
         break;
     }
     case element::Type_t::u1:
@@ -341,7 +423,7 @@ constexpr NodeTypeInfo op::ScalarConstantLike::type_info;
 
 shared_ptr<op::Constant> op::ScalarConstantLikeBase::as_constant() const
 {
-    return std::make_shared<op::Constant>(m_element_type, m_shape, m_data->get_ptr());
+    return std::make_shared<op::Constant>(m_element_type, m_shape, m_data);
 }
 
 std::shared_ptr<Node> op::ScalarConstantLike::copy_with_new_args(const NodeVector& new_args) const
@@ -355,6 +437,7 @@ void op::ScalarConstantLike::infer_element_type()
     if (nullptr == m_data)
     {
         m_data.reset(new runtime::AlignedBuffer(m_element_type.size(), m_element_type.size()));
+        m_data_private = true;
         write_values(std::vector<double>(1, m_value));
     }
 }
@@ -16,13 +16,16 @@
 
 #pragma once
 
+#include <atomic>
 #include <cmath>
 #include <cstring>
+#include <mutex>
 #include <sstream>
 
 #include "ngraph/coordinate_diff.hpp"
 #include "ngraph/node.hpp"
 #include "ngraph/runtime/aligned_buffer.hpp"
+#include "ngraph/runtime/constant_loader.hpp"
 #include "ngraph/type/element_type.hpp"
 #include "ngraph/util.hpp"
 
@@ -50,6 +53,7 @@ namespace ngraph
                 , m_data(new runtime::AlignedBuffer(
                       std::ceil(shape_size(m_shape) * m_element_type.bitwidth() / 8.f),
                       host_alignment()))
+                , m_data_private(true)
             {
                 NODE_VALIDATION_CHECK(
                     this,
@@ -71,6 +75,7 @@ namespace ngraph
                 {
                     write_values(values);
                 }
+                share_data();
                 constructor_validate_and_infer_types();
                 m_all_elements_bitwise_identical = are_all_data_elements_bitwise_identical();
             }
@@ -87,6 +92,7 @@ namespace ngraph
                 , m_data(new runtime::AlignedBuffer(
                       std::ceil(shape_size(m_shape) * m_element_type.bitwidth() / 8.f),
                       host_alignment()))
+                , m_data_private(true)
             {
                 NODE_VALIDATION_CHECK(
                     this,
@@ -131,6 +137,7 @@ namespace ngraph
                         write_values(dvalues);
                     }
                 }
+                share_data();
                 constructor_validate_and_infer_types();
                 m_all_elements_bitwise_identical = are_all_data_elements_bitwise_identical();
             }
@@ -146,13 +153,40 @@ namespace ngraph
                 , m_shape(shape)
                 , m_data(nullptr)
             {
-                size_t size = std::ceil(shape_size(m_shape) * m_element_type.bitwidth() / 8.f);
-                m_data.reset(new runtime::AlignedBuffer(size, host_alignment()));
-                std::memcpy(m_data->get_ptr(), data, size);
+                copy_data(data);
                 constructor_validate_and_infer_types();
                 m_all_elements_bitwise_identical = are_all_data_elements_bitwise_identical();
             }
 
+            /// \brief Constructs a tensor constant that shares data with other Constants. The
+            ///        buffer is copied before it is first modified through this Constant.
+            ///
+            /// \param type The element type of the tensor constant.
+            /// \param shape The shape of the tensor constant.
+            /// \param data A buffer holding at least the constant's data.
+            Constant(const element::Type& type,
+                     const Shape& shape,
+                     const std::shared_ptr<runtime::AlignedBuffer>& data)
+                : m_element_type(type)
+                , m_shape(shape)
+                , m_data(data)
+            {
+                NGRAPH_CHECK(m_data && m_data->size() >= get_data_size(),
+                             "Constant buffer is smaller than the constant data");
+                constructor_validate_and_infer_types();
+                m_all_elements_bitwise_identical = are_all_data_elements_bitwise_identical();
+            }
+
+            /// \brief Constructs a tensor constant whose data is only loaded when it is first
+            ///        used. Clones share the loader and the loaded data.
+            ///
+            /// \param type The element type of the tensor constant.
+            /// \param shape The shape of the tensor constant.
+            /// \param loader The source of at least the constant's data.
+            Constant(const element::Type& type,
+                     const Shape& shape,
+                     const std::shared_ptr<runtime::ConstantLoader>& loader);
+
             virtual ~Constant() override;
 
             void validate_and_infer_types() override
@@ -234,7 +268,7 @@ namespace ngraph
                 }
 
                 std::vector<T> rc;
-                const T* p = reinterpret_cast<const T*>(m_data->get_ptr());
+                const T* p = get_data_ptr<T>();
                 for (size_t i = 0; i < shape_size(m_shape); i++)
                 {
                     rc.push_back(p[i]);
@@ -323,7 +357,11 @@ namespace ngraph
                 }
             }
 
-            const void* get_data_ptr() const { return (m_data ? m_data->get_ptr() : nullptr); }
+            const void* get_data_ptr() const
+            {
+                ensure_loaded();
+                return (m_data ? m_data->get_ptr() : nullptr);
+            }
             template <typename T>
             const T* get_data_ptr() const
             {
@@ -333,12 +371,18 @@ namespace ngraph
             bool is_constant() const override { return true; }
             bool get_all_data_elements_bitwise_identical() const
             {
+                ensure_loaded();
                 return m_all_elements_bitwise_identical;
             }
+            /// \return false if the data of a lazy Constant has not been loaded yet
+            bool is_loaded() const { return m_loaded.load(std::memory_order_acquire); }
             std::string convert_value_to_string(size_t index) const;
 
         protected:
-            void* get_data_ptr_nc() { return (m_data ? m_data->get_ptr() : nullptr); }
+            /// \brief Returns a pointer for writing the data, first copying the buffer unless it
+            ///        was allocated by this Constant and is not shared. Buffers from the
+            ///        ConstantStore or a loader may be read-only shared memory.
+            void* get_data_ptr_nc();
             Constant(const OutputVector& args)
                 : Op(args)
                 , m_shape({})
@@ -429,11 +473,40 @@ namespace ngraph
 #endif
             }
 
+            /// \brief Hands the data written by a constructor to runtime::ConstantStore, if it
+            ///        is enabled, so Constants with identical payloads share one buffer.
+            void share_data();
+            /// \brief Sets m_data to a buffer holding a copy of data, sized for the element type
+            ///        and shape. The copy is skipped if the ConstantStore already holds it.
+            void copy_data(const void* data);
+            size_t get_data_size() const
+            {
+                return std::ceil(shape_size(m_shape) * m_element_type.bitwidth() / 8.f);
+            }
+
             static constexpr size_t host_alignment() { return 64; }
             element::Type m_element_type;
             Shape m_shape{};
-            std::unique_ptr<runtime::AlignedBuffer> m_data;
-            bool m_all_elements_bitwise_identical;
+            /// \brief Loads the data of a lazy Constant if it is not loaded yet
+            void ensure_loaded() const
+            {
+                if (!is_loaded())
+                {
+                    load_data();
+                }
+            }
+            void load_data() const;
+
+            // Shared between clones and by the ConstantStore, copied on write by get_data_ptr_nc.
+            // Null until a lazy Constant is loaded, which does not change its value.
+            mutable std::shared_ptr<runtime::AlignedBuffer> m_data;
+            std::shared_ptr<runtime::ConstantLoader> m_loader;
+            mutable std::atomic<bool> m_loaded{true};
+            // m_data was allocated by this Constant and never handed to the ConstantStore, so
+            // it can be written in place once no clone shares it
+            bool m_data_private = false;
+            mutable std::mutex m_load_mutex;
+            mutable bool m_all_elements_bitwise_identical;
             bool are_all_data_elements_bitwise_identical() const;
             Constant(const Constant&) = delete;
             Constant operator=(const Constant&) = delete;
@@ -54,6 +54,7 @@ namespace ngraph
             void validate_and_infer_types() override;
 
             bool get_cacheable() const { return m_cacheable; }
+            void set_cacheable(bool cacheable) { m_cacheable = cacheable; }
             virtual std::shared_ptr<Node>
                 copy_with_new_args(const NodeVector& new_args) const override;
 
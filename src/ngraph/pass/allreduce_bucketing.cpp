@@ -0,0 +1,190 @@
+//*****************************************************************************
+// Copyright 2017-2019 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#include <algorithm>
+#include <map>
+#include <unordered_map>
+#include <unordered_set>
+
+#include "allreduce_bucketing.hpp"
+#include "ngraph/graph_util.hpp"
+#include "ngraph/log.hpp"
+#include "ngraph/op/allreduce.hpp"
+#include "ngraph/op/concat.hpp"
+#include "ngraph/op/reshape.hpp"
+#include "ngraph/op/result.hpp"
+#include "ngraph/op/slice.hpp"
+#include "ngraph/util.hpp"
+
+using namespace std;
+using namespace ngraph;
+
+namespace
+{
+    struct Bucket
+    {
+        size_t byte_size = 0;
+        vector<shared_ptr<op::AllReduce>> members;
+        // The AllReduce that reduces the bucket, and the nodes that replace its members
+        shared_ptr<Node> all_reduce;
+        NodeVector results;
+    };
+
+    // Replaces the members of a bucket with slices of a single AllReduce of their
+    // concatenation
+    void fuse_bucket(Bucket& bucket)
+    {
+        OutputVector flat_args;
+        for (auto& member : bucket.members)
+        {
+            auto arg = member->input_value(0);
+            const Shape& shape = arg.get_shape();
+            if (shape.size() == 1)
+            {
+                flat_args.push_back(arg);
+            }
+            else
+            {
+                flat_args.push_back(make_shared<op::Reshape>(
+                    arg, get_default_order(shape), Shape{shape_size(shape)}));
+            }
+        }
+        auto concat = make_shared<op::Concat>(flat_args, 0);
+        bucket.all_reduce =
+            make_shared<op::AllReduce>(concat, bucket.members.front()->get_reduce_type());
+
+        size_t offset = 0;
+        for (auto& member : bucket.members)
+        {
+            const Shape& shape = member->get_output_shape(0);
+            size_t size = shape_size(shape);
+            shared_ptr<Node> result = make_shared<op::Slice>(
+                bucket.all_reduce, Coordinate{offset}, Coordinate{offset + size});
+            if (shape.size() != 1)
+            {
+                result = make_shared<op::Reshape>(result, AxisVector{0}, shape);
+            }
+            replace_node(member, result);
+            bucket.results.push_back(result);
+            offset += size;
+        }
+    }
+
+    unordered_set<Node*> get_ancestors(Node* node)
+    {
+        unordered_set<Node*> ancestors;
+        vector<Node*> nodes_to_do{node};
+        while (!nodes_to_do.empty())
+        {
+            Node* n = nodes_to_do.back();
+            nodes_to_do.pop_back();
+            if (!ancestors.insert(n).second)
+            {
+                continue;
+            }
+            for (auto& input : n->inputs())
+            {
+                nodes_to_do.push_back(input.get_source_output().get_node());
+            }
+            for (auto& dependency : n->get_control_dependencies())
+            {
+                nodes_to_do.push_back(dependency.get());
+            }
+        }
+        return ancestors;
+    }
+}
+
+bool pass::AllReduceBucketing::run_on_function(shared_ptr<Function> f)
+{
+    vector<Bucket> buckets;
+    // The open bucket of every element type and reduction type
+    map<pair<element::Type, reduction::Type>, size_t> open_buckets;
+    // One more than the last bucket a node depends on, 0 if it depends on none. An AllReduce
+    // that depends on a bucket cannot join it, it would become its own input.
+    unordered_map<Node*, size_t> bucket_dependencies;
+
+    for (auto& node : f->get_ordered_ops())
+    {
+        size_t dependency = 0;
+        for (auto& input : node->inputs())
+        {
+            dependency =
+                max(dependency, bucket_dependencies[input.get_source_output().get_node()]);
+        }
+        for (auto& control_dependency : node->get_control_dependencies())
+        {
+            dependency = max(dependency, bucket_dependencies[control_dependency.get()]);
+        }
+
+        auto all_reduce = as_type_ptr<op::AllReduce>(node);
+        if (all_reduce)
+        {
+            const auto& element_type = all_reduce->get_output_element_type(0);
+            size_t byte_size = shape_size(all_reduce->get_output_shape(0)) * element_type.size();
+            auto key = make_pair(element_type, all_reduce->get_reduce_type());
+            auto it = open_buckets.find(key);
+            if (it == open_buckets.end() || dependency > it->second ||
+                buckets[it->second].byte_size + byte_size > m_bucket_bytes)
+            {
+                open_buckets[key] = buckets.size();
+                buckets.emplace_back();
+            }
+            size_t index = open_buckets[key];
+            buckets[index].byte_size += byte_size;
+            buckets[index].members.push_back(all_reduce);
+            dependency = max(dependency, index + 1);
+        }
+        bucket_dependencies[node.get()] = dependency;
+    }
+
+    bool modified = false;
+    for (auto& bucket : buckets)
+    {
+        if (bucket.members.size() > 1)
+        {
+            NGRAPH_DEBUG << "Fusing " << bucket.members.size() << " AllReduces of "
+                         << bucket.byte_size << " bytes";
+            fuse_bucket(bucket);
+            modified = true;
+        }
+        else
+        {
+            bucket.all_reduce = bucket.members.front();
+            bucket.results.push_back(bucket.all_reduce);
+        }
+    }
+
+    // Consumers of a bucket wait for the next bucket to be started
+    for (size_t i = 0; i + 1 < buckets.size(); ++i)
+    {
+        auto& next = buckets[i + 1].all_reduce;
+        auto ancestors = get_ancestors(next.get());
+        for (auto& result : buckets[i].results)
+        {
+            for (auto& input : result->output(0).get_target_inputs())
+            {
+                Node* consumer = input.get_node();
+                if (!is_type<op::Result>(consumer) && ancestors.count(consumer) == 0)
+                {
+                    consumer->add_control_dependency(next);
+                    modified = true;
+                }
+            }
+        }
+    }
+    return modified;
+}
@@ -0,0 +1,51 @@
+//*****************************************************************************
+// Copyright 2017-2019 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#pragma once
+
+#include "ngraph/pass/pass.hpp"
+
+namespace ngraph
+{
+    namespace pass
+    {
+        class AllReduceBucketing;
+    }
+}
+
+/// \brief Fuses small AllReduces, typically the gradients of a training graph, into buckets of
+///        at most `bucket_bytes` bytes. The inputs of a bucket are flattened and concatenated,
+///        reduced by a single AllReduce, and sliced back.
+///
+/// AllReduces are bucketed in topological order, so a bucket is complete as soon as its last
+/// gradient is computed. The consumers of each bucket are also made control dependent on the
+/// next bucket, so that a backend that starts AllReduces asynchronously computes the next
+/// gradients while the previous bucket is being reduced.
+class NGRAPH_API ngraph::pass::AllReduceBucketing : public FunctionPass
+{
+public:
+    AllReduceBucketing(size_t bucket_bytes = 1 << 24)
+        : FunctionPass()
+        , m_bucket_bytes(bucket_bytes)
+    {
+        set_property(PassProperty::REQUIRE_STATIC_SHAPE, true);
+    }
+
+    virtual bool run_on_function(std::shared_ptr<ngraph::Function> f) override;
+
+private:
+    size_t m_bucket_bytes;
+};
@@ -0,0 +1,355 @@
+//*****************************************************************************
+// Copyright 2017-2019 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+
+#include <algorithm>
+#include <atomic>
+#include <exception>
+#include <memory>
+#include <thread>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+#include "ngraph/log.hpp"
+#include "ngraph/op/allreduce.hpp"
+#include "ngraph/op/broadcast_distributed.hpp"
+#include "ngraph/op/constant.hpp"
+#include "ngraph/op/recv.hpp"
+#include "ngraph/op/result.hpp"
+#include "ngraph/op/send.hpp"
+#include "ngraph/pass/backend_constant_folding.hpp"
+#include "ngraph/runtime/aligned_buffer.hpp"
+#include "ngraph/runtime/tensor.hpp"
+
+using namespace std;
+using namespace ngraph;
+
+constexpr size_t pass::BackendConstantFolding::default_max_folded_bytes;
+
+namespace
+{
+    // A subgraph of foldable ops connected to each other, run as a function of its own
+    struct Subgraph
+    {
+        vector<shared_ptr<Node>> nodes;
+        // The values used outside of the foldable ops
+        vector<Output<Node>> outputs;
+        shared_ptr<runtime::Executable> executable;
+        vector<shared_ptr<runtime::Tensor>> tensors;
+        // Set once the subgraph ran; subgraphs that failed to compile or run stay unfolded
+        bool folded = false;
+    };
+
+    size_t get_output_bytes(const Output<Node>& output)
+    {
+        return shape_size(output.get_shape()) * output.get_element_type().size();
+    }
+
+    size_t find_root(vector<size_t>& parents, size_t i)
+    {
+        while (parents[i] != i)
+        {
+            parents[i] = parents[parents[i]];
+            i = parents[i];
+        }
+        return i;
+    }
+}
+
+static bool is_foldable(const Node& node, runtime::Backend& backend)
+{
+    // Ops with state produce different values on each call, and distributed ops need the other
+    // processes to take part
+    if (node.is_parameter() || node.is_output() || node.is_constant() ||
+        node.get_input_size() == 0 || !node.get_control_dependencies().empty() ||
+        node.has_state() || is_type<op::AllReduce>(&node) ||
+        is_type<op::BroadcastDistributed>(&node) || is_type<op::Send>(&node) ||
+        is_type<op::Recv>(&node))
+    {
+        return false;
+    }
+    for (auto& output : node.outputs())
+    {
+        if (output.get_partial_shape().is_dynamic() || output.get_element_type().is_dynamic())
+        {
+            return false;
+        }
+    }
+    return backend.is_supported(node);
+}
+
+bool pass::BackendConstantFolding::run_on_function(shared_ptr<Function> f)
+{
+    if (!m_backend)
+    {
+        m_backend = runtime::Backend::create(m_backend_name);
+    }
+    auto ops = f->get_ordered_ops();
+
+    // Ops computed from Constants alone, less the ones vetoed for the size of their values
+    unordered_set<Node*> foldable;
+    unordered_set<Node*> vetoed;
+    vector<Output<Node>> outputs;
+    while (true)
+    {
+        foldable.clear();
+        for (auto& node : ops)
+        {
+            if (vetoed.count(node.get()) == 0 && is_foldable(*node, *m_backend))
+            {
+                bool constant_inputs = true;
+                for (auto& input : node->inputs())
+                {
+                    Node* source = input.get_source_output().get_node();
+                    constant_inputs =
+                        constant_inputs && (source->is_constant() || foldable.count(source) > 0);
+                }
+                if (constant_inputs)
+                {
+                    foldable.insert(node.get());
+                }
+            }
+        }
+
+        outputs.clear();
+        for (auto& node : ops)
+        {
+            if (foldable.count(node.get()) == 0)
+            {
+                continue;
+            }
+            for (auto& output : node->outputs())
+            {
+                auto targets = output.get_target_inputs();
+                if (any_of(targets.begin(), targets.end(), [&foldable](const Input<Node>& input) {
+                        return foldable.count(input.get_node()) == 0;
+                    }))
+                {
+                    outputs.push_back(output);
+                }
+            }
+        }
+
+        // A value may only be much larger than the Constants it is computed from if it is
+        // used by other foldable ops alone, which are folded with it
+        bool vetoes = false;
+        for (auto& output : outputs)
+        {
+            size_t bytes = get_output_bytes(output);
+            if (bytes <= m_max_folded_bytes)
+            {
+                continue;
+            }
+            size_t constant_bytes = 0;
+            unordered_set<Node*> visited;
+            vector<Node*> stack{output.get_node()};
+            while (!stack.empty())
+            {
+                Node* node = stack.back();
+                stack.pop_back();
+                for (auto& input : node->inputs())
+                {
+                    auto source = input.get_source_output();
+                    if (visited.insert(source.get_node()).second)
+                    {
+                        if (source.get_node()->is_constant())
+                        {
+                            constant_bytes += get_output_bytes(source);
+                        }
+                        else
+                        {
+                            stack.push_back(source.get_node());
+                        }
+                    }
+                }
+            }
+            if (bytes > constant_bytes)
+            {
+                vetoed.insert(output.get_node());
+                vetoes = true;
+            }
+        }
+        if (!vetoes)
+        {
+            break;
+        }
+    }
+    if (outputs.empty())
+    {
+        return false;
+    }
+
+    // Ops using each other's values are in the same subgraph
+    vector<Node*> nodes;
+    unordered_map<Node*, size_t> node_indices;
+    for (auto& node : ops)
+    {
+        if (foldable.count(node.get()) > 0)
+        {
+            node_indices[node.get()] = nodes.size();
+            nodes.push_back(node.get());
+        }
+    }
+    vector<size_t> parents(nodes.size());
+    for (size_t i = 0; i < nodes.size(); i++)
+    {
+        parents[i] = i;
+    }
+    for (size_t i = 0; i < nodes.size(); i++)
+    {
+        for (auto& input : nodes[i]->inputs())
+        {
+            auto it = node_indices.find(input.get_source_output().get_node());
+            if (it != node_indices.end())
+            {
+                parents[find_root(parents, i)] = find_root(parents, it->second);
+            }
+        }
+    }
+    vector<Subgraph> subgraphs;
+    unordered_map<size_t, size_t> root_subgraphs;
+    for (auto& node : ops)
+    {
+        auto it = node_indices.find(node.get());
+        if (it != node_indices.end())
+        {
+            size_t root = find_root(parents, it->second);
+            if (root_subgraphs.count(root) == 0)
+            {
+                root_subgraphs[root] = subgraphs.size();
+                subgraphs.emplace_back();
+            }
+            subgraphs[root_subgraphs[root]].nodes.push_back(node);
+        }
+    }
+    for (auto& output : outputs)
+    {
+        size_t root = find_root(parents, node_indices.at(output.get_node()));
+        subgraphs[root_subgraphs.at(root)].outputs.push_back(output);
+    }
+
+    // Every subgraph is copied into a function of its own, so that compiling it cannot change
+    // the nodes of `f`
+    for (auto& subgraph : subgraphs)
+    {
+        unordered_map<Node*, shared_ptr<Node>> copies;
+        for (auto& node : subgraph.nodes)
+        {
+            OutputVector inputs;
+            for (auto& input : node->inputs())
+            {
+                auto source = input.get_source_output();
+                auto& copy = copies[source.get_node()];
+                if (!copy)
+                {
+                    copy = source.get_node()->copy_with_new_inputs({});
+                }
+                inputs.push_back(Output<Node>(copy, source.get_index()));
+            }
+            copies[node.get()] = node->copy_with_new_inputs(inputs);
+        }
+        ResultVector results;
+        for (auto& output : subgraph.outputs)
+        {
+            results.push_back(make_shared<op::Result>(
+                Output<Node>(copies.at(output.get_node()), output.get_index())));
+            subgraph.tensors.push_back(
+                m_backend->create_tensor(output.get_element_type(), output.get_shape()));
+        }
+        auto function = make_shared<Function>(results, ParameterVector{});
+        try
+        {
+            subgraph.executable = m_backend->compile(function);
+        }
+        catch (const exception& e)
+        {
+            NGRAPH_DEBUG << "BackendConstantFolding: not folding a subgraph of "
+                         << subgraph.nodes.size() << " ops, compiling it failed: " << e.what();
+        }
+    }
+
+    // The subgraphs are independent, so they run in parallel
+    size_t thread_count = min<size_t>(max(thread::hardware_concurrency(), 1u), subgraphs.size());
+    atomic<size_t> next_subgraph{0};
+    auto run_subgraphs = [&]() {
+        for (size_t i = next_subgraph++; i < subgraphs.size(); i = next_subgraph++)
+        {
+            auto& subgraph = subgraphs[i];
+            if (!subgraph.executable)
+            {
+                continue;
+            }
+            try
+            {
+                subgraph.executable->call(subgraph.tensors, {});
+                subgraph.folded = true;
+            }
+            catch (const exception& e)
+            {
+                NGRAPH_DEBUG << "BackendConstantFolding: not folding a subgraph of "
+                             << subgraph.nodes.size() << " ops, running it failed: " << e.what();
+            }
+        }
+    };
+    vector<thread> threads;
+    for (size_t i = 1; i < thread_count; i++)
+    {
+        threads.emplace_back(run_subgraphs);
+    }
+    run_subgraphs();
+    for (auto& t : threads)
+    {
+        t.join();
+    }
+
+    size_t folded_ops = 0;
+    size_t folded_subgraphs = 0;
+    size_t folded_constants = 0;
+    size_t folded_bytes = 0;
+    for (auto& subgraph : subgraphs)
+    {
+        if (!subgraph.folded)
+        {
+            continue;
+        }
+        for (size_t i = 0; i < subgraph.outputs.size(); i++)
+        {
+            auto& output = subgraph.outputs[i];
+            auto& tensor = subgraph.tensors[i];
+            // The Constant takes the buffer the tensor is read into, without another copy
+            auto data = make_shared<runtime::AlignedBuffer>(tensor->get_size_in_bytes());
+            tensor->read(data->get_ptr(), data->size());
+            auto constant =
+                make_shared<op::Constant>(output.get_element_type(), output.get_shape(), data);
+            for (auto& input : output.get_target_inputs())
+            {
+                if (foldable.count(input.get_node()) == 0)
+                {
+                    input.replace_source_output(constant);
+                }
+            }
+            folded_bytes += data->size();
+        }
+        folded_ops += subgraph.nodes.size();
+        folded_subgraphs++;
+        folded_constants += subgraph.outputs.size();
+    }
+    NGRAPH_DEBUG << "BackendConstantFolding: folded " << folded_ops << " ops in "
+                 << folded_subgraphs << " of " << subgraphs.size() << " subgraphs into "
+                 << folded_constants << " constants of " << folded_bytes << " bytes";
+    return folded_subgraphs > 0;
+}
@@ -0,0 +1,77 @@
+//*****************************************************************************
+// Copyright 2017-2019 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+
+#pragma once
+
+#include <memory>
+#include <string>
+
+#include "ngraph/pass/pass.hpp"
+#include "ngraph/runtime/backend.hpp"
+
+namespace ngraph
+{
+    namespace pass
+    {
+        class BackendConstantFolding;
+    }
+}
+
+/// \brief Folds every subgraph computed from Constants alone by running it on a backend.
+///
+/// ConstantFolding matches a fixed set of ops and evaluates them one at a time with the
+/// reference kernels. This pass folds any op the backend supports, fused ops included, so
+/// a host backend with fast kernels such as GCPU can be used in place of the INTERPRETER.
+/// Independent subgraphs are compiled as functions of their own and run in parallel, and
+/// only the values used outside of them become Constants.
+///
+/// A value larger than `max_folded_bytes` is only folded if it is no larger than the
+/// Constants it is computed from, so folding cannot grow the model much, as by
+/// broadcasting a scalar. Such values are computed when the function runs instead.
+///
+/// Ops with state and distributed ops are never folded. A subgraph that the backend fails
+/// to compile or run is left as it is.
+class NGRAPH_API ngraph::pass::BackendConstantFolding : public FunctionPass
+{
+public:
+    static constexpr size_t default_max_folded_bytes = 16 * 1024 * 1024;
+
+    BackendConstantFolding(const std::string& backend_name = "INTERPRETER",
+                           size_t max_folded_bytes = default_max_folded_bytes)
+        : FunctionPass()
+        , m_backend_name(backend_name)
+        , m_max_folded_bytes(max_folded_bytes)
+    {
+        set_property(PassProperty::CHANGE_DYNAMIC_STATE, true);
+    }
+
+    BackendConstantFolding(const std::shared_ptr<runtime::Backend>& backend,
+                           size_t max_folded_bytes = default_max_folded_bytes)
+        : FunctionPass()
+        , m_backend(backend)
+        , m_max_folded_bytes(max_folded_bytes)
+    {
+        set_property(PassProperty::CHANGE_DYNAMIC_STATE, true);
+    }
+
+    bool run_on_function(std::shared_ptr<Function> f) override;
+
+private:
+    std::string m_backend_name;
+    std::shared_ptr<runtime::Backend> m_backend;
+    size_t m_max_folded_bytes;
+};
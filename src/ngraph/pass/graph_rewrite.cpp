@@ -71,6 +71,7 @@ bool pass::GraphRewrite::run_on_function(shared_ptr<Function> f)
     static bool s_rerun_dynamic_check =
         (std::getenv("NGRAPH_GRAPH_REWRITE_RERUN_DYNAMIC_CHECK") != nullptr);
     bool is_dyn_func = s_rerun_dynamic_check && f->is_dynamic();
+    PassProfile* profile = get_pass_profile();
     do
     {
         rewritten = false;
@@ -80,6 +81,10 @@ bool pass::GraphRewrite::run_on_function(shared_ptr<Function> f)
         m_matchers.clear();
         for (auto node : f->get_ordered_ops())
         {
+            if (profile)
+            {
+                profile->nodes_visited++;
+            }
             if (m_enable_shape_inference)
             {
                 node->revalidate_and_infer_types();
@@ -97,8 +102,16 @@ bool pass::GraphRewrite::run_on_function(shared_ptr<Function> f)
                 NGRAPH_DEBUG << "Running matcher " << closure.matcher->get_name() << "("
                              << closure.matcher->get_pattern()->get_name() << ") on "
                              << node->get_name();
+                if (profile)
+                {
+                    profile->matchers_attempted++;
+                }
                 if (closure.matcher->match(node))
                 {
+                    if (profile)
+                    {
+                        profile->matchers_matched++;
+                    }
                     NGRAPH_DEBUG << "Matcher " << closure.matcher << closure.matcher->get_name()
                                  << " matched " << node->get_name();
                     if (closure.callback(*closure.matcher.get()))
@@ -213,10 +226,15 @@ bool pass::RecurrentGraphRewrite::run_on_function(shared_ptr<Function> f)
     static bool s_rerun_dynamic_check =
         (std::getenv("NGRAPH_GRAPH_REWRITE_RERUN_DYNAMIC_CHECK") != nullptr);
 
+    PassProfile* profile = get_pass_profile();
     auto run_matchers = [&]() -> bool {
         bool is_dyn_func = s_rerun_dynamic_check && f->is_dynamic();
         for (auto node : f->get_ops())
         {
+            if (profile)
+            {
+                profile->nodes_visited++;
+            }
             for (auto& closure : m_matchers)
             {
                 if (is_dyn_func && closure.property[PassProperty::REQUIRE_STATIC_SHAPE])
@@ -228,8 +246,16 @@ bool pass::RecurrentGraphRewrite::run_on_function(shared_ptr<Function> f)
                     continue;
                 }
                 NGRAPH_DEBUG << "Running matcher " << closure.matcher << " on " << node->get_name();
+                if (profile)
+                {
+                    profile->matchers_attempted++;
+                }
                 if (closure.matcher->match(node))
                 {
+                    if (profile)
+                    {
+                        profile->matchers_matched++;
+                    }
                     NGRAPH_DEBUG << "Matcher " << closure.matcher << " matched "
                                  << node->get_name();
                     if (closure.callback(*closure.matcher.get()))
@@ -0,0 +1,118 @@
+//*****************************************************************************
+// Copyright 2017-2019 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#include <unordered_map>
+
+#include "ngraph/pass/in_place_elementwise.hpp"
+
+#include "ngraph/descriptor/layout/tensor_layout.hpp"
+#include "ngraph/log.hpp"
+#include "ngraph/op/convert.hpp"
+
+using namespace std;
+using namespace ngraph;
+
+static bool is_elementwise(const Node* node)
+{
+    return node->is_unary_elementwise_arithmetic() || node->is_binary_elementwise_arithmetic() ||
+           node->is_binary_elementwise_logical() || is_type<op::Convert>(node);
+}
+
+// The output may overwrite the input if each output element only depends on the input element
+// at the same position and takes the same space
+static bool can_overwrite(const Input<Node>& input, const Output<Node>& output)
+{
+    Output<Node> source = input.get_source_output();
+    Node* source_node = source.get_node();
+    if (source_node->is_parameter() || source_node->is_constant())
+    {
+        return false;
+    }
+    for (const Input<Node>& target : source.get_target_inputs())
+    {
+        if (target.get_node()->is_output())
+        {
+            return false;
+        }
+    }
+    if (input.get_shape() != output.get_shape())
+    {
+        return false;
+    }
+    if (is_type<op::Convert>(output.get_node())
+            ? input.get_element_type().size() != output.get_element_type().size()
+            : input.get_element_type() != output.get_element_type())
+    {
+        return false;
+    }
+    auto& input_layout = input.get_tensor().get_tensor_layout();
+    auto& output_layout = output.get_tensor().get_tensor_layout();
+    return !input_layout || !output_layout || *input_layout == *output_layout;
+}
+
+bool pass::InPlaceElementwise::run_on_function(shared_ptr<Function> function)
+{
+    list<shared_ptr<Node>> ops = function->get_ordered_ops();
+
+    // Last op reading each tensor
+    unordered_map<const descriptor::Tensor*, const Node*> last_use;
+    for (auto& node : ops)
+    {
+        for (const Input<Node>& input : node->inputs())
+        {
+            last_use[&input.get_tensor()] = node.get();
+        }
+    }
+
+    size_t count = 0;
+    for (auto& node : ops)
+    {
+        if (!node->is_op() || node->get_output_size() != 1 || !is_elementwise(node.get()))
+        {
+            continue;
+        }
+        auto op = static_pointer_cast<op::Op>(node);
+        auto op_annotations = op->get_op_annotations();
+        if (op_annotations && !op_annotations->get_in_place_oi_pairs().empty())
+        {
+            continue;
+        }
+        // Broadcasting binary ops read some input elements more than once
+        if (node->get_input_size() == 2 && node->get_input_shape(0) != node->get_input_shape(1))
+        {
+            continue;
+        }
+        for (const Input<Node>& input : node->inputs())
+        {
+            if (last_use.at(&input.get_tensor()) == node.get() &&
+                can_overwrite(input, node->output(0)))
+            {
+                if (!op_annotations)
+                {
+                    op_annotations = op_annotations_factory();
+                    op->set_op_annotations(op_annotations);
+                }
+                op_annotations->add_in_place_oi_pair({0, input.get_index(), true});
+                NGRAPH_DEBUG << "in place elementwise: " << node->get_name() << " overwrites "
+                             << input.get_source_output().get_node()->get_name();
+                count++;
+                break;
+            }
+        }
+    }
+    NGRAPH_DEBUG << "in place elementwise: " << count << " ops marked";
+    return false;
+}
@@ -0,0 +1,62 @@
+//*****************************************************************************
+// Copyright 2017-2019 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#pragma once
+
+#include <functional>
+
+#include "ngraph/op/util/op_annotations.hpp"
+#include "ngraph/pass/pass.hpp"
+
+namespace ngraph
+{
+    namespace pass
+    {
+        class InPlaceElementwise;
+    }
+}
+
+/// \brief Lets elementwise ops write their output over an input that dies at the op.
+///
+/// Unary and binary elementwise ops (and Convert between types of the same size) get a
+/// destructive in-place annotation for an input whose last use is the op, as long as the input
+/// has the output's shape, type and layout and is not a parameter, a constant or a function
+/// result. Memory assignment reuses the input's buffer for the output when the liveness it
+/// computes agrees. Ops that already have in-place annotations are left alone.
+class NGRAPH_API ngraph::pass::InPlaceElementwise : public FunctionPass
+{
+public:
+    InPlaceElementwise()
+        : FunctionPass()
+    {
+    }
+
+    InPlaceElementwise(
+        std::function<std::shared_ptr<ngraph::op::util::OpAnnotations>(void)> func)
+        : FunctionPass()
+        , op_annotations_factory(func)
+    {
+    }
+
+    bool run_on_function(std::shared_ptr<ngraph::Function> function) override;
+
+private:
+    std::function<std::shared_ptr<ngraph::op::util::OpAnnotations>(void)> op_annotations_factory =
+        []() -> std::shared_ptr<ngraph::op::util::OpAnnotations> {
+        auto op_annotations = std::make_shared<ngraph::op::util::OpAnnotations>();
+        return op_annotations;
+    };
+};
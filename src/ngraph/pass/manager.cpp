@@ -53,20 +53,76 @@ pass::Manager::~Manager()
 {
 }
 
+static string get_pass_name(const pass::PassBase& pass)
+{
+    string name = typeid(pass).name();
+#ifndef _WIN32
+    int status;
+    char* demangled = abi::__cxa_demangle(name.c_str(), nullptr, nullptr, &status);
+    if (demangled)
+    {
+        name = demangled;
+        free(demangled);
+    }
+#endif
+    return name;
+}
+
+namespace
+{
+    // Points the manager state at the profile of the running pass, and clears the pointer when
+    // the pass finishes or throws
+    class PassProfileScope
+    {
+    public:
+        PassProfileScope(pass::ManagerState& state, pass::PassProfile* profile)
+            : m_state(state)
+        {
+            m_state.set_pass_profile(profile);
+        }
+        ~PassProfileScope() { m_state.set_pass_profile(nullptr); }
+
+    private:
+        pass::ManagerState& m_state;
+    };
+}
+
+template <typename T>
+static size_t count_ops(const vector<pair<shared_ptr<Function>, T>>& fs)
+{
+    size_t count = 0;
+    for (auto& f_pair : fs)
+    {
+        count += f_pair.first->get_ops().size();
+    }
+    return count;
+}
+
 void pass::Manager::run_passes(shared_ptr<Function> func, bool /* transitive */)
 {
-    static bool profile_enabled = getenv("NGRAPH_PROFILE_PASS_ENABLE") != nullptr;
+    static bool profile_print = getenv("NGRAPH_PROFILE_PASS_ENABLE") != nullptr;
+    CompileProfiler* profiler = CompileProfiler::get_active();
+    bool profile_enabled = profile_print || m_profile || profiler != nullptr;
 
     get_state().set_function(func);
     vector<std::pair<shared_ptr<Function>, bool>> fs{std::make_pair(func, func->is_dynamic())};
     vector<shared_ptr<Function>> f_array{func};
 
+    m_pass_profiles.clear();
     size_t index = 0;
     stopwatch pass_timer;
     stopwatch overall_timer;
     overall_timer.start();
     for (shared_ptr<PassBase> pass : m_pass_list)
     {
+        PassProfile pass_profile;
+        if (profile_enabled)
+        {
+            pass_profile.name = get_pass_name(*pass);
+            pass_profile.nodes_before = count_ops(fs);
+            pass_profile.nodes_allocated = Node::get_next_instance_id();
+        }
+        PassProfileScope profile_scope(get_state(), profile_enabled ? &pass_profile : nullptr);
         pass_timer.start();
         pass->set_state(get_state());
         auto module_pass = dynamic_pointer_cast<ModulePass>(pass);
@@ -94,7 +150,13 @@ void pass::Manager::run_passes(shared_ptr<Function> func, bool /* transitive */)
                 {
                     continue;
                 }
+                size_t visited = pass_profile.nodes_visited;
                 bool function_modified = function_pass->run_on_function(f);
+                if (profile_enabled && visited == pass_profile.nodes_visited)
+                {
+                    // The pass did not report its own visits, assume one walk of the graph
+                    pass_profile.nodes_visited += f->get_ops().size();
+                }
                 // If the pass may change the function's is_dynamic property, we need to
                 // update the cached value.
                 if (function_modified &&
@@ -116,6 +178,7 @@ void pass::Manager::run_passes(shared_ptr<Function> func, bool /* transitive */)
                 for (shared_ptr<Node> n : f->get_ops())
                 {
                     node_pass->run_on_node(n);
+                    pass_profile.nodes_visited++;
                 }
             }
         }
@@ -129,7 +192,9 @@ void pass::Manager::run_passes(shared_ptr<Function> func, bool /* transitive */)
                 {
                     continue;
                 }
-                bool function_modified = call_graph_pass->run_on_call_graph(f->get_ordered_ops());
+                auto ordered_ops = f->get_ordered_ops();
+                pass_profile.nodes_visited += ordered_ops.size();
+                bool function_modified = call_graph_pass->run_on_call_graph(ordered_ops);
                 f_pair.second = (function_modified == true) ? f->is_dynamic() : f_pair.second;
             }
         }
@@ -162,16 +227,22 @@ void pass::Manager::run_passes(shared_ptr<Function> func, bool /* transitive */)
         pass_timer.stop();
         if (profile_enabled)
         {
-            PassBase* p = pass.get();
-            string name = typeid(*p).name();
-#ifndef _WIN32
-            int status;
-            name = abi::__cxa_demangle(name.c_str(), nullptr, nullptr, &status);
-#endif
-            cout << setw(7) << pass_timer.get_milliseconds() << "ms " << name << "\n";
+            pass_profile.microseconds = pass_timer.get_microseconds();
+            pass_profile.nodes_after = count_ops(fs);
+            pass_profile.nodes_allocated =
+                Node::get_next_instance_id() - pass_profile.nodes_allocated;
+            if (profile_print)
+            {
+                cout << pass_profile << "\n";
+            }
+            if (profiler)
+            {
+                profiler->add(pass_profile);
+            }
+            m_pass_profiles.push_back(move(pass_profile));
         }
     }
-    if (profile_enabled)
+    if (profile_print)
     {
         cout << "passes done in " << overall_timer.get_milliseconds() << "ms\n";
     }
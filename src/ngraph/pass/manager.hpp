@@ -24,6 +24,7 @@
 #include "ngraph/pass/manager_state.hpp"
 #include "ngraph/pass/pass.hpp"
 #include "ngraph/pass/pass_config.hpp"
+#include "ngraph/pass/pass_profile.hpp"
 #include "ngraph/pass/validate.hpp"
 
 namespace ngraph
@@ -60,6 +61,12 @@ public:
     void set_pass_visualization(bool new_state) { m_visualize = new_state; }
     void set_pass_serialization(bool new_state) { m_serialize = new_state; }
     void set_per_pass_validation(bool new_state) { m_per_pass_validation = new_state; }
+    /// \brief Collect a PassProfile for every pass run by run_passes. Profiling is also enabled
+    ///        by the NGRAPH_PROFILE_PASS_ENABLE environment variable, which additionally prints
+    ///        the profiles, or by an active pass::CompileProfiler.
+    void set_pass_profiling(bool new_state) { m_profile = new_state; }
+    /// \return The profiles collected by the last call to run_passes
+    const std::vector<PassProfile>& get_pass_profiles() const { return m_pass_profiles; }
 private:
     template <typename T, class... Args>
     std::shared_ptr<T> push_pass(Args&&... args)
@@ -91,4 +98,6 @@ private:
     bool m_visualize = false;
     bool m_serialize = false;
     bool m_per_pass_validation = true;
+    bool m_profile = false;
+    std::vector<PassProfile> m_pass_profiles;
 };
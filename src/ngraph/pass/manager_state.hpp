@@ -26,6 +26,7 @@
 
 #include "ngraph/function.hpp"
 #include "ngraph/node.hpp"
+#include "ngraph/pass/pass_profile.hpp"
 
 using visualize_tree_ops_map_t =
     std::unordered_map<ngraph::Node::type_info_t,
@@ -60,7 +61,11 @@ public:
         return {m_function};
     }
 
+    /// \brief The profile of the pass currently being run, nullptr when profiling is off
+    PassProfile* get_pass_profile() const { return m_pass_profile; }
+    void set_pass_profile(PassProfile* profile) { m_pass_profile = profile; }
 private:
     visualize_tree_ops_map_t m_visualize_tree_ops_map;
     std::shared_ptr<Function> m_function;
+    PassProfile* m_pass_profile = nullptr;
 };
@@ -14,7 +14,12 @@
 // limitations under the License.
 //*****************************************************************************
 
+#include <algorithm>
+#include <cstdlib>
+#include <cstring>
 #include <exception>
+#include <map>
+#include <numeric>
 #include <sstream>
 
 #include "ngraph/log.hpp"
@@ -33,6 +38,7 @@ using namespace ngraph;
 pass::MemoryLayout::MemoryLayout(size_t alignment, bool disable_memory_sharing)
     : m_alignment(alignment)
     , m_disable_memory_sharing(disable_memory_sharing)
+    , m_strategy(MemoryPlanner::get_default_strategy())
 {
     if (m_alignment == 0)
     {
@@ -42,7 +48,8 @@ pass::MemoryLayout::MemoryLayout(size_t alignment, bool disable_memory_sharing)
 
 bool pass::MemoryLayout::run_on_function(shared_ptr<Function> function)
 {
-    MemoryManager mm(m_alignment, m_disable_memory_sharing);
+    MemoryPlanner planner(m_alignment, m_strategy);
+    map<descriptor::Tensor*, size_t> buffer_ids;
     for (shared_ptr<Node> node : function->get_ordered_ops())
     {
         std::map<descriptor::Tensor*, descriptor::Tensor*> in_place_outputs;
@@ -68,7 +75,8 @@ bool pass::MemoryLayout::run_on_function(shared_ptr<Function> function)
                              is_type<op::GetOutputElement>(node) ||
                              (m_disable_memory_sharing && !oi_pair.destructive &&
                               !input_node->is_parameter() && !input_node->is_constant())) &&
-                            node->liveness_new_list.count(output) != 0)
+                            node->liveness_new_list.count(output) != 0 &&
+                            buffer_ids.count(input) != 0)
 
                         {
                             NGRAPH_DEBUG << "Reusing " << input->get_name() << " for "
@@ -83,28 +91,241 @@ bool pass::MemoryLayout::run_on_function(shared_ptr<Function> function)
 
         for (descriptor::Tensor* tensor : node->liveness_new_list)
         {
-            size_t offset = in_place_outputs.count(tensor)
-                                ? in_place_outputs.at(tensor)->get_pool_offset()
-                                : mm.allocate(tensor->size());
-            tensor->set_pool_offset(offset);
+            buffer_ids[tensor] = in_place_outputs.count(tensor)
+                                     ? buffer_ids.at(in_place_outputs.at(tensor))
+                                     : planner.allocate(tensor->size());
         }
 
         if (!m_disable_memory_sharing)
         {
-            for (const descriptor::Tensor* tensor : node->liveness_free_list)
+            for (descriptor::Tensor* tensor : node->liveness_free_list)
             {
-                if (reused_inputs.count(tensor) == 0)
+                auto id = buffer_ids.find(tensor);
+                if (reused_inputs.count(tensor) == 0 && id != buffer_ids.end())
                 {
-                    mm.free(tensor->get_pool_offset());
+                    planner.free(id->second);
                 }
             }
         }
     }
-    function->set_temporary_pool_size(mm.max_allocated());
+
+    planner.plan();
+    for (auto& tensor_id : buffer_ids)
+    {
+        tensor_id.first->set_pool_offset(planner.get_offset(tensor_id.second));
+    }
+    m_max_allocated = planner.max_allocated();
+    m_lower_bound = planner.get_lower_bound();
+    NGRAPH_DEBUG << "MemoryLayout: " << MemoryPlanner::get_strategy_name(m_strategy)
+                 << " planned " << m_max_allocated << " bytes, lower bound " << m_lower_bound;
+    function->set_temporary_pool_size(m_max_allocated);
 
     return false;
 }
 
+pass::MemoryPlanner::MemoryPlanner(size_t alignment, strategy s)
+    : m_alignment(alignment)
+    , m_strategy(s)
+{
+    if (m_alignment == 0)
+    {
+        throw invalid_argument("Memory alignment must be > 0");
+    }
+}
+
+size_t pass::MemoryPlanner::allocate(size_t size)
+{
+    m_buffers.push_back(buffer{MemoryManager::align(size, m_alignment),
+                               m_time++,
+                               numeric_limits<size_t>::max(),
+                               0});
+    return m_buffers.size() - 1;
+}
+
+void pass::MemoryPlanner::free(size_t id)
+{
+    m_buffers.at(id).end = m_time++;
+}
+
+void pass::MemoryPlanner::plan()
+{
+    vector<size_t> by_size(m_buffers.size());
+    iota(by_size.begin(), by_size.end(), 0);
+    vector<size_t> by_lifetime = by_size;
+    sort(by_size.begin(), by_size.end(), [this](size_t a, size_t b) {
+        return m_buffers[a].size != m_buffers[b].size ? m_buffers[a].size > m_buffers[b].size
+                                                       : m_buffers[a].begin < m_buffers[b].begin;
+    });
+    sort(by_lifetime.begin(), by_lifetime.end(), [this](size_t a, size_t b) {
+        size_t a_length = m_buffers[a].end - m_buffers[a].begin;
+        size_t b_length = m_buffers[b].end - m_buffers[b].begin;
+        return a_length != b_length ? a_length > b_length : m_buffers[a].size > m_buffers[b].size;
+    });
+
+    switch (m_strategy)
+    {
+    case strategy::FIRST_FIT: m_max_allocated = plan_first_fit(); break;
+    case strategy::GREEDY_BY_SIZE: m_max_allocated = plan_greedy(by_size); break;
+    case strategy::GREEDY_BY_LIFETIME: m_max_allocated = plan_greedy(by_lifetime); break;
+    case strategy::BEST:
+    {
+        m_max_allocated = plan_first_fit();
+        vector<size_t> best_offsets;
+        for (const vector<size_t>* order : {&by_size, &by_lifetime})
+        {
+            for (const buffer& b : m_buffers)
+            {
+                best_offsets.push_back(b.offset);
+            }
+            size_t max_allocated = plan_greedy(*order);
+            if (max_allocated < m_max_allocated)
+            {
+                m_max_allocated = max_allocated;
+            }
+            else
+            {
+                for (size_t i = 0; i < m_buffers.size(); i++)
+                {
+                    m_buffers[i].offset = best_offsets[i];
+                }
+            }
+            best_offsets.clear();
+        }
+        break;
+    }
+    }
+}
+
+size_t pass::MemoryPlanner::plan_first_fit()
+{
+    // Replay the allocations and frees in the order they were made
+    const size_t none = numeric_limits<size_t>::max();
+    vector<size_t> events(m_time, none);
+    for (size_t id = 0; id < m_buffers.size(); id++)
+    {
+        events[m_buffers[id].begin] = id;
+        if (m_buffers[id].end != none)
+        {
+            events[m_buffers[id].end] = id;
+        }
+    }
+    MemoryManager mm(m_alignment);
+    for (size_t time = 0; time < events.size(); time++)
+    {
+        // Frees superseded by a later free of the same buffer leave no event
+        if (events[time] == none)
+        {
+            continue;
+        }
+        buffer& b = m_buffers[events[time]];
+        if (b.begin == time)
+        {
+            b.offset = mm.allocate(b.size);
+        }
+        else
+        {
+            mm.free(b.offset);
+        }
+    }
+    return mm.max_allocated();
+}
+
+size_t pass::MemoryPlanner::plan_greedy(const vector<size_t>& order)
+{
+    size_t max_allocated = 0;
+    // Buffers placed so far, sorted by offset so the gaps can be found without sorting
+    vector<size_t> placed;
+    placed.reserve(order.size());
+    for (size_t id : order)
+    {
+        buffer& b = m_buffers[id];
+
+        // Take the smallest gap between live buffers that is large enough, else go above them
+        size_t gap_start = 0;
+        size_t best_offset = numeric_limits<size_t>::max();
+        size_t best_gap = numeric_limits<size_t>::max();
+        for (size_t other_id : placed)
+        {
+            const buffer& other = m_buffers[other_id];
+            if (other.begin >= b.end || b.begin >= other.end)
+            {
+                continue;
+            }
+            if (other.offset > gap_start)
+            {
+                size_t gap = other.offset - gap_start;
+                if (gap >= b.size && gap < best_gap)
+                {
+                    best_gap = gap;
+                    best_offset = gap_start;
+                }
+            }
+            gap_start = max(gap_start, other.offset + other.size);
+        }
+        b.offset = best_offset != numeric_limits<size_t>::max() ? best_offset : gap_start;
+        max_allocated = max(max_allocated, b.offset + b.size);
+
+        auto position =
+            upper_bound(placed.begin(), placed.end(), b.offset, [this](size_t offset, size_t i) {
+                return offset < m_buffers[i].offset;
+            });
+        placed.insert(position, id);
+    }
+    return max_allocated;
+}
+
+size_t pass::MemoryPlanner::get_lower_bound() const
+{
+    vector<int64_t> delta(m_time, 0);
+    for (const buffer& b : m_buffers)
+    {
+        delta[b.begin] += b.size;
+        if (b.end != numeric_limits<size_t>::max())
+        {
+            delta[b.end] -= b.size;
+        }
+    }
+    int64_t live = 0;
+    int64_t rc = 0;
+    for (int64_t d : delta)
+    {
+        live += d;
+        rc = max(rc, live);
+    }
+    return rc;
+}
+
+pass::MemoryPlanner::strategy pass::MemoryPlanner::get_default_strategy()
+{
+    strategy rc = strategy::BEST;
+    if (const char* env = getenv("NGRAPH_MEMORY_PLANNER"))
+    {
+        for (strategy s : {strategy::FIRST_FIT,
+                           strategy::GREEDY_BY_SIZE,
+                           strategy::GREEDY_BY_LIFETIME,
+                           strategy::BEST})
+        {
+            if (strcmp(env, get_strategy_name(s)) == 0)
+            {
+                rc = s;
+            }
+        }
+    }
+    return rc;
+}
+
+const char* pass::MemoryPlanner::get_strategy_name(strategy s)
+{
+    switch (s)
+    {
+    case strategy::FIRST_FIT: return "first_fit";
+    case strategy::GREEDY_BY_SIZE: return "greedy_by_size";
+    case strategy::GREEDY_BY_LIFETIME: return "greedy_by_lifetime";
+    case strategy::BEST: return "best";
+    }
+    return "";
+}
+
 pass::MemoryManager::node::node(size_t size, block_state state)
     : m_size{size}
     , m_state{state}
@@ -19,6 +19,8 @@
 #include <limits>
 #include <list>
 #include <sstream>
+#include <string>
+#include <vector>
 
 #include "ngraph/pass/pass.hpp"
 
@@ -29,18 +31,90 @@ namespace ngraph
         class MemoryLayout;
         class MemoryNode;
         class MemoryManager;
+        class MemoryPlanner;
     }
 }
 
+/// \brief Offline memory planner.
+///
+/// Buffers are allocated and freed in execution order, as with MemoryManager, but offsets are
+/// only assigned by plan(), once every buffer lifetime is known. Two buffers may share memory
+/// if one is freed before the other is allocated.
+class ngraph::pass::MemoryPlanner
+{
+public:
+    enum class strategy
+    {
+        /// Replays the allocations in execution order with MemoryManager's first fit
+        FIRST_FIT,
+        /// Places the largest buffers first, each in the smallest gap it fits
+        GREEDY_BY_SIZE,
+        /// Places the longest lived buffers first, each in the smallest gap it fits
+        GREEDY_BY_LIFETIME,
+        /// Plans with each of the strategies above and keeps the smallest result
+        BEST
+    };
+
+    MemoryPlanner(size_t alignment = 1, strategy s = get_default_strategy());
+
+    /// \return Id of a new buffer, live from now until it is freed
+    size_t allocate(size_t size);
+    /// \brief Ends the lifetime of a buffer. Tensors that alias one buffer may each free it;
+    ///        the buffer then lives until the last of them is freed.
+    void free(size_t id);
+
+    /// \brief Assigns the offsets of all buffers
+    void plan();
+    size_t get_offset(size_t id) const { return m_buffers.at(id).offset; }
+    /// \return Size of the memory pool needed by the plan
+    size_t max_allocated() const { return m_max_allocated; }
+    /// \return The largest total size of the buffers live at any one time. No plan can be
+    ///         smaller; the difference to max_allocated() is lost to fragmentation.
+    size_t get_lower_bound() const;
+    size_t get_buffer_count() const { return m_buffers.size(); }
+
+    /// \return The strategy set with the NGRAPH_MEMORY_PLANNER environment variable (first_fit,
+    ///         greedy_by_size, greedy_by_lifetime or best), BEST if it is not set
+    static strategy get_default_strategy();
+    static const char* get_strategy_name(strategy s);
+
+private:
+    struct buffer
+    {
+        size_t size;
+        size_t begin;
+        size_t end;
+        size_t offset;
+    };
+
+    size_t plan_first_fit();
+    size_t plan_greedy(const std::vector<size_t>& order);
+
+    size_t m_alignment;
+    strategy m_strategy;
+    std::vector<buffer> m_buffers;
+    size_t m_time = 0;
+    size_t m_max_allocated = 0;
+};
+
 class ngraph::pass::MemoryLayout : public FunctionPass
 {
 public:
     MemoryLayout(size_t alignment = 1, bool disable_memory_sharing = false);
     bool run_on_function(std::shared_ptr<ngraph::Function>) override;
 
+    void set_strategy(MemoryPlanner::strategy s) { m_strategy = s; }
+    /// \return The pool size planned for the last function
+    size_t get_max_allocated() const { return m_max_allocated; }
+    /// \return The smallest pool size possible for the last function
+    size_t get_lower_bound() const { return m_lower_bound; }
+
 private:
     size_t m_alignment;
     bool m_disable_memory_sharing;
+    MemoryPlanner::strategy m_strategy;
+    size_t m_max_allocated = 0;
+    size_t m_lower_bound = 0;
 };
 
 class ngraph::pass::MemoryManager
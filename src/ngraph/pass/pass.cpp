@@ -35,6 +35,11 @@ void pass::PassBase::set_state(ManagerState& state)
     m_state = &state;
 }
 
+pass::PassProfile* pass::PassBase::get_pass_profile() const
+{
+    return m_state ? m_state->get_pass_profile() : nullptr;
+}
+
 bool pass::PassBase::get_property(const PassPropertyMask& prop) const
 {
     return m_property.is_set(prop);
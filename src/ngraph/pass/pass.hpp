@@ -83,6 +83,9 @@ protected:
     ManagerState& get_state();
     void set_state(ManagerState&);
     void set_property(const PassPropertyMask& prop, bool value);
+    /// \return The profile to record statistics into, or nullptr if the pass is not being
+    ///         profiled or is run outside of a pass::Manager.
+    PassProfile* get_pass_profile() const;
 
 private:
     PassPropertyMask m_property;
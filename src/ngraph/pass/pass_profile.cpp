@@ -0,0 +1,77 @@
+//*****************************************************************************
+// Copyright 2017-2019 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#include <iomanip>
+
+#include "ngraph/pass/pass_profile.hpp"
+
+using namespace std;
+using namespace ngraph;
+
+static thread_local pass::CompileProfiler* s_active_profiler = nullptr;
+
+void pass::PassProfile::write_csv_header(ostream& out)
+{
+    out << "pass,microseconds,nodes_before,nodes_after,nodes_visited,matchers_attempted,"
+           "matchers_matched,nodes_allocated\n";
+}
+
+void pass::PassProfile::write_csv(ostream& out) const
+{
+    // Template pass names may contain commas
+    out << "\"" << name << "\"," << microseconds << "," << nodes_before << "," << nodes_after
+        << "," << nodes_visited << "," << matchers_attempted << "," << matchers_matched << ","
+        << nodes_allocated << "\n";
+}
+
+ostream& pass::operator<<(ostream& out, const PassProfile& profile)
+{
+    out << setw(10) << profile.microseconds << "us " << profile.name << " nodes "
+        << profile.nodes_before << "->" << profile.nodes_after << " visited "
+        << profile.nodes_visited;
+    if (profile.matchers_attempted > 0)
+    {
+        out << " matchers " << profile.matchers_matched << "/" << profile.matchers_attempted;
+    }
+    out << " allocated " << profile.nodes_allocated;
+    return out;
+}
+
+pass::CompileProfiler::CompileProfiler()
+    : m_previous(s_active_profiler)
+{
+    s_active_profiler = this;
+}
+
+pass::CompileProfiler::~CompileProfiler()
+{
+    s_active_profiler = m_previous;
+}
+
+size_t pass::CompileProfiler::get_total_microseconds() const
+{
+    size_t total = 0;
+    for (const PassProfile& profile : m_pass_profiles)
+    {
+        total += profile.microseconds;
+    }
+    return total;
+}
+
+pass::CompileProfiler* pass::CompileProfiler::get_active()
+{
+    return s_active_profiler;
+}
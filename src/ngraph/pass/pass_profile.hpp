@@ -0,0 +1,87 @@
+//*****************************************************************************
+// Copyright 2017-2019 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#pragma once
+
+#include <cstddef>
+#include <ostream>
+#include <string>
+#include <vector>
+
+#include "ngraph/ngraph_visibility.hpp"
+
+namespace ngraph
+{
+    namespace pass
+    {
+        struct PassProfile;
+        class CompileProfiler;
+
+        NGRAPH_API
+        std::ostream& operator<<(std::ostream& out, const PassProfile& profile);
+    }
+}
+
+/// \brief Statistics collected for a single pass execution by pass::Manager::run_passes.
+struct NGRAPH_API ngraph::pass::PassProfile
+{
+    /// Demangled class name of the pass
+    std::string name;
+    /// Wall time spent in the pass, including visualization and serialization if enabled
+    size_t microseconds = 0;
+    /// Number of ops in the function(s) before and after the pass ran
+    size_t nodes_before = 0;
+    size_t nodes_after = 0;
+    /// Number of nodes the pass looked at. Passes that do not report visits themselves are
+    /// assumed to walk the graph once.
+    size_t nodes_visited = 0;
+    /// Number of pattern matchers tried and the number that matched (GraphRewrite passes)
+    size_t matchers_attempted = 0;
+    size_t matchers_matched = 0;
+    /// Number of Node objects constructed while the pass ran
+    size_t nodes_allocated = 0;
+
+    static void write_csv_header(std::ostream& out);
+    void write_csv(std::ostream& out) const;
+};
+
+/// \brief Collects the pass profiles of every pass::Manager run on the current thread for the
+///        lifetime of the object. This makes it possible to profile the pass pipelines that
+///        backends run internally, e.g.
+///
+///     pass::CompileProfiler profiler;
+///     auto exec = backend->compile(f);
+///     for (const pass::PassProfile& p : profiler.get_pass_profiles()) ...
+///
+///        Profilers nest; only the innermost one receives results.
+class NGRAPH_API ngraph::pass::CompileProfiler
+{
+public:
+    CompileProfiler();
+    ~CompileProfiler();
+    CompileProfiler(const CompileProfiler&) = delete;
+    CompileProfiler& operator=(const CompileProfiler&) = delete;
+
+    const std::vector<PassProfile>& get_pass_profiles() const { return m_pass_profiles; }
+    size_t get_total_microseconds() const;
+    void add(const PassProfile& profile) { m_pass_profiles.push_back(profile); }
+    /// \return The profiler active on the calling thread or nullptr
+    static CompileProfiler* get_active();
+
+private:
+    std::vector<PassProfile> m_pass_profiles;
+    CompileProfiler* m_previous;
+};
@@ -40,7 +40,9 @@ public:
     AlignedBuffer(size_t byte_size, size_t alignment = 64, Allocator* allocator = nullptr);
 
     AlignedBuffer();
-    ~AlignedBuffer();
+    // Virtual, buffers over memory that is released differently are deleted through a base
+    // pointer
+    virtual ~AlignedBuffer();
 
     AlignedBuffer(AlignedBuffer&& other);
     AlignedBuffer& operator=(AlignedBuffer&& other);
@@ -70,6 +72,9 @@ private:
     AlignedBuffer(const AlignedBuffer&) = delete;
     AlignedBuffer& operator=(const AlignedBuffer&) = delete;
 
+protected:
+    // Derived classes that wrap memory they manage themselves, such as mapped files, set
+    // m_aligned_buffer and m_byte_size and leave m_allocated_buffer null.
     Allocator* m_allocator;
     char* m_allocated_buffer;
     char* m_aligned_buffer;
@@ -26,6 +26,7 @@
 #include "ngraph/runtime/backend.hpp"
 #include "ngraph/runtime/backend_manager.hpp"
 #include "ngraph/runtime/dynamic/dynamic_backend.hpp"
+#include "ngraph/runtime/hybrid/hybrid_backend.hpp"
 #include "ngraph/util.hpp"
 
 using namespace std;
@@ -72,7 +73,22 @@ std::shared_ptr<ngraph::Node> runtime::Backend::get_backend_op(const std::string
 std::shared_ptr<runtime::Backend> runtime::Backend::create(const string& type,
                                                            bool must_support_dynamic)
 {
-    auto inner_backend = BackendManager::create_backend(type);
+    shared_ptr<runtime::Backend> inner_backend;
+    // "HYBRID:CPU,INTERPRETER" places every op on the first listed backend supporting it
+    const string hybrid_prefix = "HYBRID:";
+    if (type.compare(0, hybrid_prefix.size(), hybrid_prefix) == 0)
+    {
+        vector<shared_ptr<runtime::Backend>> backends;
+        for (auto& name : split(type.substr(hybrid_prefix.size()), ',', true))
+        {
+            backends.push_back(BackendManager::create_backend(name));
+        }
+        inner_backend = make_shared<hybrid::HybridBackend>(backends);
+    }
+    else
+    {
+        inner_backend = BackendManager::create_backend(type);
+    }
 
     if (!must_support_dynamic || inner_backend->supports_dynamic_tensors())
     {
@@ -0,0 +1,93 @@
+//*****************************************************************************
+// Copyright 2017-2019 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+
+#include <fstream>
+
+#include "ngraph/except.hpp"
+#include "ngraph/runtime/constant_loader.hpp"
+
+using namespace std;
+using namespace ngraph;
+
+namespace
+{
+    mutex s_stats_mutex;
+    runtime::ConstantLoader::Stats s_stats;
+
+    // Alignment of the loaded buffers, as for the data of eager Constants
+    constexpr size_t host_alignment = 64;
+}
+
+runtime::ConstantLoader::ConstantLoader(size_t size)
+    : m_size(size)
+{
+    lock_guard<mutex> lock(s_stats_mutex);
+    s_stats.constants_declared++;
+    s_stats.bytes_declared += size;
+}
+
+runtime::ConstantLoader::~ConstantLoader()
+{
+}
+
+shared_ptr<runtime::AlignedBuffer> runtime::ConstantLoader::get_data()
+{
+    lock_guard<mutex> lock(m_mutex);
+    shared_ptr<AlignedBuffer> data = m_data.lock();
+    if (!data)
+    {
+        data = make_shared<AlignedBuffer>(m_size, host_alignment);
+        load(data->get_ptr());
+        m_data = data;
+        lock_guard<mutex> stats_lock(s_stats_mutex);
+        s_stats.constants_loaded++;
+        s_stats.bytes_loaded += m_size;
+    }
+    return data;
+}
+
+runtime::ConstantLoader::Stats runtime::ConstantLoader::get_stats()
+{
+    lock_guard<mutex> lock(s_stats_mutex);
+    return s_stats;
+}
+
+void runtime::ConstantLoader::reset_stats()
+{
+    lock_guard<mutex> lock(s_stats_mutex);
+    s_stats = Stats();
+}
+
+runtime::FileConstantLoader::FileConstantLoader(const string& path, size_t offset, size_t size)
+    : ConstantLoader(size)
+    , m_path(path)
+    , m_offset(offset)
+{
+}
+
+void runtime::FileConstantLoader::load(void* data)
+{
+    ifstream in(m_path, ios_base::binary | ios_base::in);
+    in.seekg(m_offset, ios_base::beg);
+    in.read(static_cast<char*>(data), get_size());
+    if (!in)
+    {
+        throw ngraph_error("Failed to read " + to_string(get_size()) +
+                           " bytes of constant data at " + to_string(m_offset) + " in '" +
+                           m_path + "'");
+    }
+}
@@ -0,0 +1,97 @@
+//*****************************************************************************
+// Copyright 2017-2019 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+
+#pragma once
+
+#include <cstddef>
+#include <memory>
+#include <mutex>
+#include <string>
+
+#include "ngraph/runtime/aligned_buffer.hpp"
+
+namespace ngraph
+{
+    namespace runtime
+    {
+        class ConstantLoader;
+        class FileConstantLoader;
+    }
+}
+
+/// \brief Source of the data of an op::Constant that is only read when first used.
+///
+/// A Constant created with a loader holds no data until a kernel, a pass or the serializer
+/// first asks for it, so the weights of ops removed before compilation are never read.
+/// Clones of the Constant share the loader, which hands them all the same buffer. The loader
+/// only keeps a weak reference to it, so the data is released with the last Constant using it.
+///
+/// Process wide stats compare the bytes of all the lazy Constants created with the bytes
+/// actually loaded.
+class NGRAPH_API ngraph::runtime::ConstantLoader
+{
+public:
+    struct Stats
+    {
+        /// Number of loaders created
+        size_t constants_declared = 0;
+        /// Total bytes of all loaders created
+        size_t bytes_declared = 0;
+        /// Number of times data was loaded
+        size_t constants_loaded = 0;
+        /// Total bytes loaded
+        size_t bytes_loaded = 0;
+    };
+
+    /// \param size Size of the data in bytes
+    ConstantLoader(size_t size);
+    virtual ~ConstantLoader();
+
+    size_t get_size() const { return m_size; }
+    /// \brief Returns the data, loading it unless another Constant still holds it
+    std::shared_ptr<AlignedBuffer> get_data();
+
+    static Stats get_stats();
+    static void reset_stats();
+
+protected:
+    /// \brief Reads the get_size() bytes of data into `data`
+    virtual void load(void* data) = 0;
+
+private:
+    ConstantLoader(const ConstantLoader&) = delete;
+    ConstantLoader& operator=(const ConstantLoader&) = delete;
+
+    size_t m_size;
+    std::weak_ptr<AlignedBuffer> m_data;
+    std::mutex m_mutex;
+};
+
+/// \brief Loads the data of a Constant from a range of a file, such as a member of a cpio
+///        archive
+class NGRAPH_API ngraph::runtime::FileConstantLoader : public ConstantLoader
+{
+public:
+    FileConstantLoader(const std::string& path, size_t offset, size_t size);
+
+protected:
+    void load(void* data) override;
+
+private:
+    std::string m_path;
+    size_t m_offset;
+};
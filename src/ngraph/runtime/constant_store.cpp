@@ -0,0 +1,335 @@
+//*****************************************************************************
+// Copyright 2017-2019 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#include <cstdlib>
+#include <cstring>
+#include <iomanip>
+#include <sstream>
+
+#ifndef _WIN32
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+#include "ngraph/log.hpp"
+#include "ngraph/runtime/constant_store.hpp"
+
+using namespace std;
+using namespace ngraph;
+
+namespace
+{
+    // Hashes four independent 64 bit lanes so the multiplies can overlap; payloads are often
+    // hundreds of megabytes and are hashed once per Constant.
+    uint64_t hash_bytes(const void* data, size_t size)
+    {
+        const uint64_t prime = 0x9E3779B97F4A7C15ULL;
+        uint64_t lanes[4] = {size, prime, prime << 1, prime << 2};
+        const char* p = static_cast<const char*>(data);
+        size_t i = 0;
+        for (; i + 32 <= size; i += 32)
+        {
+            for (size_t lane = 0; lane < 4; lane++)
+            {
+                uint64_t word;
+                memcpy(&word, p + i + lane * 8, sizeof(word));
+                lanes[lane] = (lanes[lane] ^ word) * prime;
+                lanes[lane] ^= lanes[lane] >> 29;
+            }
+        }
+        uint64_t hash = lanes[0] ^ (lanes[1] * 3) ^ (lanes[2] * 5) ^ (lanes[3] * 7);
+        for (; i < size; i++)
+        {
+            hash = (hash ^ static_cast<unsigned char>(p[i])) * prime;
+        }
+        return hash ^ (hash >> 32);
+    }
+
+#ifndef _WIN32
+    /// \brief An AlignedBuffer backed by a mapping of a POSIX shared memory segment
+    class SharedMemoryBuffer : public runtime::AlignedBuffer
+    {
+    public:
+        SharedMemoryBuffer(void* address, size_t size)
+        {
+            m_aligned_buffer = static_cast<char*>(address);
+            m_byte_size = size;
+        }
+
+        ~SharedMemoryBuffer() { munmap(m_aligned_buffer, m_byte_size); }
+    };
+
+    string segment_name(const string& prefix, uint64_t hash, size_t size)
+    {
+        stringstream ss;
+        ss << (prefix.front() == '/' ? "" : "/") << prefix << "_" << hex << setw(16)
+           << setfill('0') << hash << "_" << dec << size;
+        return ss.str();
+    }
+
+    /// \brief Maps an existing segment read-only if it holds exactly data
+    shared_ptr<runtime::AlignedBuffer>
+        map_existing_segment(const string& name, const void* data, size_t size)
+    {
+        shared_ptr<runtime::AlignedBuffer> rc;
+        int fd = shm_open(name.c_str(), O_RDONLY, 0);
+        if (fd >= 0)
+        {
+            struct stat info;
+            if (fstat(fd, &info) == 0 && static_cast<size_t>(info.st_size) == size)
+            {
+                void* address = mmap(nullptr, size, PROT_READ, MAP_SHARED, fd, 0);
+                if (address != MAP_FAILED)
+                {
+                    if (memcmp(address, data, size) == 0)
+                    {
+                        rc = make_shared<SharedMemoryBuffer>(address, size);
+                    }
+                    else
+                    {
+                        munmap(address, size);
+                    }
+                }
+            }
+            close(fd);
+        }
+        return rc;
+    }
+
+    /// \brief Creates and fills a new segment. The mapping is made read-only once written.
+    shared_ptr<runtime::AlignedBuffer>
+        create_segment(const string& name, const void* data, size_t size)
+    {
+        shared_ptr<runtime::AlignedBuffer> rc;
+        int fd = shm_open(name.c_str(), O_CREAT | O_EXCL | O_RDWR, 0644);
+        if (fd >= 0)
+        {
+            void* address = MAP_FAILED;
+            if (ftruncate(fd, size) == 0)
+            {
+                address = mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+            }
+            close(fd);
+            if (address != MAP_FAILED)
+            {
+                memcpy(address, data, size);
+                mprotect(address, size, PROT_READ);
+                rc = make_shared<SharedMemoryBuffer>(address, size);
+            }
+            else
+            {
+                shm_unlink(name.c_str());
+            }
+        }
+        return rc;
+    }
+#endif
+}
+
+runtime::ConstantStore& runtime::ConstantStore::get()
+{
+    static ConstantStore s_store;
+    return s_store;
+}
+
+runtime::ConstantStore::ConstantStore()
+    : m_enabled(getenv("NGRAPH_CONSTANT_STORE") != nullptr)
+{
+    if (const char* prefix = getenv("NGRAPH_CONSTANT_STORE_SHM"))
+    {
+        m_enabled = true;
+        m_shared_memory_prefix = prefix;
+    }
+}
+
+void runtime::ConstantStore::set_shared_memory_prefix(const string& prefix)
+{
+    lock_guard<mutex> lock(m_mutex);
+    m_shared_memory_prefix = prefix;
+}
+
+string runtime::ConstantStore::get_shared_memory_prefix() const
+{
+    lock_guard<mutex> lock(m_mutex);
+    return m_shared_memory_prefix;
+}
+
+shared_ptr<runtime::AlignedBuffer> runtime::ConstantStore::intern(const void* data, size_t size)
+{
+    uint64_t hash = hash_bytes(data, size);
+    lock_guard<mutex> lock(m_mutex);
+    m_stats.lookups++;
+    m_stats.bytes_requested += size;
+    shared_ptr<AlignedBuffer> rc = find(hash, data, size);
+    if (rc)
+    {
+        m_stats.hits++;
+        m_stats.bytes_deduplicated += size;
+    }
+    else
+    {
+        rc = allocate(hash, data, size);
+        insert(hash, rc, size);
+    }
+    return rc;
+}
+
+shared_ptr<runtime::AlignedBuffer>
+    runtime::ConstantStore::intern(const shared_ptr<AlignedBuffer>& buffer, size_t size)
+{
+    uint64_t hash = hash_bytes(buffer->get_ptr(), size);
+    lock_guard<mutex> lock(m_mutex);
+    m_stats.lookups++;
+    m_stats.bytes_requested += size;
+    shared_ptr<AlignedBuffer> rc = find(hash, buffer->get_ptr(), size);
+    if (rc)
+    {
+        m_stats.hits++;
+        m_stats.bytes_deduplicated += size;
+    }
+    else
+    {
+        rc = m_shared_memory_prefix.empty() ? buffer : allocate(hash, buffer->get_ptr(), size);
+        insert(hash, rc, size);
+    }
+    return rc;
+}
+
+shared_ptr<runtime::AlignedBuffer>
+    runtime::ConstantStore::find(uint64_t hash, const void* data, size_t size)
+{
+    auto range = m_buffers.equal_range(hash);
+    for (auto it = range.first; it != range.second; ++it)
+    {
+        if (it->second.size == size)
+        {
+            shared_ptr<AlignedBuffer> buffer = it->second.buffer.lock();
+            if (buffer && memcmp(buffer->get_ptr(), data, size) == 0)
+            {
+                return buffer;
+            }
+        }
+    }
+    return nullptr;
+}
+
+shared_ptr<runtime::AlignedBuffer>
+    runtime::ConstantStore::allocate(uint64_t hash, const void* data, size_t size)
+{
+    shared_ptr<AlignedBuffer> rc;
+#ifndef _WIN32
+    if (!m_shared_memory_prefix.empty())
+    {
+        string name = segment_name(m_shared_memory_prefix, hash, size);
+        rc = map_existing_segment(name, data, size);
+        if (!rc)
+        {
+            rc = create_segment(name, data, size);
+            if (rc)
+            {
+                m_published_segments.push_back(name);
+            }
+        }
+        if (rc)
+        {
+            m_stats.shared_memory_segments++;
+        }
+        else
+        {
+            NGRAPH_DEBUG << "Shared memory segment " << name
+                         << " unavailable, using private memory";
+        }
+    }
+#endif
+    if (!rc)
+    {
+        rc = make_shared<AlignedBuffer>(size, 64);
+        memcpy(rc->get_ptr(), data, size);
+    }
+    return rc;
+}
+
+void runtime::ConstantStore::insert(uint64_t hash,
+                                    const shared_ptr<AlignedBuffer>& buffer,
+                                    size_t size)
+{
+    m_buffers.insert({hash, Entry{size, buffer}});
+    if (m_buffers.size() > m_purge_threshold)
+    {
+        purge_expired();
+        m_purge_threshold = max<size_t>(1024, m_buffers.size() * 2);
+    }
+}
+
+void runtime::ConstantStore::purge_expired()
+{
+    for (auto it = m_buffers.begin(); it != m_buffers.end();)
+    {
+        if (it->second.buffer.expired())
+        {
+            it = m_buffers.erase(it);
+        }
+        else
+        {
+            ++it;
+        }
+    }
+}
+
+size_t runtime::ConstantStore::get_buffer_count()
+{
+    lock_guard<mutex> lock(m_mutex);
+    purge_expired();
+    return m_buffers.size();
+}
+
+size_t runtime::ConstantStore::get_resident_bytes()
+{
+    lock_guard<mutex> lock(m_mutex);
+    purge_expired();
+    size_t rc = 0;
+    for (auto& entry : m_buffers)
+    {
+        rc += entry.second.size;
+    }
+    return rc;
+}
+
+runtime::ConstantStore::Stats runtime::ConstantStore::get_stats() const
+{
+    lock_guard<mutex> lock(m_mutex);
+    return m_stats;
+}
+
+void runtime::ConstantStore::reset_stats()
+{
+    lock_guard<mutex> lock(m_mutex);
+    m_stats = Stats();
+}
+
+void runtime::ConstantStore::remove_shared_memory_segments()
+{
+    lock_guard<mutex> lock(m_mutex);
+#ifndef _WIN32
+    for (const string& name : m_published_segments)
+    {
+        shm_unlink(name.c_str());
+    }
+#endif
+    m_published_segments.clear();
+}
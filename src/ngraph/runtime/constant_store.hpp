@@ -0,0 +1,123 @@
+//*****************************************************************************
+// Copyright 2017-2019 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "ngraph/runtime/aligned_buffer.hpp"
+
+namespace ngraph
+{
+    namespace runtime
+    {
+        class ConstantStore;
+    }
+}
+
+/// \brief Process wide, content addressed store for constant payloads.
+///
+/// When enabled, every op::Constant hands its data to the store, which returns an existing
+/// buffer holding the same bytes if there is one. Functions, clones and compiled executables
+/// that contain identical weights (including the layout converted constants the CPU backend
+/// creates) then share a single copy. The store only keeps weak references, so a buffer is
+/// released as soon as the last Constant using it is destroyed.
+///
+/// With a shared memory prefix set, new payloads are placed in named POSIX shared memory
+/// segments and payloads already published by another process are mapped read-only instead of
+/// being copied, so multiple worker processes serving the same weights map one copy. Mapped
+/// contents are always compared against the requested data before use, so hash collisions or
+/// a segment still being written by another process simply fall back to a private copy.
+/// Segments outlive the processes that created them; remove them with
+/// remove_shared_memory_segments() when the weights are no longer served.
+///
+/// The store is disabled by default. It can be enabled with set_enabled() or by setting the
+/// NGRAPH_CONSTANT_STORE environment variable. NGRAPH_CONSTANT_STORE_SHM=<prefix> additionally
+/// sets the shared memory prefix.
+class NGRAPH_API ngraph::runtime::ConstantStore
+{
+public:
+    struct Stats
+    {
+        /// Number of payloads handed to the store
+        size_t lookups = 0;
+        /// Number of payloads that were already present
+        size_t hits = 0;
+        /// Total bytes of all payloads handed to the store
+        size_t bytes_requested = 0;
+        /// Bytes that did not need a new buffer because they were already present
+        size_t bytes_deduplicated = 0;
+        /// Number of buffers mapped from, or published to, shared memory
+        size_t shared_memory_segments = 0;
+    };
+
+    static ConstantStore& get();
+
+    bool is_enabled() const { return m_enabled; }
+    void set_enabled(bool enabled) { m_enabled = enabled; }
+    /// \brief Sets the name prefix of the shared memory segments. An empty prefix, the default,
+    ///        keeps all payloads in private memory.
+    void set_shared_memory_prefix(const std::string& prefix);
+    std::string get_shared_memory_prefix() const;
+
+    /// \brief Returns a buffer holding a copy of data, shared with every other caller that
+    ///        interned the same bytes.
+    std::shared_ptr<AlignedBuffer> intern(const void* data, size_t size);
+    /// \brief Returns buffer, or an existing buffer holding the same first size bytes. If
+    ///        buffer is new it is registered so later payloads can share it.
+    std::shared_ptr<AlignedBuffer> intern(const std::shared_ptr<AlignedBuffer>& buffer,
+                                          size_t size);
+
+    /// \return Number of distinct buffers currently alive in the store
+    size_t get_buffer_count();
+    /// \return Bytes held by distinct buffers currently alive in the store
+    size_t get_resident_bytes();
+    Stats get_stats() const;
+    void reset_stats();
+    /// \brief Unlinks every shared memory segment this process published. Mappings that are
+    ///        already established remain valid.
+    void remove_shared_memory_segments();
+
+private:
+    struct Entry
+    {
+        size_t size;
+        std::weak_ptr<AlignedBuffer> buffer;
+    };
+
+    ConstantStore();
+    ConstantStore(const ConstantStore&) = delete;
+    ConstantStore& operator=(const ConstantStore&) = delete;
+
+    std::shared_ptr<AlignedBuffer> find(uint64_t hash, const void* data, size_t size);
+    std::shared_ptr<AlignedBuffer> allocate(uint64_t hash, const void* data, size_t size);
+    void insert(uint64_t hash, const std::shared_ptr<AlignedBuffer>& buffer, size_t size);
+    void purge_expired();
+
+    std::atomic<bool> m_enabled;
+    std::string m_shared_memory_prefix;
+    std::unordered_multimap<uint64_t, Entry> m_buffers;
+    std::vector<std::string> m_published_segments;
+    size_t m_purge_threshold = 1024;
+    Stats m_stats;
+    mutable std::mutex m_mutex;
+};
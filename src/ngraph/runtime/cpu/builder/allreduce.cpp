@@ -55,15 +55,25 @@ namespace ngraph
                         : node->get_friendly_name().c_str(),
                     count);
 
-                auto functor =
-                    [&, count, reduce_type, data_type, arg_buffer_index, out_buffer_index](
-                        CPURuntimeContext* ctx, CPUExecutionContext* /* ectx */) {
-                        get_distributed_interface()->all_reduce(ctx->buffer_data[arg_buffer_index],
-                                                                ctx->buffer_data[out_buffer_index],
-                                                                data_type,
-                                                                reduce_type,
-                                                                count);
-                    };
+                // The ops reusing the memory of the input or the output wait for the request, see
+                // CPU_ExternalFunction::build
+                auto request_index = external_function->add_distributed_request(node);
+                auto functor = [&,
+                                count,
+                                reduce_type,
+                                data_type,
+                                arg_buffer_index,
+                                out_buffer_index,
+                                request_index](CPURuntimeContext* ctx,
+                                               CPUExecutionContext* /* ectx */) {
+                    ctx->distributed_requests[request_index] =
+                        get_distributed_interface()->all_reduce_async(
+                            ctx->buffer_data[arg_buffer_index],
+                            ctx->buffer_data[out_buffer_index],
+                            data_type,
+                            reduce_type,
+                            count);
+                };
                 functors.emplace_back(functor);
             }
 
@@ -19,6 +19,7 @@
 #include "ngraph/op/argmax.hpp"
 #include "ngraph/runtime/cpu/cpu_builder.hpp"
 #include "ngraph/runtime/cpu/kernel/argmax.hpp"
+#include "ngraph/runtime/cpu/kernel/reduce_generic.hpp"
 
 using namespace std;
 using namespace ngraph;
@@ -203,7 +204,26 @@ namespace ngraph
                 }
                 else
                 {
-                    throw ngraph_error("Unsupported type in CPU Builder for ArgMax");
+                    std::function<decltype(runtime::cpu::kernel::argmax_generic<float>)> kernel;
+
+                    SELECT_KERNEL(kernel, element_type, runtime::cpu::kernel::argmax_generic);
+
+                    auto index_element_type = out[0].get_element_type();
+                    functor = [&,
+                               kernel,
+                               in_shape,
+                               axis,
+                               index_element_type,
+                               arg_buffer_index,
+                               out_buffer_index](CPURuntimeContext* ctx,
+                                                 CPUExecutionContext* ectx) {
+                        kernel(ctx->buffer_data[arg_buffer_index],
+                               ctx->buffer_data[out_buffer_index],
+                               in_shape,
+                               axis,
+                               index_element_type,
+                               ectx->arena);
+                    };
                 }
 
                 functors.emplace_back(functor);
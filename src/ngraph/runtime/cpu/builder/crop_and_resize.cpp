@@ -0,0 +1,99 @@
+//*****************************************************************************
+// Copyright 2017-2019 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#include "ngraph/runtime/cpu/kernel/crop_and_resize.hpp"
+#include "ngraph/op/crop_and_resize.hpp"
+#include "ngraph/runtime/cpu/cpu_builder.hpp"
+
+using namespace std;
+using namespace ngraph;
+
+namespace ngraph
+{
+    namespace runtime
+    {
+        namespace cpu
+        {
+            template <>
+            void Builder::BUILDER_DECL(ngraph::op::CropAndResize)
+            {
+                auto crop_and_resize = static_cast<const ngraph::op::CropAndResize*>(node);
+                auto& functors = external_function->get_functors();
+
+                auto image_buffer_index = external_function->get_buffer_index(args[0].get_name());
+                auto boxes_buffer_index = external_function->get_buffer_index(args[1].get_name());
+                auto box_indices_buffer_index =
+                    external_function->get_buffer_index(args[2].get_name());
+                auto out_buffer_index = external_function->get_buffer_index(out[0].get_name());
+                auto image_shape = args[0].get_shape();
+                auto out_shape = out[0].get_shape();
+                auto resize_method = crop_and_resize->get_resize_method();
+                auto extrapolation_value = crop_and_resize->get_extrapolation_value();
+
+                std::function<decltype(
+                    runtime::cpu::kernel::crop_and_resize<float, float, int32_t>)>
+                    kernel;
+                if (args[0].get_element_type() != element::f32 ||
+                    args[1].get_element_type() != element::f32)
+                {
+                    throw ngraph_error("Unsupported element types " +
+                                       args[0].get_element_type().get_type_name() + " image and " +
+                                       args[1].get_element_type().get_type_name() +
+                                       " boxes for CropAndResize");
+                }
+                if (args[2].get_element_type() == element::i32)
+                {
+                    kernel = runtime::cpu::kernel::crop_and_resize<float, float, int32_t>;
+                }
+                else if (args[2].get_element_type() == element::i64)
+                {
+                    kernel = runtime::cpu::kernel::crop_and_resize<float, float, int64_t>;
+                }
+                else
+                {
+                    throw ngraph_error("Unsupported box index element type " +
+                                       args[2].get_element_type().get_type_name() +
+                                       " for CropAndResize");
+                }
+
+                auto functor = [&,
+                                kernel,
+                                image_buffer_index,
+                                boxes_buffer_index,
+                                box_indices_buffer_index,
+                                out_buffer_index,
+                                image_shape,
+                                out_shape,
+                                resize_method,
+                                extrapolation_value](CPURuntimeContext* ctx,
+                                                     CPUExecutionContext* ectx) {
+                    kernel(ctx->buffer_data[image_buffer_index],
+                           ctx->buffer_data[boxes_buffer_index],
+                           ctx->buffer_data[box_indices_buffer_index],
+                           ctx->buffer_data[out_buffer_index],
+                           image_shape,
+                           out_shape,
+                           resize_method,
+                           extrapolation_value,
+                           ectx->arena);
+                };
+                functors.emplace_back(functor);
+            }
+
+            void register_builders_crop_and_resize_cpp() { REGISTER_OP_BUILDER(CropAndResize); }
+        }
+    }
+}
@@ -0,0 +1,100 @@
+//*****************************************************************************
+// Copyright 2017-2019 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#include "ngraph/runtime/cpu/kernel/gather_tree.hpp"
+#include "ngraph/op/gather_tree.hpp"
+#include "ngraph/runtime/cpu/cpu_builder.hpp"
+
+using namespace std;
+using namespace ngraph;
+
+namespace ngraph
+{
+    namespace runtime
+    {
+        namespace cpu
+        {
+            template <>
+            void Builder::BUILDER_DECL(ngraph::op::v1::GatherTree)
+            {
+                auto& functors = external_function->get_functors();
+
+                auto step_ids_buffer_index =
+                    external_function->get_buffer_index(args[0].get_name());
+                auto parent_ids_buffer_index =
+                    external_function->get_buffer_index(args[1].get_name());
+                auto max_seq_len_buffer_index =
+                    external_function->get_buffer_index(args[2].get_name());
+                auto end_token_buffer_index =
+                    external_function->get_buffer_index(args[3].get_name());
+                auto out_buffer_index = external_function->get_buffer_index(out[0].get_name());
+                auto shape = args[0].get_shape();
+
+                auto element_type = args[0].get_element_type();
+                for (size_t i = 1; i < args.size(); i++)
+                {
+                    if (args[i].get_element_type() != element_type)
+                    {
+                        throw ngraph_error("GatherTree inputs must have the same element type");
+                    }
+                }
+
+                std::function<decltype(runtime::cpu::kernel::gather_tree<float>)> kernel;
+                if (element_type == element::f32)
+                {
+                    kernel = runtime::cpu::kernel::gather_tree<float>;
+                }
+                else if (element_type == element::f64)
+                {
+                    kernel = runtime::cpu::kernel::gather_tree<double>;
+                }
+                else if (element_type == element::i32)
+                {
+                    kernel = runtime::cpu::kernel::gather_tree<int32_t>;
+                }
+                else if (element_type == element::i64)
+                {
+                    kernel = runtime::cpu::kernel::gather_tree<int64_t>;
+                }
+                else
+                {
+                    throw ngraph_error("Unsupported element type " +
+                                       element_type.c_type_string() + " for GatherTree");
+                }
+
+                auto functor = [&,
+                                kernel,
+                                step_ids_buffer_index,
+                                parent_ids_buffer_index,
+                                max_seq_len_buffer_index,
+                                end_token_buffer_index,
+                                out_buffer_index,
+                                shape](CPURuntimeContext* ctx, CPUExecutionContext* ectx) {
+                    kernel(ctx->buffer_data[step_ids_buffer_index],
+                           ctx->buffer_data[parent_ids_buffer_index],
+                           ctx->buffer_data[max_seq_len_buffer_index],
+                           ctx->buffer_data[end_token_buffer_index],
+                           ctx->buffer_data[out_buffer_index],
+                           shape,
+                           ectx->arena);
+                };
+                functors.emplace_back(functor);
+            }
+
+            void register_builders_gather_tree_cpp() { REGISTER_OP_BUILDER(v1::GatherTree); }
+        }
+    }
+}
@@ -0,0 +1,81 @@
+//*****************************************************************************
+// Copyright 2017-2019 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#include "ngraph/runtime/cpu/kernel/interpolate.hpp"
+#include "ngraph/op/experimental/layers/interpolate.hpp"
+#include "ngraph/runtime/cpu/cpu_builder.hpp"
+
+using namespace std;
+using namespace ngraph;
+
+namespace ngraph
+{
+    namespace runtime
+    {
+        namespace cpu
+        {
+            namespace
+            {
+                template <typename T>
+                CPUKernelFunctor prepare_functor(const Node* node,
+                                                 const vector<TensorViewWrapper>& args,
+                                                 const vector<TensorViewWrapper>& out,
+                                                 CPU_ExternalFunction* external_function)
+                {
+                    auto interpolate = static_cast<const ngraph::op::Interpolate*>(node);
+                    auto arg_buffer_index = external_function->get_buffer_index(args[0].get_name());
+                    auto out_buffer_index = external_function->get_buffer_index(out[0].get_name());
+
+                    // The sampling tables only depend on the shapes
+                    auto plan = make_shared<runtime::cpu::kernel::InterpolatePlan<T>>(
+                        args[0].get_shape(), out[0].get_shape(), interpolate->get_attrs());
+
+                    return [&, plan, arg_buffer_index, out_buffer_index](
+                        CPURuntimeContext* ctx, CPUExecutionContext* ectx) {
+                        runtime::cpu::kernel::interpolate<T>(ctx->buffer_data[arg_buffer_index],
+                                                             ctx->buffer_data[out_buffer_index],
+                                                             *plan,
+                                                             ectx->arena);
+                    };
+                }
+            }
+
+            template <>
+            void Builder::BUILDER_DECL(ngraph::op::Interpolate)
+            {
+                auto& functors = external_function->get_functors();
+                if (args[0].get_element_type() == element::f32)
+                {
+                    functors.emplace_back(
+                        prepare_functor<float>(node, args, out, external_function));
+                }
+                else if (args[0].get_element_type() == element::f64)
+                {
+                    functors.emplace_back(
+                        prepare_functor<double>(node, args, out, external_function));
+                }
+                else
+                {
+                    throw ngraph_error("Unsupported element type " +
+                                       args[0].get_element_type().c_type_string() +
+                                       " for Interpolate");
+                }
+            }
+
+            void register_builders_interpolate_cpp() { REGISTER_OP_BUILDER(Interpolate); }
+        }
+    }
+}
@@ -0,0 +1,112 @@
+//*****************************************************************************
+// Copyright 2017-2019 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#include "ngraph/op/non_max_suppression.hpp"
+#include "ngraph/runtime/cpu/cpu_builder.hpp"
+#include "ngraph/runtime/cpu/kernel/non_max_suppression.hpp"
+#include "ngraph/runtime/reference/non_max_suppression.hpp"
+
+using namespace std;
+using namespace ngraph;
+
+namespace ngraph
+{
+    namespace runtime
+    {
+        namespace cpu
+        {
+            template <>
+            void Builder::BUILDER_DECL(ngraph::op::v1::NonMaxSuppression)
+            {
+                auto nms = static_cast<const ngraph::op::v1::NonMaxSuppression*>(node);
+                auto& functors = external_function->get_functors();
+
+                auto boxes_buffer_index = external_function->get_buffer_index(args[0].get_name());
+                auto scores_buffer_index = external_function->get_buffer_index(args[1].get_name());
+                auto max_boxes_buffer_index =
+                    external_function->get_buffer_index(args[2].get_name());
+                auto iou_threshold_buffer_index =
+                    external_function->get_buffer_index(args[3].get_name());
+                auto score_threshold_buffer_index =
+                    external_function->get_buffer_index(args[4].get_name());
+                auto out_buffer_index = external_function->get_buffer_index(out[0].get_name());
+
+                auto scores_shape = args[1].get_shape();
+                auto output_rows = out[0].get_shape()[0];
+                auto max_boxes_type = args[2].get_element_type();
+                auto iou_threshold_type = args[3].get_element_type();
+                auto score_threshold_type = args[4].get_element_type();
+                auto box_encoding = nms->get_box_encoding();
+                auto sort_result_descending = nms->get_sort_result_descending();
+
+                std::function<decltype(runtime::cpu::kernel::non_max_suppression<float>)> kernel;
+                if (args[0].get_element_type() == element::f32)
+                {
+                    kernel = runtime::cpu::kernel::non_max_suppression<float>;
+                }
+                else if (args[0].get_element_type() == element::f64)
+                {
+                    kernel = runtime::cpu::kernel::non_max_suppression<double>;
+                }
+                else
+                {
+                    throw ngraph_error("Unsupported element type " +
+                                       args[0].get_element_type().c_type_string() +
+                                       " for NonMaxSuppression");
+                }
+
+                auto functor = [&,
+                                kernel,
+                                boxes_buffer_index,
+                                scores_buffer_index,
+                                max_boxes_buffer_index,
+                                iou_threshold_buffer_index,
+                                score_threshold_buffer_index,
+                                out_buffer_index,
+                                scores_shape,
+                                output_rows,
+                                max_boxes_type,
+                                iou_threshold_type,
+                                score_threshold_type,
+                                box_encoding,
+                                sort_result_descending](CPURuntimeContext* ctx,
+                                                        CPUExecutionContext* ectx) {
+                    kernel(ctx->buffer_data[boxes_buffer_index],
+                           ctx->buffer_data[scores_buffer_index],
+                           ctx->buffer_data[out_buffer_index],
+                           scores_shape,
+                           output_rows,
+                           reference::non_max_suppression_scalar<int64_t>(
+                               ctx->buffer_data[max_boxes_buffer_index], max_boxes_type),
+                           reference::non_max_suppression_scalar<float>(
+                               ctx->buffer_data[iou_threshold_buffer_index], iou_threshold_type),
+                           reference::non_max_suppression_scalar<float>(
+                               ctx->buffer_data[score_threshold_buffer_index],
+                               score_threshold_type),
+                           box_encoding,
+                           sort_result_descending,
+                           ectx->arena);
+                };
+                functors.emplace_back(functor);
+            }
+
+            void register_builders_non_max_suppression_cpp()
+            {
+                REGISTER_OP_BUILDER(v1::NonMaxSuppression);
+            }
+        }
+    }
+}
@@ -19,8 +19,7 @@
 #include "ngraph/runtime/backend.hpp"
 #include "ngraph/runtime/cpu/cpu_builder.hpp"
 #include "ngraph/runtime/cpu/cpu_external_function.hpp"
-#include "ngraph/runtime/reference/all.hpp"
-#include "ngraph/runtime/reference/any.hpp"
+#include "ngraph/runtime/cpu/kernel/reduce_generic.hpp"
 #include "ngraph/runtime/tensor.hpp"
 
 using namespace std;
@@ -41,19 +40,16 @@ namespace ngraph
                 auto out_buffer_index = external_function->get_buffer_index(out[0].get_name());
 
                 auto arg0_shape = args[0].get_shape();
-                auto out_shape = out[0].get_shape();
 
                 auto reduction_axes = reduce->get_reduction_axes();
-                auto functor =
-                    [&, arg0_shape, out_shape, reduction_axes, arg0_buffer_index, out_buffer_index](
-                        CPURuntimeContext* ctx, CPUExecutionContext* /* ectx */) {
-                        runtime::reference::any(
-                            static_cast<char*>(ctx->buffer_data[arg0_buffer_index]),
-                            static_cast<char*>(ctx->buffer_data[out_buffer_index]),
-                            arg0_shape,
-                            out_shape,
-                            reduction_axes);
-                    };
+                auto functor = [&, arg0_shape, reduction_axes, arg0_buffer_index, out_buffer_index](
+                    CPURuntimeContext* ctx, CPUExecutionContext* ectx) {
+                    runtime::cpu::kernel::reduce_any_generic(ctx->buffer_data[arg0_buffer_index],
+                                                             ctx->buffer_data[out_buffer_index],
+                                                             arg0_shape,
+                                                             reduction_axes,
+                                                             ectx->arena);
+                };
                 functors.emplace_back(functor);
             }
 
@@ -66,19 +62,16 @@ namespace ngraph
                 auto out_buffer_index = external_function->get_buffer_index(out[0].get_name());
 
                 auto arg0_shape = args[0].get_shape();
-                auto out_shape = out[0].get_shape();
 
                 auto reduction_axes = reduce->get_reduction_axes();
-                auto functor =
-                    [&, arg0_shape, out_shape, reduction_axes, arg0_buffer_index, out_buffer_index](
-                        CPURuntimeContext* ctx, CPUExecutionContext* /* ectx */) {
-                        runtime::reference::all(
-                            static_cast<char*>(ctx->buffer_data[arg0_buffer_index]),
-                            static_cast<char*>(ctx->buffer_data[out_buffer_index]),
-                            arg0_shape,
-                            out_shape,
-                            reduction_axes);
-                    };
+                auto functor = [&, arg0_shape, reduction_axes, arg0_buffer_index, out_buffer_index](
+                    CPURuntimeContext* ctx, CPUExecutionContext* ectx) {
+                    runtime::cpu::kernel::reduce_all_generic(ctx->buffer_data[arg0_buffer_index],
+                                                             ctx->buffer_data[out_buffer_index],
+                                                             arg0_shape,
+                                                             reduction_axes,
+                                                             ectx->arena);
+                };
                 functors.emplace_back(functor);
             }
 
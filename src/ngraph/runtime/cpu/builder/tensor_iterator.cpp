@@ -0,0 +1,394 @@
+//*****************************************************************************
+// Copyright 2017-2019 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#include <cstring>
+
+#include "ngraph/graph_util.hpp"
+#include "ngraph/op/tensor_iterator.hpp"
+#include "ngraph/runtime/aligned_buffer.hpp"
+#include "ngraph/runtime/allocator.hpp"
+#include "ngraph/runtime/cpu/cpu_builder.hpp"
+#include "ngraph/runtime/cpu/cpu_call_frame.hpp"
+
+using namespace std;
+using namespace ngraph;
+
+namespace
+{
+    // The slices of a tensor along an axis, one per iteration. The borders of the sliced range
+    // are included; a negative stride walks the range backwards from `start`.
+    struct SliceLayout
+    {
+        SliceLayout(const Shape& shape,
+                    const element::Type& element_type,
+                    int64_t start,
+                    int64_t stride,
+                    int64_t part_size,
+                    int64_t axis)
+            : stride(stride)
+            , part_size(part_size)
+        {
+            int64_t dim_size = shape.at(axis);
+            this->start = start < 0 ? dim_size + start : start;
+            outer = 1;
+            for (int64_t i = 0; i < axis; i++)
+            {
+                outer *= shape[i];
+            }
+            element_bytes = element_type.size();
+            for (size_t i = axis + 1; i < shape.size(); i++)
+            {
+                element_bytes *= shape[i];
+            }
+            part_bytes = part_size * element_bytes;
+            axis_bytes = dim_size * element_bytes;
+        }
+
+        size_t offset(int64_t iteration) const
+        {
+            int64_t first = start + iteration * stride;
+            if (stride < 0)
+            {
+                first -= part_size - 1;
+            }
+            return first * element_bytes;
+        }
+
+        // A slice that is a single block of memory is used in place
+        bool is_contiguous() const { return outer == 1; }
+        void gather(char* slice, const char* full, int64_t iteration) const
+        {
+            full += offset(iteration);
+            for (size_t i = 0; i < outer; i++)
+            {
+                memcpy(slice + i * part_bytes, full + i * axis_bytes, part_bytes);
+            }
+        }
+
+        void scatter(char* full, const char* slice, int64_t iteration) const
+        {
+            full += offset(iteration);
+            for (size_t i = 0; i < outer; i++)
+            {
+                memcpy(full + i * axis_bytes, slice + i * part_bytes, part_bytes);
+            }
+        }
+
+        int64_t start;
+        int64_t stride;
+        int64_t part_size;
+        size_t outer;
+        size_t element_bytes;
+        size_t part_bytes;
+        size_t axis_bytes;
+    };
+
+    struct SlicedInput
+    {
+        size_t parameter;
+        size_t buffer_index;
+        SliceLayout layout;
+        // Where non-contiguous slices are gathered
+        size_t scratch_offset;
+    };
+
+    struct MergedInput
+    {
+        size_t parameter;
+        size_t buffer_index;
+        // The body result that supplies the successive values
+        size_t result;
+    };
+
+    struct InvariantInput
+    {
+        size_t parameter;
+        size_t buffer_index;
+    };
+
+    struct ConcatOutput
+    {
+        size_t buffer_index;
+        SliceLayout layout;
+    };
+
+    struct IterationOutput
+    {
+        size_t buffer_index;
+        int64_t iteration;
+    };
+
+    struct BodyResult
+    {
+        size_t byte_size;
+        // Two buffers, so that a back-edge can be read while the next value is written
+        size_t scratch_offset;
+        std::vector<ConcatOutput> concat_outputs;
+        // A contiguous concatenated output the result is written to directly, if any
+        int direct_concat_output = -1;
+        std::vector<IterationOutput> iteration_outputs;
+    };
+
+    size_t allocate_scratch(size_t& scratch_size, size_t byte_size)
+    {
+        size_t alignment = 64;
+        size_t offset = scratch_size;
+        scratch_size += (byte_size + alignment - 1) / alignment * alignment;
+        return offset;
+    }
+}
+
+namespace ngraph
+{
+    namespace runtime
+    {
+        namespace cpu
+        {
+            template <>
+            void Builder::BUILDER_DECL(ngraph::op::TensorIterator)
+            {
+                auto ti = static_cast<const ngraph::op::TensorIterator*>(node);
+                auto& functors = external_function->get_functors();
+
+                int64_t num_iterations = ti->get_num_iterations();
+                NGRAPH_CHECK(num_iterations >= 0,
+                             "TensorIterator ",
+                             ti->get_name(),
+                             " has an unknown number of iterations");
+
+                // The body is compiled once, and called on every iteration
+                auto body = ti->get_body();
+                auto body_function =
+                    clone_function(Function(body->get_results(), body->get_parameters()));
+                // The body is called with raw pointers, which skips the reorders of MKLDNN
+                // layouts done by CPU_CallFrame::call, so its results must be in native layout
+                for (auto& result : body_function->get_results())
+                {
+                    result->set_needs_default_layout(true);
+                }
+                // Invariant inputs do not change between iterations. Cacheable parameters keep
+                // the ops that only depend on them from being recomputed, and their outputs from
+                // being overwritten when the body reuses memory.
+                for (auto& description : ti->get_input_descriptions())
+                {
+                    if (is_type<ngraph::op::TensorIterator::InvariantInputDescription>(
+                            description))
+                    {
+                        body_function->get_parameters()
+                            .at(description->m_body_parameter_index)
+                            ->set_cacheable(true);
+                    }
+                }
+                auto body_external_function = make_shared<CPU_ExternalFunction>(body_function);
+                ngraph::pass::PassConfig body_pass_config = external_function->get_pass_config();
+                auto body_call_frame = body_external_function->make_call_frame(
+                    body_pass_config, runtime::get_default_allocator());
+
+                size_t scratch_size = 0;
+                vector<SlicedInput> sliced_inputs;
+                vector<MergedInput> merged_inputs;
+                vector<InvariantInput> invariant_inputs;
+                for (auto& description : ti->get_input_descriptions())
+                {
+                    size_t parameter = description->m_body_parameter_index;
+                    size_t buffer_index = external_function->get_buffer_index(
+                        args[description->m_input_index].get_name());
+                    if (auto slice = as_type_ptr<ngraph::op::TensorIterator::SliceInputDescription>(
+                            description))
+                    {
+                        SliceLayout layout(args[slice->m_input_index].get_shape(),
+                                           args[slice->m_input_index].get_element_type(),
+                                           slice->m_start,
+                                           slice->m_stride,
+                                           slice->m_part_size,
+                                           slice->m_axis);
+                        size_t scratch_offset =
+                            layout.is_contiguous()
+                                ? 0
+                                : allocate_scratch(scratch_size, layout.outer * layout.part_bytes);
+                        sliced_inputs.push_back({parameter, buffer_index, layout, scratch_offset});
+                    }
+                    else if (auto merged = as_type_ptr<
+                                 ngraph::op::TensorIterator::MergedInputDescription>(description))
+                    {
+                        merged_inputs.push_back(
+                            {parameter, buffer_index, merged->m_body_value_index});
+                    }
+                    else
+                    {
+                        invariant_inputs.push_back({parameter, buffer_index});
+                    }
+                }
+
+                vector<BodyResult> results(body_function->get_results().size());
+                for (size_t i = 0; i < results.size(); i++)
+                {
+                    auto& result = body_function->get_results()[i];
+                    results[i].byte_size =
+                        shape_size(result->get_shape()) * result->get_element_type().size();
+                    results[i].scratch_offset =
+                        allocate_scratch(scratch_size, 2 * results[i].byte_size);
+                }
+                for (auto& description : ti->get_output_descriptions())
+                {
+                    auto& result = results.at(description->m_body_value_index);
+                    auto& output = out[description->m_output_index];
+                    size_t buffer_index = external_function->get_buffer_index(output.get_name());
+                    if (auto concat =
+                            as_type_ptr<ngraph::op::TensorIterator::ConcatOutputDescription>(
+                                description))
+                    {
+                        SliceLayout layout(output.get_shape(),
+                                           output.get_element_type(),
+                                           concat->m_start,
+                                           concat->m_stride,
+                                           concat->m_part_size,
+                                           concat->m_axis);
+                        if (result.direct_concat_output < 0 && layout.is_contiguous())
+                        {
+                            result.direct_concat_output = result.concat_outputs.size();
+                        }
+                        result.concat_outputs.push_back({buffer_index, layout});
+                    }
+                    else
+                    {
+                        auto body_output = static_pointer_cast<
+                            ngraph::op::TensorIterator::BodyOutputDescription>(description);
+                        int64_t iteration = body_output->m_iteration < 0
+                                                ? num_iterations + body_output->m_iteration
+                                                : body_output->m_iteration;
+                        NGRAPH_CHECK(iteration >= 0 && iteration < num_iterations,
+                                     "TensorIterator ",
+                                     ti->get_name(),
+                                     " has no iteration ",
+                                     body_output->m_iteration);
+                        result.iteration_outputs.push_back({buffer_index, iteration});
+                    }
+                }
+
+                size_t parameter_count = body_function->get_parameters().size();
+                auto functor = [body_call_frame,
+                                num_iterations,
+                                scratch_size,
+                                parameter_count,
+                                sliced_inputs,
+                                merged_inputs,
+                                invariant_inputs,
+                                results](CPURuntimeContext* ctx,
+                                         CPUExecutionContext* /* ectx */) {
+                    runtime::AlignedBuffer scratch(scratch_size);
+                    char* scratch_data = scratch.get_ptr<char>();
+                    vector<void*> inputs(parameter_count);
+                    vector<void*> outputs(results.size());
+                    vector<bool> stale_inputs(parameter_count, true);
+                    for (auto& input : invariant_inputs)
+                    {
+                        inputs[input.parameter] = ctx->buffer_data[input.buffer_index];
+                    }
+
+                    for (int64_t i = 0; i < num_iterations; i++)
+                    {
+                        for (auto& input : sliced_inputs)
+                        {
+                            auto full = static_cast<char*>(ctx->buffer_data[input.buffer_index]);
+                            if (input.layout.is_contiguous())
+                            {
+                                inputs[input.parameter] = full + input.layout.offset(i);
+                            }
+                            else
+                            {
+                                char* slice = scratch_data + input.scratch_offset;
+                                input.layout.gather(slice, full, i);
+                                inputs[input.parameter] = slice;
+                            }
+                        }
+                        // Back-edges read where the previous iteration wrote its results
+                        for (auto& input : merged_inputs)
+                        {
+                            inputs[input.parameter] =
+                                i == 0 ? ctx->buffer_data[input.buffer_index]
+                                       : outputs[input.result];
+                        }
+
+                        for (size_t r = 0; r < results.size(); r++)
+                        {
+                            auto& result = results[r];
+                            void* destination = scratch_data + result.scratch_offset +
+                                                (i % 2) * result.byte_size;
+                            if (result.direct_concat_output >= 0)
+                            {
+                                auto& output = result.concat_outputs[result.direct_concat_output];
+                                destination = static_cast<char*>(
+                                                  ctx->buffer_data[output.buffer_index]) +
+                                              output.layout.offset(i);
+                            }
+                            else
+                            {
+                                for (auto& output : result.iteration_outputs)
+                                {
+                                    if (output.iteration == i)
+                                    {
+                                        destination = ctx->buffer_data[output.buffer_index];
+                                        break;
+                                    }
+                                }
+                            }
+                            outputs[r] = destination;
+                        }
+
+                        body_call_frame->call(outputs, inputs, stale_inputs);
+
+                        for (size_t r = 0; r < results.size(); r++)
+                        {
+                            auto& result = results[r];
+                            for (size_t c = 0; c < result.concat_outputs.size(); c++)
+                            {
+                                if (static_cast<int>(c) != result.direct_concat_output)
+                                {
+                                    auto& output = result.concat_outputs[c];
+                                    output.layout.scatter(
+                                        static_cast<char*>(ctx->buffer_data[output.buffer_index]),
+                                        static_cast<char*>(outputs[r]),
+                                        i);
+                                }
+                            }
+                            for (auto& output : result.iteration_outputs)
+                            {
+                                void* data = ctx->buffer_data[output.buffer_index];
+                                if (output.iteration == i && data != outputs[r])
+                                {
+                                    memcpy(data, outputs[r], result.byte_size);
+                                }
+                            }
+                        }
+
+                        // Ops that only depend on invariant inputs are not run again
+                        for (auto& input : invariant_inputs)
+                        {
+                            stale_inputs[input.parameter] = false;
+                        }
+                    }
+                };
+                functors.emplace_back(functor);
+            }
+
+            void register_builders_tensor_iterator_cpp()
+            {
+                REGISTER_OP_BUILDER(TensorIterator);
+            }
+        }
+    }
+}
@@ -22,8 +22,11 @@
 
 #include "ngraph/component_manager.hpp"
 #include "ngraph/graph_util.hpp"
+#include "ngraph/op/broadcast.hpp"
+#include "ngraph/op/stop_gradient.hpp"
 #include "ngraph/runtime/backend_manager.hpp"
 #include "ngraph/runtime/cpu/cpu_backend.hpp"
+#include "ngraph/runtime/cpu/cpu_builder.hpp"
 #include "ngraph/runtime/cpu/cpu_builder_registry.hpp"
 #include "ngraph/runtime/cpu/cpu_call_frame.hpp"
 #include "ngraph/runtime/cpu/cpu_external_function.hpp"
@@ -280,9 +283,27 @@ vector<shared_ptr<runtime::Tensor>>
     return result_tensors;
 }
 
-bool runtime::cpu::CPU_Backend::is_supported(const Node& /* op */) const
+bool runtime::cpu::CPU_Backend::is_supported(const Node& node) const
 {
-    return true;
+    if (node.is_parameter() || node.is_output() || node.is_constant())
+    {
+        return true;
+    }
+    // Fused ops are decomposed, and opset 1 ops downgraded to opset 0, before the kernels are
+    // built, so only the ops reaching the builders unchanged can be checked
+    if (node.supports_decompose() || node.get_type_info().version > 0)
+    {
+        return true;
+    }
+    // Ops replaced by LikeReplacement and NopElimination have no builder either
+    static const set<NodeTypeInfo> replaced_ops{op::BroadcastLike::type_info,
+                                                op::StopGradient::type_info};
+    if (replaced_ops.count(node.get_type_info()) > 0)
+    {
+        return true;
+    }
+    auto& dispatcher = GetGlobalBuildDispatcher();
+    return dispatcher.find(type_index(typeid(node))) != dispatcher.end();
 }
 bool runtime::cpu::CPU_Backend::is_supported_property(const Property prop) const
 {
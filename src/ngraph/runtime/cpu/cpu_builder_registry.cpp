@@ -36,6 +36,7 @@ namespace ngraph
                 register_builders_convert_cpp();
                 register_builders_convert_layout_cpp();
                 register_builders_convolution_cpp();
+                register_builders_crop_and_resize_cpp();
                 register_builders_cumsum_cpp();
                 register_builders_dot_cpp();
                 register_builders_dropout_cpp();
@@ -43,8 +44,10 @@ namespace ngraph
                 register_builders_erf_cpp();
                 register_builders_gather_cpp();
                 register_builders_gather_nd_cpp();
+                register_builders_gather_tree_cpp();
                 register_builders_gelu_cpp();
                 register_builders_get_output_element_cpp();
+                register_builders_interpolate_cpp();
                 register_builders_leaky_relu_cpp();
                 register_builders_lrn_cpp();
                 register_builders_lstm_cpp();
@@ -52,6 +55,7 @@ namespace ngraph
                 register_builders_max_cpp();
                 register_builders_max_pool_cpp();
                 register_builders_min_cpp();
+                register_builders_non_max_suppression_cpp();
                 register_builders_one_hot_cpp();
                 register_builders_pad_cpp();
                 register_builders_product_cpp();
@@ -75,6 +79,7 @@ namespace ngraph
                 register_builders_slice_cpp();
                 register_builders_softmax_cpp();
                 register_builders_sum_cpp();
+                register_builders_tensor_iterator_cpp();
                 register_builders_tile_cpp();
                 register_builders_topk_cpp();
                 register_builders_update_slice_cpp();
@@ -35,6 +35,7 @@ namespace ngraph
             void register_builders_convert_cpp();
             void register_builders_convert_layout_cpp();
             void register_builders_convolution_cpp();
+            void register_builders_crop_and_resize_cpp();
             void register_builders_cumsum_cpp();
             void register_builders_dot_cpp();
             void register_builders_dropout_cpp();
@@ -42,8 +43,10 @@ namespace ngraph
             void register_builders_erf_cpp();
             void register_builders_gather_cpp();
             void register_builders_gather_nd_cpp();
+            void register_builders_gather_tree_cpp();
             void register_builders_gelu_cpp();
             void register_builders_get_output_element_cpp();
+            void register_builders_interpolate_cpp();
             void register_builders_leaky_relu_cpp();
             void register_builders_lrn_cpp();
             void register_builders_lstm_cpp();
@@ -51,6 +54,7 @@ namespace ngraph
             void register_builders_max_cpp();
             void register_builders_max_pool_cpp();
             void register_builders_min_cpp();
+            void register_builders_non_max_suppression_cpp();
             void register_builders_one_hot_cpp();
             void register_builders_pad_cpp();
             void register_builders_product_cpp();
@@ -74,6 +78,7 @@ namespace ngraph
             void register_builders_slice_cpp();
             void register_builders_softmax_cpp();
             void register_builders_sum_cpp();
+            void register_builders_tensor_iterator_cpp();
             void register_builders_tile_cpp();
             void register_builders_topk_cpp();
             void register_builders_update_slice_cpp();
@@ -96,7 +96,13 @@ void runtime::cpu::CPU_CallFrame::inner_call(
             static_pointer_cast<runtime::cpu::CPUTensorView>(output_tvs[i]);
         outputs.push_back(tv->get_data_ptr());
     }
+    execute(outputs, inputs, id);
+}
 
+void runtime::cpu::CPU_CallFrame::execute(std::vector<void*>& outputs,
+                                          std::vector<void*>& inputs,
+                                          size_t id)
+{
     // Invoke compiled computation
     if (!m_external_function->is_direct_execution())
     {
@@ -115,12 +121,10 @@ void runtime::cpu::CPU_CallFrame::inner_call(
     }
 }
 
-void runtime::cpu::CPU_CallFrame::call(
-    const std::vector<std::shared_ptr<runtime::Tensor>>& output_tvs,
-    const std::vector<std::shared_ptr<runtime::Tensor>>& input_tvs)
+size_t runtime::cpu::CPU_CallFrame::acquire_context(bool& disable_caching)
 {
     size_t id = 0;
-    auto disable_caching = false;
+    disable_caching = false;
     {
         std::unique_lock<std::mutex> lck(m_mutex);
         while (m_num_ctx_available == 0)
@@ -147,11 +151,12 @@ void runtime::cpu::CPU_CallFrame::call(
         m_prev_ctx = id;
         m_num_ctx_available--;
     }
-
     m_ctx_vec[id]->pc = 0;
-    propagate_layouts(output_tvs, m_external_function->get_result_layout_descriptors());
-    inner_call(output_tvs, input_tvs, id, disable_caching);
+    return id;
+}
 
+void runtime::cpu::CPU_CallFrame::release_context(size_t id)
+{
     m_mutex.lock();
     m_id_pool[id] = true;
     m_num_ctx_available++;
@@ -159,6 +164,31 @@ void runtime::cpu::CPU_CallFrame::call(
     m_cv.notify_one();
 }
 
+void runtime::cpu::CPU_CallFrame::call(
+    const std::vector<std::shared_ptr<runtime::Tensor>>& output_tvs,
+    const std::vector<std::shared_ptr<runtime::Tensor>>& input_tvs)
+{
+    bool disable_caching;
+    size_t id = acquire_context(disable_caching);
+    propagate_layouts(output_tvs, m_external_function->get_result_layout_descriptors());
+    inner_call(output_tvs, input_tvs, id, disable_caching);
+    release_context(id);
+}
+
+void runtime::cpu::CPU_CallFrame::call(std::vector<void*>& outputs,
+                                       std::vector<void*>& inputs,
+                                       const std::vector<bool>& stale_inputs)
+{
+    bool disable_caching;
+    size_t id = acquire_context(disable_caching);
+    for (size_t i = 0; i < inputs.size(); i++)
+    {
+        m_ctx_vec[id]->p_en[i] = disable_caching || stale_inputs[i];
+    }
+    execute(outputs, inputs, id);
+    release_context(id);
+}
+
 void runtime::cpu::CPU_CallFrame::propagate_layouts(
     const std::vector<std::shared_ptr<runtime::Tensor>>& tvs,
     const LayoutDescriptorPtrs& layouts) const
@@ -233,6 +263,7 @@ void runtime::cpu::CPU_CallFrame::setup_runtime_context(Allocator* allocator)
         }
 
         ctx->states = m_external_function->m_states.data();
+        ctx->distributed_requests.resize(m_external_function->get_distributed_request_count());
 #if defined(NGRAPH_TBB_ENABLE)
         if (m_external_function->is_direct_execution() &&
             std::getenv("NGRAPH_CPU_USE_TBB") != nullptr)
@@ -70,6 +70,15 @@ namespace ngraph
                 void call(const std::vector<std::shared_ptr<runtime::Tensor>>& outputs,
                           const std::vector<std::shared_ptr<runtime::Tensor>>& inputs);
 
+                /// \brief Invoke the function on buffers in the native layout, as ops that run a
+                ///        nested function do.
+                ///
+                /// \param stale_inputs Whether each input changed since the previous call; ops
+                ///                     that only depend on unchanged inputs may be skipped.
+                void call(std::vector<void*>& outputs,
+                          std::vector<void*>& inputs,
+                          const std::vector<bool>& stale_inputs);
+
                 void propagate_layouts(const std::vector<std::shared_ptr<runtime::Tensor>>& tvs,
                                        const LayoutDescriptorPtrs& layouts) const;
 
@@ -86,6 +95,10 @@ namespace ngraph
                                 const std::vector<std::shared_ptr<runtime::Tensor>>& inputs,
                                 const size_t id,
                                 const bool disable_caching = true);
+                void execute(std::vector<void*>& outputs, std::vector<void*>& inputs, size_t id);
+                // Waits for a free runtime context and returns its id
+                size_t acquire_context(bool& disable_caching);
+                void release_context(size_t id);
 
                 std::shared_ptr<CPU_ExternalFunction> m_external_function;
 
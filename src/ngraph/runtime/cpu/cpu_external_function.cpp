@@ -16,7 +16,9 @@
 
 #include <cstdlib>
 #include <fstream>
+#include <limits>
 #include <memory>
+#include <set>
 #include <string>
 #include <tuple>
 #include <typeindex>
@@ -41,6 +43,7 @@
 
 #include "ngraph/descriptor/input.hpp"
 #include "ngraph/descriptor/output.hpp"
+#include "ngraph/distributed.hpp"
 #include "ngraph/file_util.hpp"
 #include "ngraph/function.hpp"
 #include "ngraph/graph_util.hpp"
@@ -141,6 +144,7 @@
 #include "ngraph/op/topk.hpp"
 #include "ngraph/op/xor.hpp"
 #include "ngraph/pass/algebraic_simplification.hpp"
+#include "ngraph/pass/allreduce_bucketing.hpp"
 #include "ngraph/pass/batch_fusion.hpp"
 #include "ngraph/pass/common_function_collection.hpp"
 #include "ngraph/pass/constant_folding.hpp"
@@ -150,6 +154,7 @@
 #include "ngraph/pass/fused_op_decomposition.hpp"
 #include "ngraph/pass/get_output_element_elimination.hpp"
 #include "ngraph/pass/implicit_broadcast_elimination.hpp"
+#include "ngraph/pass/in_place_elementwise.hpp"
 #include "ngraph/pass/like_replacement.hpp"
 #include "ngraph/pass/liveness.hpp"
 #include "ngraph/pass/manager.hpp"
@@ -1285,6 +1290,7 @@ void runtime::cpu::CPU_ExternalFunction::register_common_passes(
     REGISTER_KNOBBED_PASS(CPUQuantFusion, true, runtime::cpu::pass)
     REGISTER_KNOBBED_PASS(CPUHorizontalFusion, true, runtime::cpu::pass)
     REGISTER_KNOBBED_PASS(CPUCollapseDims, true, runtime::cpu::pass)
+    REGISTER_KNOBBED_PASS(AllReduceBucketing, true, ngraph::pass)
 #if defined(NGRAPH_HALIDE)
     REGISTER_KNOBBED_PASS(HalideSubgraphExtraction, true, ngraph::runtime::cpu::pass)
 #endif
@@ -1307,6 +1313,8 @@ void runtime::cpu::CPU_ExternalFunction::register_common_passes(
     REGISTER_KNOBBED_PASS(CPUConvertLayoutConstantFolding, true, runtime::cpu::pass)
     REGISTER_KNOBBED_PASS(CPUMemoryOptimization, true, runtime::cpu::pass)
     REGISTER_KNOBBED_PASS(GetOutputElementElimination, false, ngraph::pass)
+    REGISTER_KNOBBED_PASS_WITH_ARGS(
+        InPlaceElementwise, true, ngraph::pass, runtime::cpu::get_annotations_factory())
     REGISTER_KNOBBED_PASS_WITH_ARGS(
         PropagateCacheability, true, ngraph::pass, runtime::cpu::get_annotations_factory())
     bool reuse_memory = pass_config.get_pass_attribute("CPUMemoryAssignment::ReuseMemory") ||
@@ -1441,6 +1449,7 @@ void runtime::cpu::CPU_ExternalFunction::build(ngraph::pass::PassConfig& pass_co
     // stream writer to dump the debug manifest for the DEX
     static const string s_debug_dir = "cpu_codegen";
     static StaticInitializers s_static_initializers(s_debug_dir);
+    m_pass_config = pass_config;
     m_mkldnn_emitter.reset(new MKLDNNEmitter());
     ngraph::pass::Manager pass_manager;
     if (std::getenv("NGRAPH_ENABLE_VISUALIZE_TRACING"))
@@ -1586,6 +1595,46 @@ void runtime::cpu::CPU_ExternalFunction::build(ngraph::pass::PassConfig& pass_co
     // After processing inputs, outputs, constants, and intermediates, set the buffer size.
     m_buffer_size = buffer_index;
 
+    // The memory a tensor is in. Intermediates share the temporary pool, and the tensors of
+    // every other buffer set share the memory of that set.
+    struct MemoryRange
+    {
+        size_t buffer;
+        size_t begin;
+        size_t end;
+
+        bool overlaps(const MemoryRange& other) const
+        {
+            return buffer == other.buffer && begin < other.end && other.begin < end;
+        }
+    };
+    const size_t temporary_pool = numeric_limits<size_t>::max();
+    auto get_memory_range = [&](descriptor::Tensor* tensor, MemoryRange& range) {
+        auto buffer_it = tensor_to_bufferID.find(tensor);
+        if (buffer_it == tensor_to_bufferID.end())
+        {
+            return false;
+        }
+        bool is_intermediate =
+            bufferID_to_tensorSets.at(buffer_it->second).first == TensorRole::INTERMEDIATE;
+        range.buffer = is_intermediate ? temporary_pool : buffer_it->second;
+        range.begin = tensor->get_pool_offset();
+        range.end = range.begin + tensor->size();
+        return true;
+    };
+
+    // The memory read or written by asynchronous collectives, which is accessed until their
+    // requests complete. Memory reuse and in-place ops can hand it to later ops, so the ranges
+    // are kept for the whole call: an op skipped by caching does not wait, but neither does it
+    // touch the memory, and DistributedRequest::wait returns at once after the first call.
+    struct PendingRequest
+    {
+        MemoryRange range;
+        bool written;
+        size_t index;
+    };
+    vector<PendingRequest> pending_requests;
+
     for (shared_ptr<Node> node : m_function->get_ordered_ops())
     {
         if (node->is_parameter() || node->is_constant())
@@ -1624,10 +1673,70 @@ void runtime::cpu::CPU_ExternalFunction::build(ngraph::pass::PassConfig& pass_co
                 out.back().get_size(), out.back().get_shape(), out.back().get_element_type()));
         }
 
+        // The op waits for the collectives still writing the memory it reads, or accessing the
+        // memory it writes
+        set<size_t> requests_to_wait;
+        auto find_requests = [&](descriptor::Tensor* tensor, bool writes) {
+            MemoryRange range;
+            if (get_memory_range(tensor, range))
+            {
+                for (const PendingRequest& request : pending_requests)
+                {
+                    if ((writes || request.written) && range.overlaps(request.range))
+                    {
+                        requests_to_wait.insert(request.index);
+                    }
+                }
+            }
+        };
+        for (const descriptor::Input& input : node->get_inputs())
+        {
+            find_requests(input.get_output().get_tensor_ptr().get(), false);
+        }
+        for (const descriptor::Output& output : node->get_outputs())
+        {
+            find_requests(output.get_tensor_ptr().get(), true);
+        }
+
         m_op_attrs.emplace_back(node->description(), out_names, in_names, t_out_attrs, t_in_attrs);
         op_names.push_back(node->get_name());
+        size_t request_count = m_distributed_request_nodes.size();
         handler->second(this, node.get(), in, out);
 
+        for (size_t i = request_count; i < m_distributed_request_nodes.size(); i++)
+        {
+            MemoryRange range;
+            for (const descriptor::Input& input : node->get_inputs())
+            {
+                if (get_memory_range(input.get_output().get_tensor_ptr().get(), range))
+                {
+                    pending_requests.push_back({range, false, i});
+                }
+            }
+            for (const descriptor::Output& output : node->get_outputs())
+            {
+                if (get_memory_range(output.get_tensor_ptr().get(), range))
+                {
+                    pending_requests.push_back({range, true, i});
+                }
+            }
+        }
+        if (!requests_to_wait.empty())
+        {
+            auto functor = functors.back();
+            functors.back() = [functor, requests_to_wait](CPURuntimeContext* ctx,
+                                                          CPUExecutionContext* ectx) {
+                for (auto index : requests_to_wait)
+                {
+                    if (ctx->distributed_requests[index])
+                    {
+                        ctx->distributed_requests[index]->wait();
+                    }
+                }
+                functor(ctx, ectx);
+            };
+        }
+
         auto cacheable = true;
         auto reuse_memory = pass_config.get_pass_attribute("CPUMemoryAssignment::ReuseMemory") ||
                             pass_config.get_pass_attribute("ReuseMemory");
@@ -2004,6 +2113,15 @@ void runtime::cpu::CPU_ExternalFunction::build(ngraph::pass::PassConfig& pass_co
                 }
             }
         }
+        // Function outputs and the buffers of skipped consumers may still be written
+        for (auto& request : ctx->distributed_requests)
+        {
+            if (request)
+            {
+                request->wait();
+                request.reset();
+            }
+        }
         ctx->first_iteration = false;
         if (runtime::cpu::IsTracingEnabled())
         {
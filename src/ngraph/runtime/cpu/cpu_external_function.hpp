@@ -157,6 +157,20 @@ namespace ngraph
                     return m_states.size() - 1;
                 }
 
+                // Registers an asynchronous collective run by `node`, which reads its inputs and
+                // writes its outputs after its functor returns, and returns the index of its
+                // request in the runtime context. Later ops that write the memory of those
+                // inputs, or access the memory of those outputs, wait for the request first.
+                size_t add_distributed_request(const Node* node)
+                {
+                    m_distributed_request_nodes.push_back(node);
+                    return m_distributed_request_nodes.size() - 1;
+                }
+                size_t get_distributed_request_count() const
+                {
+                    return m_distributed_request_nodes.size();
+                }
+
                 const std::string& get_function_name() const { return m_function_name; }
                 const std::shared_ptr<ngraph::Function> get_function() { return m_function; }
                 // Temporary Memory Pool alignment
@@ -178,6 +192,9 @@ namespace ngraph
                     return callees;
                 }
                 bool is_direct_execution() const { return m_direct_execution; }
+                // The pass configuration the function is being built with, for the functions
+                // that ops like TensorIterator compile for themselves
+                const ngraph::pass::PassConfig& get_pass_config() const { return m_pass_config; }
                 void write_to_file(const std::string& code,
                                    const std::string& directory,
                                    const std::string& filename);
@@ -213,6 +230,7 @@ namespace ngraph
 #endif
 
                 std::vector<ngraph::State*> m_states;
+                std::vector<const Node*> m_distributed_request_nodes;
 
                 void dump_one_kernel(CPU_DebugTracer& debug_tracer,
                                      CPURuntimeContext* ctx,
@@ -342,6 +360,7 @@ namespace ngraph
                 size_t m_buffer_size = 0;
                 std::unordered_map<std::string, std::shared_ptr<CPU_ExternalFunction>> callees;
                 bool m_is_built;
+                ngraph::pass::PassConfig m_pass_config;
                 std::vector<runtime::PerformanceCounter> m_perf_counters;
 
 #if defined(NGRAPH_HALIDE)
@@ -18,7 +18,9 @@
 
 #include <chrono>
 #include <cstdint>
+#include <memory>
 #include <set>
+#include <vector>
 
 #if defined(NGRAPH_TBB_ENABLE)
 #define TBB_PREVIEW_GLOBAL_CONTROL 1
@@ -45,6 +47,7 @@ namespace ngraph
     {
         class AlignedBuffer;
     }
+    class DistributedRequest;
     class State;
 }
 
@@ -77,6 +80,8 @@ namespace ngraph
                 tbb::global_control* c;
 #endif
                 State* const* states;
+                // requests of the asynchronous collectives started during the current call
+                std::vector<std::shared_ptr<DistributedRequest>> distributed_requests;
                 std::set<size_t> breakpoints;
                 size_t pc;
 #ifdef NGRAPH_MLIR_ENABLE
@@ -0,0 +1,204 @@
+//*****************************************************************************
+// Copyright 2017-2019 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#pragma once
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <vector>
+
+#define EIGEN_USE_THREADS
+#include <unsupported/Eigen/CXX11/Tensor>
+
+#include "ngraph/except.hpp"
+#include "ngraph/op/crop_and_resize.hpp"
+#include "ngraph/runtime/cpu/cpu_executor.hpp"
+#include "ngraph/runtime/reference/crop_and_resize.hpp"
+#include "ngraph/shape.hpp"
+
+namespace ngraph
+{
+    namespace runtime
+    {
+        namespace cpu
+        {
+            namespace kernel
+            {
+                namespace crop_and_resize_detail
+                {
+                    // Where a crop row or column samples the image
+                    struct Sample
+                    {
+                        // Outside of the image, filled with the extrapolation value
+                        bool outside;
+                        size_t low;
+                        size_t high;
+                        float lerp;
+                    };
+
+                    inline void fill_samples(Sample* samples,
+                                             float start,
+                                             float end,
+                                             size_t crop_size,
+                                             size_t size,
+                                             bool nearest)
+                    {
+                        for (size_t i = 0; i < crop_size; i++)
+                        {
+                            float source = reference::crop_and_resize_source(
+                                start, end, i, crop_size, size);
+                            Sample& sample = samples[i];
+                            sample.outside = source < 0 || source > size - 1;
+                            if (sample.outside)
+                            {
+                                continue;
+                            }
+                            if (nearest)
+                            {
+                                sample.low = static_cast<size_t>(std::round(source));
+                                sample.high = sample.low;
+                                sample.lerp = 0;
+                            }
+                            else
+                            {
+                                sample.low = static_cast<size_t>(std::floor(source));
+                                sample.high = static_cast<size_t>(std::ceil(source));
+                                sample.lerp = source - sample.low;
+                            }
+                        }
+                    }
+                }
+
+                // Crops are NHWC, so every sample blends `depth` contiguous channels
+                template <typename T, typename B, typename I>
+                void crop_and_resize(const void* image,
+                                     const void* boxes,
+                                     const void* box_indices,
+                                     void* output,
+                                     const Shape& image_shape,
+                                     const Shape& out_shape,
+                                     op::CropAndResize::ResizeMethod resize_method,
+                                     float extrapolation_value,
+                                     int arena)
+                {
+                    using crop_and_resize_detail::Sample;
+                    const T* image_data = static_cast<const T*>(image);
+                    const B* box_data = static_cast<const B*>(boxes);
+                    const I* index_data = static_cast<const I*>(box_indices);
+                    T* out = static_cast<T*>(output);
+                    size_t batches = image_shape[0];
+                    size_t image_height = image_shape[1];
+                    size_t image_width = image_shape[2];
+                    size_t depth = image_shape[3];
+                    size_t num_boxes = out_shape[0];
+                    size_t crop_height = out_shape[1];
+                    size_t crop_width = out_shape[2];
+                    bool nearest = resize_method == op::CropAndResize::ResizeMethod::nearest;
+
+                    // The sampling tables of every box
+                    std::vector<Sample> rows(num_boxes * crop_height);
+                    std::vector<Sample> columns(num_boxes * crop_width);
+                    std::vector<const T*> box_images(num_boxes);
+                    for (size_t box = 0; box < num_boxes; box++)
+                    {
+                        auto batch = static_cast<int64_t>(index_data[box]);
+                        if (batch < 0 || batch >= static_cast<int64_t>(batches))
+                        {
+                            throw ngraph_error("CropAndResize box index out of range");
+                        }
+                        box_images[box] = image_data + batch * image_height * image_width * depth;
+                        const B* coordinates = box_data + 4 * box;
+                        crop_and_resize_detail::fill_samples(&rows[box * crop_height],
+                                                             static_cast<float>(coordinates[0]),
+                                                             static_cast<float>(coordinates[2]),
+                                                             crop_height,
+                                                             image_height,
+                                                             nearest);
+                        crop_and_resize_detail::fill_samples(&columns[box * crop_width],
+                                                             static_cast<float>(coordinates[1]),
+                                                             static_cast<float>(coordinates[3]),
+                                                             crop_width,
+                                                             image_width,
+                                                             nearest);
+                    }
+
+                    size_t row_size = crop_width * depth;
+                    Eigen::TensorOpCost cost(
+                        4 * row_size * sizeof(T), row_size * sizeof(T), 6 * row_size);
+                    auto& device = executor::GetCPUExecutor().get_device(arena);
+                    device.parallelFor(
+                        static_cast<Eigen::Index>(num_boxes * crop_height),
+                        cost,
+                        [&](Eigen::Index begin, Eigen::Index end) {
+                            for (Eigen::Index crop_row = begin; crop_row < end; crop_row++)
+                            {
+                                size_t box = crop_row / crop_height;
+                                const Sample& row = rows[crop_row];
+                                T* result = out + crop_row * row_size;
+                                if (row.outside)
+                                {
+                                    std::fill(result,
+                                              result + row_size,
+                                              static_cast<T>(extrapolation_value));
+                                    continue;
+                                }
+                                const T* top = box_images[box] + row.low * image_width * depth;
+                                const T* bottom = box_images[box] + row.high * image_width * depth;
+                                float y_lerp = row.lerp;
+                                for (size_t x = 0; x < crop_width; x++)
+                                {
+                                    const Sample& column = columns[box * crop_width + x];
+                                    T* pixel = result + x * depth;
+                                    if (column.outside)
+                                    {
+                                        std::fill(pixel,
+                                                  pixel + depth,
+                                                  static_cast<T>(extrapolation_value));
+                                        continue;
+                                    }
+                                    const T* top_left = top + column.low * depth;
+                                    if (nearest)
+                                    {
+                                        memcpy(pixel, top_left, depth * sizeof(T));
+                                        continue;
+                                    }
+                                    const T* top_right = top + column.high * depth;
+                                    const T* bottom_left = bottom + column.low * depth;
+                                    const T* bottom_right = bottom + column.high * depth;
+                                    float x_lerp = column.lerp;
+                                    for (size_t c = 0; c < depth; c++)
+                                    {
+                                        float top_value =
+                                            top_left[c] +
+                                            (static_cast<float>(top_right[c]) - top_left[c]) *
+                                                x_lerp;
+                                        float bottom_value =
+                                            bottom_left[c] +
+                                            (static_cast<float>(bottom_right[c]) -
+                                             bottom_left[c]) *
+                                                x_lerp;
+                                        pixel[c] = static_cast<T>(
+                                            top_value + (bottom_value - top_value) * y_lerp);
+                                    }
+                                }
+                            }
+                        });
+                }
+            }
+        }
+    }
+}
@@ -0,0 +1,161 @@
+//*****************************************************************************
+// Copyright 2017-2019 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#pragma once
+
+#include <algorithm>
+#include <cstdint>
+#include <vector>
+
+#define EIGEN_USE_THREADS
+#include <unsupported/Eigen/CXX11/Tensor>
+
+#include "ngraph/runtime/cpu/cpu_executor.hpp"
+#include "ngraph/shape.hpp"
+
+namespace ngraph
+{
+    namespace runtime
+    {
+        namespace cpu
+        {
+            namespace kernel
+            {
+                // Same results as reference::gather_tree. Every worker backtracks all the beams
+                // of a range of batches together, one time step at a time from the last one, so
+                // each step reads and writes contiguous rows of beams instead of striding
+                // through the whole tensor for every beam.
+                template <typename T>
+                void gather_tree(const void* step_ids,
+                                 const void* parent_ids,
+                                 const void* max_seq_len,
+                                 const void* end_token,
+                                 void* output,
+                                 const Shape& shape,
+                                 int arena)
+                {
+                    const T* steps = static_cast<const T*>(step_ids);
+                    const T* parents = static_cast<const T*>(parent_ids);
+                    const T* lengths = static_cast<const T*>(max_seq_len);
+                    T end = *static_cast<const T*>(end_token);
+                    T* out = static_cast<T*>(output);
+                    size_t max_time = shape[0];
+                    size_t batch_size = shape[1];
+                    size_t beam_width = shape[2];
+                    auto width = static_cast<int64_t>(beam_width);
+
+                    Eigen::TensorOpCost cost(2 * max_time * beam_width * sizeof(T),
+                                             max_time * beam_width * sizeof(T),
+                                             4 * max_time * beam_width);
+                    auto& device = executor::GetCPUExecutor().get_device(arena);
+                    device.parallelFor(
+                        static_cast<Eigen::Index>(batch_size),
+                        cost,
+                        [&](Eigen::Index first, Eigen::Index last) {
+                            auto begin = static_cast<size_t>(first);
+                            size_t batches = static_cast<size_t>(last) - begin;
+                            std::vector<size_t> length(batches);
+                            for (size_t b = 0; b < batches; b++)
+                            {
+                                auto sequence_length = static_cast<int64_t>(lengths[begin + b]);
+                                length[b] = static_cast<size_t>(std::max<int64_t>(
+                                    0,
+                                    std::min(sequence_length, static_cast<int64_t>(max_time))));
+                            }
+
+                            // The beam every path is at, and whether it hit an invalid parent
+                            std::vector<int64_t> beam(batches * beam_width);
+                            std::vector<char> broken(batches * beam_width);
+                            for (size_t level = max_time; level-- > 0;)
+                            {
+                                size_t row = (level * batch_size + begin) * beam_width;
+                                for (size_t b = 0; b < batches; b++)
+                                {
+                                    size_t offset = row + b * beam_width;
+                                    const T* step_row = steps + offset;
+                                    const T* parent_row = parents + offset;
+                                    T* result = out + offset;
+                                    int64_t* at = beam.data() + b * beam_width;
+                                    char* dead = broken.data() + b * beam_width;
+                                    if (level >= length[b])
+                                    {
+                                        std::fill(result, result + beam_width, end);
+                                    }
+                                    else if (level + 1 == length[b])
+                                    {
+                                        std::copy(step_row, step_row + beam_width, result);
+                                        for (size_t i = 0; i < beam_width; i++)
+                                        {
+                                            at[i] = static_cast<int64_t>(parent_row[i]);
+                                            dead[i] = 0;
+                                        }
+                                    }
+                                    else
+                                    {
+                                        for (size_t i = 0; i < beam_width; i++)
+                                        {
+                                            int64_t parent = at[i];
+                                            if (dead[i])
+                                            {
+                                                result[i] = end;
+                                            }
+                                            else if (parent < 0 || parent >= width)
+                                            {
+                                                result[i] = static_cast<T>(-1);
+                                                dead[i] = 1;
+                                            }
+                                            else
+                                            {
+                                                result[i] = step_row[parent];
+                                                at[i] = static_cast<int64_t>(parent_row[parent]);
+                                            }
+                                        }
+                                    }
+                                }
+                            }
+
+                            // Everything after the first end token of a path is end_token
+                            std::vector<char> finished(batches * beam_width);
+                            for (size_t level = 0; level < max_time; level++)
+                            {
+                                size_t row = (level * batch_size + begin) * beam_width;
+                                for (size_t b = 0; b < batches; b++)
+                                {
+                                    if (level >= length[b])
+                                    {
+                                        continue;
+                                    }
+                                    T* result = out + row + b * beam_width;
+                                    char* done = finished.data() + b * beam_width;
+                                    for (size_t i = 0; i < beam_width; i++)
+                                    {
+                                        if (done[i])
+                                        {
+                                            result[i] = end;
+                                        }
+                                        else if (!(result[i] < end) && !(end < result[i]))
+                                        {
+                                            done[i] = 1;
+                                        }
+                                    }
+                                }
+                            }
+                        });
+                }
+            }
+        }
+    }
+}
@@ -0,0 +1,307 @@
+//*****************************************************************************
+// Copyright 2017-2019 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#pragma once
+
+#include <cstring>
+#include <vector>
+
+#define EIGEN_USE_THREADS
+#include <unsupported/Eigen/CXX11/Tensor>
+
+#include "ngraph/check.hpp"
+#include "ngraph/op/experimental/layers/interpolate.hpp"
+#include "ngraph/runtime/cpu/cpu_executor.hpp"
+#include "ngraph/runtime/reference/interpolate.hpp"
+#include "ngraph/shape.hpp"
+
+namespace ngraph
+{
+    namespace runtime
+    {
+        namespace cpu
+        {
+            namespace kernel
+            {
+                // The sampling tables of an interpolation, computed once when the op is built.
+                // The axes from the first interpolated axis to the last one are resampled one
+                // after the other; the axes before them are independent rows of work, and the
+                // axes after them form a contiguous block, such as the channels of NHWC.
+                template <typename T>
+                struct InterpolatePlan
+                {
+                    struct Axis
+                    {
+                        // Not interpolated, between two interpolated axes
+                        bool identity;
+                        size_t taps;
+                        std::vector<size_t> indices;
+                        std::vector<T> weights;
+                        size_t in_size;
+                        size_t out_size;
+                        // Elements of one input and one output slice along this axis
+                        size_t in_stride;
+                        size_t out_stride;
+                    };
+
+                    InterpolatePlan(const Shape& arg_shape,
+                                    const Shape& out_shape,
+                                    const op::InterpolateAttrs& attrs)
+                    {
+                        NGRAPH_CHECK(!attrs.antialias,
+                                     "Antialiased interpolation is not supported");
+                        for (auto pad : attrs.pads_begin)
+                        {
+                            NGRAPH_CHECK(pad == 0, "Padded interpolation is not supported");
+                        }
+                        for (auto pad : attrs.pads_end)
+                        {
+                            NGRAPH_CHECK(pad == 0, "Padded interpolation is not supported");
+                        }
+
+                        outer = 1;
+                        inner = 1;
+                        if (attrs.axes.empty())
+                        {
+                            inner = shape_size(arg_shape);
+                            return;
+                        }
+                        size_t first = *attrs.axes.begin();
+                        size_t last = *attrs.axes.rbegin();
+                        for (size_t axis = 0; axis < first; axis++)
+                        {
+                            outer *= arg_shape[axis];
+                        }
+                        for (size_t axis = last + 1; axis < arg_shape.size(); axis++)
+                        {
+                            inner *= arg_shape[axis];
+                        }
+                        for (size_t axis = first; axis <= last; axis++)
+                        {
+                            Axis plan_axis;
+                            plan_axis.identity = attrs.axes.count(axis) == 0;
+                            plan_axis.in_size = arg_shape[axis];
+                            plan_axis.out_size = out_shape[axis];
+                            if (!plan_axis.identity)
+                            {
+                                auto taps = reference::interpolate_taps(arg_shape[axis],
+                                                                        out_shape[axis],
+                                                                        attrs.mode,
+                                                                        attrs.align_corners);
+                                plan_axis.taps = taps.taps;
+                                plan_axis.indices = taps.indices;
+                                plan_axis.weights.assign(taps.weights.begin(), taps.weights.end());
+                            }
+                            plan_axis.in_stride = inner;
+                            plan_axis.out_stride = inner;
+                            for (size_t i = axis + 1; i <= last; i++)
+                            {
+                                plan_axis.in_stride *= arg_shape[i];
+                                plan_axis.out_stride *= out_shape[i];
+                            }
+                            axes.push_back(plan_axis);
+                        }
+                    }
+
+                    size_t outer;
+                    std::vector<Axis> axes;
+                    size_t inner;
+                };
+
+                namespace interpolate_detail
+                {
+                    // Output elements `begin` to `end` of the row `arg`, along the last axis of the
+                    // plan. Taps are blended a contiguous block at a time, or gathered along the
+                    // row if the block is a single element.
+                    template <typename T>
+                    void resample_row(const InterpolatePlan<T>& plan,
+                                      const T* arg,
+                                      T* out,
+                                      size_t begin,
+                                      size_t end)
+                    {
+                        auto& axis = plan.axes.back();
+                        size_t inner = plan.inner;
+                        size_t taps = axis.taps;
+                        const size_t* indices = axis.indices.data();
+                        const T* weights = axis.weights.data();
+                        if (inner == 1)
+                        {
+                            for (size_t i = begin; i < end; i++)
+                            {
+                                T sum = 0;
+                                for (size_t k = 0; k < taps; k++)
+                                {
+                                    sum += weights[i * taps + k] * arg[indices[i * taps + k]];
+                                }
+                                out[i] = sum;
+                            }
+                            return;
+                        }
+                        for (size_t i = begin; i < end; i++)
+                        {
+                            T* dst = out + i * inner;
+                            const T* src = arg + indices[i * taps] * inner;
+                            if (taps == 1)
+                            {
+                                memcpy(dst, src, inner * sizeof(T));
+                                continue;
+                            }
+                            T weight = weights[i * taps];
+                            for (size_t c = 0; c < inner; c++)
+                            {
+                                dst[c] = weight * src[c];
+                            }
+                            for (size_t k = 1; k < taps; k++)
+                            {
+                                src = arg + indices[i * taps + k] * inner;
+                                weight = weights[i * taps + k];
+                                for (size_t c = 0; c < inner; c++)
+                                {
+                                    dst[c] += weight * src[c];
+                                }
+                            }
+                        }
+                    }
+
+                    template <typename T>
+                    void resample(const InterpolatePlan<T>& plan,
+                                  size_t level,
+                                  const T* arg,
+                                  T* out,
+                                  std::vector<std::vector<T>>& scratch);
+
+                    // Output slice `i` along axis `level`. The input slices of its taps are
+                    // blended first, at the input resolution of the axes after it.
+                    template <typename T>
+                    void resample_slice(const InterpolatePlan<T>& plan,
+                                        size_t level,
+                                        size_t i,
+                                        const T* arg,
+                                        T* out,
+                                        std::vector<std::vector<T>>& scratch)
+                    {
+                        auto& axis = plan.axes[level];
+                        if (axis.identity)
+                        {
+                            resample(plan, level + 1, arg + i * axis.in_stride, out, scratch);
+                            return;
+                        }
+                        size_t taps = axis.taps;
+                        const size_t* indices = axis.indices.data() + i * taps;
+                        const T* weights = axis.weights.data() + i * taps;
+                        if (taps == 1)
+                        {
+                            resample(
+                                plan, level + 1, arg + indices[0] * axis.in_stride, out, scratch);
+                            return;
+                        }
+                        T* blended = scratch[level].data();
+                        const T* src = arg + indices[0] * axis.in_stride;
+                        for (size_t j = 0; j < axis.in_stride; j++)
+                        {
+                            blended[j] = weights[0] * src[j];
+                        }
+                        for (size_t k = 1; k < taps; k++)
+                        {
+                            src = arg + indices[k] * axis.in_stride;
+                            T weight = weights[k];
+                            for (size_t j = 0; j < axis.in_stride; j++)
+                            {
+                                blended[j] += weight * src[j];
+                            }
+                        }
+                        resample(plan, level + 1, blended, out, scratch);
+                    }
+
+                    template <typename T>
+                    void resample(const InterpolatePlan<T>& plan,
+                                  size_t level,
+                                  const T* arg,
+                                  T* out,
+                                  std::vector<std::vector<T>>& scratch)
+                    {
+                        auto& axis = plan.axes[level];
+                        if (level + 1 == plan.axes.size())
+                        {
+                            resample_row(plan, arg, out, 0, axis.out_size);
+                            return;
+                        }
+                        for (size_t i = 0; i < axis.out_size; i++)
+                        {
+                            resample_slice(plan, level, i, arg, out + i * axis.out_stride, scratch);
+                        }
+                    }
+                }
+
+                template <typename T>
+                void interpolate(const void* arg,
+                                 void* out,
+                                 const InterpolatePlan<T>& plan,
+                                 int arena)
+                {
+                    const T* input = static_cast<const T*>(arg);
+                    T* output = static_cast<T*>(out);
+                    if (plan.axes.empty())
+                    {
+                        memcpy(output, input, plan.inner * sizeof(T));
+                        return;
+                    }
+
+                    // Rows of work are the independent slices, such as batch x channel of NCHW,
+                    // times the output coordinates along the first interpolated axis
+                    auto& first = plan.axes.front();
+                    size_t rows = plan.outer * first.out_size;
+                    size_t taps = 1;
+                    for (auto& axis : plan.axes)
+                    {
+                        taps *= axis.identity ? 1 : axis.taps;
+                    }
+                    Eigen::TensorOpCost cost(first.in_stride * sizeof(T),
+                                             first.out_stride * sizeof(T),
+                                             first.out_stride * taps);
+                    auto& device = executor::GetCPUExecutor().get_device(arena);
+                    device.parallelFor(
+                        static_cast<Eigen::Index>(rows),
+                        cost,
+                        [&](Eigen::Index begin, Eigen::Index end) {
+                            std::vector<std::vector<T>> scratch(plan.axes.size());
+                            for (size_t level = 0; level + 1 < plan.axes.size(); level++)
+                            {
+                                scratch[level].resize(plan.axes[level].in_stride);
+                            }
+                            for (Eigen::Index row = begin; row < end; row++)
+                            {
+                                size_t slice = row / first.out_size;
+                                size_t i = row % first.out_size;
+                                const T* src = input + slice * first.in_size * first.in_stride;
+                                T* dst = output + slice * first.out_size * first.out_stride;
+                                if (plan.axes.size() == 1)
+                                {
+                                    interpolate_detail::resample_row(plan, src, dst, i, i + 1);
+                                }
+                                else
+                                {
+                                    interpolate_detail::resample_slice(
+                                        plan, 0, i, src, dst + i * first.out_stride, scratch);
+                                }
+                            }
+                        });
+                }
+            }
+        }
+    }
+}
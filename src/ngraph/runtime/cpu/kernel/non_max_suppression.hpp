@@ -0,0 +1,301 @@
+//*****************************************************************************
+// Copyright 2017-2019 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#pragma once
+
+#include <algorithm>
+#include <cstdint>
+#include <vector>
+
+#define EIGEN_USE_THREADS
+#include <unsupported/Eigen/CXX11/Tensor>
+
+#include "ngraph/op/non_max_suppression.hpp"
+#include "ngraph/runtime/cpu/cpu_executor.hpp"
+#include "ngraph/runtime/reference/non_max_suppression.hpp"
+#include "ngraph/shape.hpp"
+
+namespace ngraph
+{
+    namespace runtime
+    {
+        namespace cpu
+        {
+            namespace kernel
+            {
+                namespace nms
+                {
+                    // Box coordinates as separate arrays, so that a candidate is compared with
+                    // all the boxes kept so far in one vectorized loop
+                    template <typename T>
+                    struct Boxes
+                    {
+                        void resize(size_t size)
+                        {
+                            ymin.resize(size);
+                            xmin.resize(size);
+                            ymax.resize(size);
+                            xmax.resize(size);
+                            area.resize(size);
+                        }
+
+                        void set(size_t i, const T* corners)
+                        {
+                            ymin[i] = corners[0];
+                            xmin[i] = corners[1];
+                            ymax[i] = corners[2];
+                            xmax[i] = corners[3];
+                            area[i] = (corners[2] - corners[0]) * (corners[3] - corners[1]);
+                        }
+
+                        void append(const Boxes& boxes, size_t i)
+                        {
+                            ymin.push_back(boxes.ymin[i]);
+                            xmin.push_back(boxes.xmin[i]);
+                            ymax.push_back(boxes.ymax[i]);
+                            xmax.push_back(boxes.xmax[i]);
+                            area.push_back(boxes.area[i]);
+                        }
+
+                        std::vector<T> ymin;
+                        std::vector<T> xmin;
+                        std::vector<T> ymax;
+                        std::vector<T> xmax;
+                        std::vector<T> area;
+                    };
+
+                    template <typename T>
+                    struct SelectedBox
+                    {
+                        T score;
+                        int64_t batch;
+                        int64_t class_id;
+                        int64_t box;
+                    };
+
+                    // Kept boxes are compared in blocks, so that a candidate that overlaps one
+                    // of the first boxes is not compared with all of them
+                    constexpr size_t s_overlap_block = 64;
+
+                    // Whether box `i` overlaps any of `kept` by more than `iou_threshold`
+                    template <typename T>
+                    bool overlaps(const Boxes<T>& boxes,
+                                  size_t i,
+                                  const Boxes<T>& kept,
+                                  T iou_threshold)
+                    {
+                        const T ymin = boxes.ymin[i];
+                        const T xmin = boxes.xmin[i];
+                        const T ymax = boxes.ymax[i];
+                        const T xmax = boxes.xmax[i];
+                        const T area = boxes.area[i];
+                        const T* kept_ymin = kept.ymin.data();
+                        const T* kept_xmin = kept.xmin.data();
+                        const T* kept_ymax = kept.ymax.data();
+                        const T* kept_xmax = kept.xmax.data();
+                        const T* kept_area = kept.area.data();
+                        size_t count = kept.area.size();
+                        for (size_t first = 0; first < count; first += s_overlap_block)
+                        {
+                            size_t last = std::min(count, first + s_overlap_block);
+                            int overlap = 0;
+#pragma omp simd reduction(| : overlap)
+                            for (size_t k = first; k < last; k++)
+                            {
+                                T height =
+                                    std::min(ymax, kept_ymax[k]) - std::max(ymin, kept_ymin[k]);
+                                T width =
+                                    std::min(xmax, kept_xmax[k]) - std::max(xmin, kept_xmin[k]);
+                                T intersection = std::max(height, T(0)) * std::max(width, T(0));
+                                T area_union = area + kept_area[k] - intersection;
+                                // Boxes without an area do not overlap anything
+                                T iou = area_union > 0 ? intersection / area_union : T(0);
+                                overlap |= iou > iou_threshold;
+                            }
+                            if (overlap)
+                            {
+                                return true;
+                            }
+                        }
+                        return false;
+                    }
+
+                    // Greedy suppression of the boxes of one batch for one class. Candidates are
+                    // only sorted as far as the boxes are needed.
+                    template <typename T>
+                    void suppress(const Boxes<T>& boxes,
+                                  const T* scores,
+                                  size_t num_boxes,
+                                  int64_t batch,
+                                  int64_t class_id,
+                                  size_t max_output_boxes,
+                                  T iou_threshold,
+                                  T score_threshold,
+                                  std::vector<SelectedBox<T>>& selected)
+                    {
+                        if (max_output_boxes == 0)
+                        {
+                            return;
+                        }
+                        std::vector<std::pair<T, int64_t>> candidates;
+                        for (size_t i = 0; i < num_boxes; i++)
+                        {
+                            if (scores[i] > score_threshold)
+                            {
+                                candidates.emplace_back(scores[i], i);
+                            }
+                        }
+                        // Higher scores first, and lower indices first among equal scores
+                        auto before = [](const std::pair<T, int64_t>& a,
+                                         const std::pair<T, int64_t>& b) {
+                            return a.first > b.first ||
+                                   (!(b.first > a.first) && a.second < b.second);
+                        };
+
+                        Boxes<T> kept;
+                        size_t sorted = 0;
+                        for (size_t c = 0; c < candidates.size(); c++)
+                        {
+                            if (c == sorted)
+                            {
+                                // Sort enough candidates for the remaining boxes and some of the
+                                // suppressed ones
+                                size_t needed = max_output_boxes - kept.area.size();
+                                size_t chunk = std::max(2 * needed, s_overlap_block);
+                                sorted = std::min(candidates.size(), sorted + chunk);
+                                std::partial_sort(candidates.begin() + c,
+                                                  candidates.begin() + sorted,
+                                                  candidates.end(),
+                                                  before);
+                            }
+                            size_t i = static_cast<size_t>(candidates[c].second);
+                            if (!overlaps(boxes, i, kept, iou_threshold))
+                            {
+                                kept.append(boxes, i);
+                                selected.push_back({candidates[c].first,
+                                                    batch,
+                                                    class_id,
+                                                    static_cast<int64_t>(i)});
+                                if (kept.area.size() == max_output_boxes)
+                                {
+                                    break;
+                                }
+                            }
+                        }
+                    }
+                }
+
+                template <typename T>
+                void non_max_suppression(const void* boxes,
+                                         const void* scores,
+                                         void* output,
+                                         const Shape& scores_shape,
+                                         size_t output_rows,
+                                         int64_t max_output_boxes_per_class,
+                                         float iou_threshold,
+                                         float score_threshold,
+                                         op::v1::NonMaxSuppression::BoxEncodingType box_encoding,
+                                         bool sort_result_descending,
+                                         int arena)
+                {
+                    const T* box_data = static_cast<const T*>(boxes);
+                    const T* score_data = static_cast<const T*>(scores);
+                    int64_t* out = static_cast<int64_t*>(output);
+                    size_t num_batches = scores_shape[0];
+                    size_t num_classes = scores_shape[1];
+                    size_t num_boxes = scores_shape[2];
+                    size_t max_output_boxes =
+                        static_cast<size_t>(std::max<int64_t>(max_output_boxes_per_class, 0));
+
+                    auto& device = executor::GetCPUExecutor().get_device(arena);
+
+                    std::vector<nms::Boxes<T>> batch_boxes(num_batches);
+                    device.parallelFor(
+                        static_cast<Eigen::Index>(num_batches),
+                        Eigen::TensorOpCost(4 * num_boxes * sizeof(T),
+                                            5 * num_boxes * sizeof(T),
+                                            8 * num_boxes),
+                        [&](Eigen::Index first, Eigen::Index last) {
+                            T corners[4];
+                            for (Eigen::Index batch = first; batch < last; batch++)
+                            {
+                                auto& batch_box = batch_boxes[batch];
+                                batch_box.resize(num_boxes);
+                                for (size_t i = 0; i < num_boxes; i++)
+                                {
+                                    reference::non_max_suppression_corners(
+                                        box_data + (batch * num_boxes + i) * 4,
+                                        box_encoding,
+                                        corners);
+                                    batch_box.set(i, corners);
+                                }
+                            }
+                        });
+
+                    // Every pair of a batch and a class is suppressed on its own
+                    size_t pairs = num_batches * num_classes;
+                    std::vector<std::vector<nms::SelectedBox<T>>> pair_selected(pairs);
+                    size_t compares = std::min(num_boxes, max_output_boxes);
+                    device.parallelFor(
+                        static_cast<Eigen::Index>(pairs),
+                        Eigen::TensorOpCost(num_boxes * sizeof(T),
+                                            compares * 3 * sizeof(int64_t),
+                                            num_boxes * (1 + compares)),
+                        [&](Eigen::Index first, Eigen::Index last) {
+                            for (Eigen::Index pair = first; pair < last; pair++)
+                            {
+                                size_t batch = pair / num_classes;
+                                size_t class_id = pair % num_classes;
+                                nms::suppress(batch_boxes[batch],
+                                              score_data + pair * num_boxes,
+                                              num_boxes,
+                                              batch,
+                                              class_id,
+                                              max_output_boxes,
+                                              static_cast<T>(iou_threshold),
+                                              static_cast<T>(score_threshold),
+                                              pair_selected[pair]);
+                            }
+                        });
+
+                    std::vector<nms::SelectedBox<T>> selected;
+                    for (auto& boxes_of_pair : pair_selected)
+                    {
+                        selected.insert(selected.end(), boxes_of_pair.begin(), boxes_of_pair.end());
+                    }
+                    if (sort_result_descending)
+                    {
+                        std::stable_sort(selected.begin(),
+                                         selected.end(),
+                                         [](const nms::SelectedBox<T>& a,
+                                            const nms::SelectedBox<T>& b) {
+                                             return a.score > b.score;
+                                         });
+                    }
+
+                    size_t rows = std::min(output_rows, selected.size());
+                    for (size_t row = 0; row < rows; row++)
+                    {
+                        out[3 * row] = selected[row].batch;
+                        out[3 * row + 1] = selected[row].class_id;
+                        out[3 * row + 2] = selected[row].box;
+                    }
+                    std::fill(out + 3 * rows, out + 3 * output_rows, -1);
+                }
+            }
+        }
+    }
+}
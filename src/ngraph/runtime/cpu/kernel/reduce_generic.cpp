@@ -0,0 +1,156 @@
+//*****************************************************************************
+// Copyright 2017-2019 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#include <atomic>
+#include <cstdlib>
+#include <string>
+
+#include "ngraph/log.hpp"
+#include "ngraph/shape_util.hpp"
+#include "reduce_generic.hpp"
+
+using namespace std;
+using namespace ngraph;
+
+static runtime::cpu::kernel::ReductionAccuracy get_default_accuracy()
+{
+    using runtime::cpu::kernel::ReductionAccuracy;
+    const char* env = getenv("NGRAPH_CPU_REDUCTION_ACCURACY");
+    if (env == nullptr)
+    {
+        return ReductionAccuracy::kahan;
+    }
+    string value = env;
+    if (value == "fast")
+    {
+        return ReductionAccuracy::fast;
+    }
+    if (value == "pairwise")
+    {
+        return ReductionAccuracy::pairwise;
+    }
+    if (value != "kahan")
+    {
+        NGRAPH_WARN << "Unknown NGRAPH_CPU_REDUCTION_ACCURACY '" << value << "', using kahan";
+    }
+    return ReductionAccuracy::kahan;
+}
+
+static atomic<runtime::cpu::kernel::ReductionAccuracy> s_accuracy{get_default_accuracy()};
+
+runtime::cpu::kernel::ReductionAccuracy runtime::cpu::kernel::get_reduction_accuracy()
+{
+    return s_accuracy;
+}
+
+void runtime::cpu::kernel::set_reduction_accuracy(ReductionAccuracy accuracy)
+{
+    s_accuracy = accuracy;
+}
+
+runtime::cpu::kernel::ReductionPlan::ReductionPlan(const Shape& input_shape,
+                                                   const AxisSet& reduction_axes)
+    : input_count(shape_size(input_shape))
+{
+    if (input_count == 0)
+    {
+        // Nothing is read, only the output count and the reduce count (possibly 0) matter
+        for (size_t i = 0; i < input_shape.size(); i++)
+        {
+            if (reduction_axes.count(i) != 0)
+            {
+                reduce_count *= input_shape[i];
+            }
+            else
+            {
+                outer_count *= input_shape[i];
+            }
+        }
+        return;
+    }
+
+    // Drop unit dimensions and merge neighbours of the same kind
+    vector<size_t> sizes;
+    vector<bool> reduced;
+    for (size_t i = 0; i < input_shape.size(); i++)
+    {
+        if (input_shape[i] == 1)
+        {
+            continue;
+        }
+        bool is_reduced = reduction_axes.count(i) != 0;
+        if (!sizes.empty() && reduced.back() == is_reduced)
+        {
+            sizes.back() *= input_shape[i];
+        }
+        else
+        {
+            sizes.push_back(input_shape[i]);
+            reduced.push_back(is_reduced);
+        }
+    }
+
+    vector<size_t> strides(sizes.size());
+    size_t stride = 1;
+    for (size_t i = sizes.size(); i-- > 0;)
+    {
+        strides[i] = stride;
+        stride *= sizes[i];
+    }
+
+    size_t rank = sizes.size();
+    if (rank > 0 && !reduced.back())
+    {
+        inner_count = sizes.back();
+        rank--;
+    }
+    else if (rank > 0)
+    {
+        reduce_innermost = true;
+        run_length = sizes.back();
+    }
+
+    for (size_t i = 0; i < rank; i++)
+    {
+        if (reduced[i])
+        {
+            reduce_count *= sizes[i];
+            // The innermost reduced dimension is walked by the runs
+            if (!reduce_innermost || i != sizes.size() - 1)
+            {
+                row_sizes.push_back(sizes[i]);
+                row_strides.push_back(strides[i]);
+            }
+        }
+        else
+        {
+            outer_count *= sizes[i];
+            outer_sizes.push_back(sizes[i]);
+            outer_strides.push_back(strides[i]);
+        }
+    }
+}
+
+size_t runtime::cpu::kernel::ReductionPlan::get_outer_offset(size_t outer) const
+{
+    size_t offset = 0;
+    for (size_t i = outer_sizes.size(); i-- > 0;)
+    {
+        offset += (outer % outer_sizes[i]) * outer_strides[i];
+        outer /= outer_sizes[i];
+    }
+    return offset;
+}
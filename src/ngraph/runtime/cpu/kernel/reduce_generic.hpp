@@ -0,0 +1,820 @@
+//*****************************************************************************
+// Copyright 2017-2019 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#pragma once
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <type_traits>
+#include <vector>
+
+#define EIGEN_USE_THREADS
+#include <unsupported/Eigen/CXX11/Tensor>
+
+#include "ngraph/axis_set.hpp"
+#include "ngraph/runtime/cpu/cpu_backend_visibility.h"
+#include "ngraph/runtime/cpu/cpu_executor.hpp"
+#include "ngraph/shape.hpp"
+#include "ngraph/type/element_type.hpp"
+
+// Generic reduction kernels. Any reduction, whatever its rank and set of reduced axes, is
+// normalized to three nested strided loops (outer, reduce, inner) by ReductionPlan. The
+// kernels then either accumulate whole contiguous rows into a block of outputs ("vertical",
+// when the innermost dimension is kept) or reduce contiguous runs with several independent
+// lanes ("horizontal", when the innermost dimension is reduced). Both forms vectorize.
+// Independent outputs are spread over the threads of the arena; when there are too few of them
+// the reduce loop itself is split and the partial results are combined as a tree.
+
+namespace ngraph
+{
+    namespace runtime
+    {
+        namespace cpu
+        {
+            namespace kernel
+            {
+                /// \brief Summation algorithm of the generic floating point sum kernel
+                enum class ReductionAccuracy
+                {
+                    /// Independent lane accumulators, error grows linearly with the length
+                    fast,
+                    /// Pairwise summation of blocks, error grows with log of the length
+                    pairwise,
+                    /// Kahan compensated summation, the same algorithm as reference::sum
+                    kahan
+                };
+
+                /// \brief Returns the accuracy used by the generic sum kernels. Defaults to
+                ///        kahan, or to the value of NGRAPH_CPU_REDUCTION_ACCURACY
+                ///        (fast, pairwise or kahan).
+                CPU_BACKEND_API ReductionAccuracy get_reduction_accuracy();
+                CPU_BACKEND_API void set_reduction_accuracy(ReductionAccuracy accuracy);
+
+                /// \brief A reduction normalized to (outer, reduce, inner) strided loops.
+                ///
+                /// Unit dimensions are dropped and adjacent dimensions that are both reduced or
+                /// both kept are merged. Trailing kept dimensions form the contiguous inner
+                /// block, the other kept dimensions the outer loop. Output element
+                /// outer * inner_count + i is the reduction of reduce_count inputs.
+                struct CPU_BACKEND_API ReductionPlan
+                {
+                    ReductionPlan(const Shape& input_shape, const AxisSet& reduction_axes);
+
+                    /// \return Input offset of the first element of an outer index
+                    size_t get_outer_offset(size_t outer) const;
+
+                    size_t outer_count = 1;
+                    size_t reduce_count = 1;
+                    size_t inner_count = 1;
+                    size_t input_count = 0;
+                    /// True when the innermost dimension is reduced. The reduce loop is then
+                    /// made of contiguous runs of run_length elements, one per row. Otherwise
+                    /// every row is a contiguous block of inner_count inputs.
+                    bool reduce_innermost = false;
+                    size_t run_length = 1;
+                    std::vector<size_t> outer_sizes;
+                    std::vector<size_t> outer_strides;
+                    std::vector<size_t> row_sizes;
+                    std::vector<size_t> row_strides;
+                };
+
+                namespace reduction
+                {
+                    // Lanes of the horizontal kernels; enough independent accumulators to fill
+                    // a 512 bit register of floats
+                    constexpr size_t s_lanes = 16;
+                    // Outputs per task of the vertical kernels
+                    constexpr size_t s_column_block = 1024;
+                    // Elements summed directly by one leaf of the pairwise recursion
+                    constexpr size_t s_pairwise_block = 128;
+                    // Less input than this is reduced on the calling thread
+                    constexpr size_t s_min_parallel_work = 32768;
+                    // Minimum reduce length each thread gets when the reduce loop is split
+                    constexpr size_t s_min_chunk = 4096;
+
+                    /// \brief Row major odometer over a set of strided dimensions
+                    class StridedCounter
+                    {
+                    public:
+                        StridedCounter(const std::vector<size_t>& sizes,
+                                       const std::vector<size_t>& strides,
+                                       size_t index)
+                            : m_sizes(sizes)
+                            , m_strides(strides)
+                            , m_coordinate(sizes.size())
+                        {
+                            for (size_t i = sizes.size(); i-- > 0;)
+                            {
+                                m_coordinate[i] = index % sizes[i];
+                                index /= sizes[i];
+                                m_offset += m_coordinate[i] * strides[i];
+                            }
+                        }
+
+                        size_t get_offset() const { return m_offset; }
+                        void next()
+                        {
+                            for (size_t i = m_sizes.size(); i-- > 0;)
+                            {
+                                m_offset += m_strides[i];
+                                if (++m_coordinate[i] < m_sizes[i])
+                                {
+                                    return;
+                                }
+                                m_offset -= m_coordinate[i] * m_strides[i];
+                                m_coordinate[i] = 0;
+                            }
+                        }
+
+                    private:
+                        const std::vector<size_t>& m_sizes;
+                        const std::vector<size_t>& m_strides;
+                        std::vector<size_t> m_coordinate;
+                        size_t m_offset = 0;
+                    };
+
+                    /// \brief Calls f(row_data, row_index) for the rows [first, last) of a
+                    ///        vertical reduction
+                    template <typename T, typename F>
+                    void for_each_row(
+                        const T* in, const ReductionPlan& plan, size_t first, size_t last, F f)
+                    {
+                        StridedCounter row(plan.row_sizes, plan.row_strides, first);
+                        for (size_t r = first; r < last; r++, row.next())
+                        {
+                            f(in + row.get_offset(), r);
+                        }
+                    }
+
+                    /// \brief Calls f(run_data, length, reduce_index) for the contiguous runs
+                    ///        covering the reduce indices [first, last) of a horizontal reduction
+                    template <typename T, typename F>
+                    void for_each_run(
+                        const T* in, const ReductionPlan& plan, size_t first, size_t last, F f)
+                    {
+                        size_t position = first % plan.run_length;
+                        StridedCounter row(
+                            plan.row_sizes, plan.row_strides, first / plan.run_length);
+                        while (first < last)
+                        {
+                            size_t length = std::min(plan.run_length - position, last - first);
+                            f(in + row.get_offset() + position, length, first);
+                            first += length;
+                            position = 0;
+                            row.next();
+                        }
+                    }
+
+                    template <typename T>
+                    struct Sum
+                    {
+                        static T identity() { return T(0); }
+                        static T combine(T a, T b) { return static_cast<T>(a + b); }
+                    };
+
+                    template <typename T>
+                    struct Product
+                    {
+                        static T identity() { return T(1); }
+                        static T combine(T a, T b) { return static_cast<T>(a * b); }
+                    };
+
+                    template <typename T>
+                    struct Max
+                    {
+                        static T identity()
+                        {
+                            return std::numeric_limits<T>::has_infinity
+                                       ? T(-std::numeric_limits<T>::infinity())
+                                       : std::numeric_limits<T>::min();
+                        }
+                        static T combine(T a, T b) { return b > a ? b : a; }
+                    };
+
+                    template <typename T>
+                    struct Min
+                    {
+                        static T identity()
+                        {
+                            return std::numeric_limits<T>::has_infinity
+                                       ? std::numeric_limits<T>::infinity()
+                                       : std::numeric_limits<T>::max();
+                        }
+                        static T combine(T a, T b) { return b < a ? b : a; }
+                    };
+
+                    struct All
+                    {
+                        static char identity() { return 1; }
+                        static char combine(char a, char b) { return a && b; }
+                    };
+
+                    struct Any
+                    {
+                        static char identity() { return 0; }
+                        static char combine(char a, char b) { return a || b; }
+                    };
+
+                    template <typename T>
+                    struct Greater
+                    {
+                        static bool better(T a, T b) { return a > b; }
+                    };
+
+                    template <typename T>
+                    struct Less
+                    {
+                        static bool better(T a, T b) { return a < b; }
+                    };
+
+                    /// \brief Reduction with an associative operator, optionally summing pairwise
+                    template <typename T, typename Op, bool Pairwise>
+                    struct FoldReduction
+                    {
+                        typedef T ElementType;
+                        typedef T State;
+
+                        static State identity() { return Op::identity(); }
+                        static T reduce_run(const T* data, size_t length)
+                        {
+                            T lanes[s_lanes];
+                            std::fill(lanes, lanes + s_lanes, Op::identity());
+                            size_t i = 0;
+                            for (; i + s_lanes <= length; i += s_lanes)
+                            {
+                                for (size_t k = 0; k < s_lanes; k++)
+                                {
+                                    lanes[k] = Op::combine(lanes[k], data[i + k]);
+                                }
+                            }
+                            for (; i < length; i++)
+                            {
+                                lanes[0] = Op::combine(lanes[0], data[i]);
+                            }
+                            for (size_t width = s_lanes / 2; width > 0; width /= 2)
+                            {
+                                for (size_t k = 0; k < width; k++)
+                                {
+                                    lanes[k] = Op::combine(lanes[k], lanes[k + width]);
+                                }
+                            }
+                            return lanes[0];
+                        }
+
+                        static T reduce_run_pairwise(const T* data, size_t length)
+                        {
+                            if (length <= s_pairwise_block)
+                            {
+                                return reduce_run(data, length);
+                            }
+                            size_t half = length / 2 / s_lanes * s_lanes;
+                            return Op::combine(reduce_run_pairwise(data, half),
+                                               reduce_run_pairwise(data + half, length - half));
+                        }
+
+                        static void accumulate_rows(const T* in,
+                                                    const ReductionPlan& plan,
+                                                    size_t first,
+                                                    size_t last,
+                                                    size_t columns,
+                                                    State* acc)
+                        {
+                            if (Pairwise && last - first > s_pairwise_block)
+                            {
+                                size_t middle = first + (last - first) / 2;
+                                std::vector<State> right(columns, Op::identity());
+                                accumulate_rows(in, plan, first, middle, columns, acc);
+                                accumulate_rows(in, plan, middle, last, columns, right.data());
+                                for (size_t i = 0; i < columns; i++)
+                                {
+                                    acc[i] = Op::combine(acc[i], right[i]);
+                                }
+                                return;
+                            }
+                            for_each_row(in, plan, first, last, [&](const T* row, size_t) {
+                                for (size_t i = 0; i < columns; i++)
+                                {
+                                    acc[i] = Op::combine(acc[i], row[i]);
+                                }
+                            });
+                        }
+
+                        static void accumulate_runs(const T* in,
+                                                    const ReductionPlan& plan,
+                                                    size_t first,
+                                                    size_t last,
+                                                    State& acc)
+                        {
+                            auto f = [&](const T* run, size_t length, size_t) {
+                                acc = Op::combine(acc,
+                                                  Pairwise ? reduce_run_pairwise(run, length)
+                                                           : reduce_run(run, length));
+                            };
+                            for_each_run(in, plan, first, last, f);
+                        }
+
+                        static void merge(State& a, const State& b) { a = Op::combine(a, b); }
+                        static T finalize(const State& state, const ReductionPlan&)
+                        {
+                            return state;
+                        }
+                    };
+
+                    /// \brief Kahan compensated sum, as in reference::sum. Only the floating
+                    ///        point types are instantiated.
+                    template <typename T>
+                    struct KahanSumReduction
+                    {
+                        typedef T ElementType;
+                        struct State
+                        {
+                            T sum;
+                            T compensation;
+                        };
+
+                        static State identity() { return State{0, 0}; }
+                        static void add(T& sum, T& compensation, T x)
+                        {
+                            if (std::isfinite(x) && std::isfinite(sum))
+                            {
+                                T y = x - compensation;
+                                T t = sum + y;
+                                compensation = (t - sum) - y;
+                                sum = t;
+                            }
+                            else
+                            {
+                                sum = sum + x;
+                            }
+                        }
+
+                        static void accumulate_rows(const T* in,
+                                                    const ReductionPlan& plan,
+                                                    size_t first,
+                                                    size_t last,
+                                                    size_t columns,
+                                                    State* acc)
+                        {
+                            for_each_row(in, plan, first, last, [&](const T* row, size_t) {
+                                for (size_t i = 0; i < columns; i++)
+                                {
+                                    add(acc[i].sum, acc[i].compensation, row[i]);
+                                }
+                            });
+                        }
+
+                        static void accumulate_runs(const T* in,
+                                                    const ReductionPlan& plan,
+                                                    size_t first,
+                                                    size_t last,
+                                                    State& acc)
+                        {
+                            auto f = [&](const T* run, size_t length, size_t) {
+                                T sums[s_lanes] = {};
+                                T compensations[s_lanes] = {};
+                                size_t i = 0;
+                                for (; i + s_lanes <= length; i += s_lanes)
+                                {
+                                    for (size_t k = 0; k < s_lanes; k++)
+                                    {
+                                        add(sums[k], compensations[k], run[i + k]);
+                                    }
+                                }
+                                for (; i < length; i++)
+                                {
+                                    add(sums[0], compensations[0], run[i]);
+                                }
+                                for (size_t k = 0; k < s_lanes; k++)
+                                {
+                                    merge(acc, State{sums[k], compensations[k]});
+                                }
+                            };
+                            for_each_run(in, plan, first, last, f);
+                        }
+
+                        static void merge(State& a, const State& b)
+                        {
+                            add(a.sum, a.compensation, b.sum);
+                            add(a.sum, a.compensation, -b.compensation);
+                        }
+                        static T finalize(const State& state, const ReductionPlan&)
+                        {
+                            return state.sum;
+                        }
+                    };
+
+                    /// \brief Index of the first best element, 0 for an empty reduction
+                    template <typename T, typename Compare>
+                    struct ArgReduction
+                    {
+                        typedef T ElementType;
+                        struct State
+                        {
+                            T value;
+                            size_t index;
+                        };
+
+                        static const size_t npos = std::numeric_limits<size_t>::max();
+
+                        static State identity() { return State{T(), npos}; }
+                        static void accumulate_rows(const T* in,
+                                                    const ReductionPlan& plan,
+                                                    size_t first,
+                                                    size_t last,
+                                                    size_t columns,
+                                                    State* acc)
+                        {
+                            for_each_row(in, plan, first, last, [&](const T* row, size_t index) {
+                                for (size_t i = 0; i < columns; i++)
+                                {
+                                    if (acc[i].index == npos ||
+                                        Compare::better(row[i], acc[i].value))
+                                    {
+                                        acc[i].value = row[i];
+                                        acc[i].index = index;
+                                    }
+                                }
+                            });
+                        }
+
+                        static void accumulate_runs(const T* in,
+                                                    const ReductionPlan& plan,
+                                                    size_t first,
+                                                    size_t last,
+                                                    State& acc)
+                        {
+                            auto f = [&](const T* run, size_t length, size_t base) {
+                                size_t i = 0;
+                                if (length >= 2 * s_lanes)
+                                {
+                                    // Every lane keeps the first best of the elements it saw
+                                    T values[s_lanes];
+                                    size_t indices[s_lanes];
+                                    for (size_t k = 0; k < s_lanes; k++)
+                                    {
+                                        values[k] = run[k];
+                                        indices[k] = k;
+                                    }
+                                    for (i = s_lanes; i + s_lanes <= length; i += s_lanes)
+                                    {
+                                        for (size_t k = 0; k < s_lanes; k++)
+                                        {
+                                            bool better = Compare::better(run[i + k], values[k]);
+                                            values[k] = better ? run[i + k] : values[k];
+                                            indices[k] = better ? i + k : indices[k];
+                                        }
+                                    }
+                                    for (size_t k = 0; k < s_lanes; k++)
+                                    {
+                                        merge(acc, State{values[k], base + indices[k]});
+                                    }
+                                }
+                                for (; i < length; i++)
+                                {
+                                    merge(acc, State{run[i], base + i});
+                                }
+                            };
+                            for_each_run(in, plan, first, last, f);
+                        }
+
+                        static void merge(State& a, const State& b)
+                        {
+                            if (b.index != npos &&
+                                (a.index == npos || Compare::better(b.value, a.value) ||
+                                 (b.value == a.value && b.index < a.index)))
+                            {
+                                a = b;
+                            }
+                        }
+                        static size_t finalize(const State& state, const ReductionPlan&)
+                        {
+                            return state.index == npos ? 0 : state.index;
+                        }
+                    };
+
+                    template <typename F>
+                    void parallel_for(Eigen::ThreadPoolDevice& device,
+                                      size_t count,
+                                      size_t work_per_item,
+                                      size_t element_size,
+                                      F f)
+                    {
+                        if (count > 1 && count * work_per_item >= s_min_parallel_work &&
+                            device.numThreads() > 1)
+                        {
+                            Eigen::TensorOpCost cost(
+                                static_cast<double>(work_per_item * element_size),
+                                0,
+                                static_cast<double>(work_per_item));
+                            device.parallelFor(static_cast<Eigen::Index>(count),
+                                               cost,
+                                               [&f](Eigen::Index first, Eigen::Index last) {
+                                                   f(static_cast<size_t>(first),
+                                                     static_cast<size_t>(last));
+                                               });
+                        }
+                        else
+                        {
+                            f(0, count);
+                        }
+                    }
+
+                    template <typename Reduction, typename OutputType>
+                    void reduce(const typename Reduction::ElementType* input,
+                                OutputType* output,
+                                const ReductionPlan& plan,
+                                Eigen::ThreadPoolDevice& device)
+                    {
+                        typedef typename Reduction::State State;
+
+                        size_t output_count = plan.outer_count * plan.inner_count;
+                        if (output_count == 0)
+                        {
+                            return;
+                        }
+
+                        size_t threads = static_cast<size_t>(device.numThreads());
+                        size_t element_size = sizeof(typename Reduction::ElementType);
+                        bool vertical = !plan.reduce_innermost;
+                        size_t block = vertical ? std::min(plan.inner_count, s_column_block) : 1;
+                        size_t blocks = (plan.inner_count + block - 1) / block;
+                        size_t items = plan.outer_count * blocks;
+
+                        auto reduce_items = [&](size_t first, size_t last) {
+                            std::vector<State> acc(block);
+                            for (size_t item = first; item < last; item++)
+                            {
+                                size_t outer = item / blocks;
+                                size_t column = (item % blocks) * block;
+                                size_t columns = std::min(block, plan.inner_count - column);
+                                auto in = input + plan.get_outer_offset(outer) + column;
+                                std::fill(
+                                    acc.begin(), acc.begin() + columns, Reduction::identity());
+                                if (vertical)
+                                {
+                                    Reduction::accumulate_rows(
+                                        in, plan, 0, plan.reduce_count, columns, acc.data());
+                                }
+                                else
+                                {
+                                    Reduction::accumulate_runs(
+                                        in, plan, 0, plan.reduce_count, acc[0]);
+                                }
+                                OutputType* out = output + outer * plan.inner_count + column;
+                                for (size_t i = 0; i < columns; i++)
+                                {
+                                    out[i] =
+                                        static_cast<OutputType>(Reduction::finalize(acc[i], plan));
+                                }
+                            }
+                        };
+                        if (items >= threads || plan.input_count < s_min_parallel_work ||
+                            plan.reduce_count < 2 * s_min_chunk)
+                        {
+                            size_t work = plan.reduce_count * block;
+                            parallel_for(device, items, work, element_size, reduce_items);
+                            return;
+                        }
+
+                        // Too few outputs to occupy the threads: every chunk reduces a slice of
+                        // the reduce loop for all outputs, and the partial results are merged
+                        // pairwise
+                        size_t chunks = std::min(threads, plan.reduce_count / s_min_chunk);
+                        std::vector<State> partials(chunks * output_count, Reduction::identity());
+                        auto reduce_chunks = [&](size_t first, size_t last) {
+                            for (size_t chunk = first; chunk < last; chunk++)
+                            {
+                                size_t begin = plan.reduce_count * chunk / chunks;
+                                size_t end = plan.reduce_count * (chunk + 1) / chunks;
+                                State* acc = partials.data() + chunk * output_count;
+                                for (size_t outer = 0; outer < plan.outer_count; outer++)
+                                {
+                                    auto in = input + plan.get_outer_offset(outer);
+                                    if (vertical)
+                                    {
+                                        Reduction::accumulate_rows(in,
+                                                                   plan,
+                                                                   begin,
+                                                                   end,
+                                                                   plan.inner_count,
+                                                                   acc + outer * plan.inner_count);
+                                    }
+                                    else
+                                    {
+                                        Reduction::accumulate_runs(
+                                            in, plan, begin, end, acc[outer]);
+                                    }
+                                }
+                            }
+                        };
+                        parallel_for(
+                            device, chunks, plan.input_count / chunks, element_size, reduce_chunks);
+                        for (size_t width = 1; width < chunks; width *= 2)
+                        {
+                            for (size_t chunk = 0; chunk + width < chunks; chunk += 2 * width)
+                            {
+                                State* a = partials.data() + chunk * output_count;
+                                const State* b = a + width * output_count;
+                                for (size_t i = 0; i < output_count; i++)
+                                {
+                                    Reduction::merge(a[i], b[i]);
+                                }
+                            }
+                        }
+                        for (size_t i = 0; i < output_count; i++)
+                        {
+                            output[i] =
+                                static_cast<OutputType>(Reduction::finalize(partials[i], plan));
+                        }
+                    }
+
+                    template <typename Reduction, typename OutputType>
+                    void reduce(void* input,
+                                void* output,
+                                const Shape& input_shape,
+                                const AxisSet& reduction_axes,
+                                int arena)
+                    {
+                        ReductionPlan plan(input_shape, reduction_axes);
+                        reduce<Reduction, OutputType>(
+                            static_cast<const typename Reduction::ElementType*>(input),
+                            static_cast<OutputType*>(output),
+                            plan,
+                            executor::GetCPUExecutor().get_device(arena));
+                    }
+
+                    template <typename T>
+                    void reduce_sum(void* input,
+                                    void* output,
+                                    const Shape& input_shape,
+                                    const AxisSet& reduction_axes,
+                                    int arena,
+                                    std::true_type /* is_floating_point */)
+                    {
+                        switch (get_reduction_accuracy())
+                        {
+                        case ReductionAccuracy::fast:
+                            reduce<FoldReduction<T, Sum<T>, false>, T>(
+                                input, output, input_shape, reduction_axes, arena);
+                            break;
+                        case ReductionAccuracy::pairwise:
+                            reduce<FoldReduction<T, Sum<T>, true>, T>(
+                                input, output, input_shape, reduction_axes, arena);
+                            break;
+                        case ReductionAccuracy::kahan:
+                            reduce<KahanSumReduction<T>, T>(
+                                input, output, input_shape, reduction_axes, arena);
+                            break;
+                        }
+                    }
+
+                    template <typename T>
+                    void reduce_sum(void* input,
+                                    void* output,
+                                    const Shape& input_shape,
+                                    const AxisSet& reduction_axes,
+                                    int arena,
+                                    std::false_type /* is_floating_point */)
+                    {
+                        reduce<FoldReduction<T, Sum<T>, false>, T>(
+                            input, output, input_shape, reduction_axes, arena);
+                    }
+
+                    template <typename T, typename Compare>
+                    void arg_reduce(void* input,
+                                    void* output,
+                                    const Shape& input_shape,
+                                    size_t axis,
+                                    const element::Type& index_element_type,
+                                    int arena)
+                    {
+                        if (index_element_type == element::i64)
+                        {
+                            reduce<ArgReduction<T, Compare>, int64_t>(
+                                input, output, input_shape, AxisSet{axis}, arena);
+                        }
+                        else
+                        {
+                            reduce<ArgReduction<T, Compare>, int32_t>(
+                                input, output, input_shape, AxisSet{axis}, arena);
+                        }
+                    }
+                }
+
+                template <typename ElementType>
+                void reduce_sum_generic(void* input,
+                                        void* output,
+                                        const Shape& input_shape,
+                                        const AxisSet& reduction_axes,
+                                        int arena)
+                {
+                    reduction::reduce_sum<ElementType>(
+                        input,
+                        output,
+                        input_shape,
+                        reduction_axes,
+                        arena,
+                        std::is_floating_point<ElementType>());
+                }
+
+                template <typename ElementType>
+                void reduce_product_generic(void* input,
+                                            void* output,
+                                            const Shape& input_shape,
+                                            const AxisSet& reduction_axes,
+                                            int arena)
+                {
+                    reduction::reduce<reduction::FoldReduction<ElementType,
+                                                               reduction::Product<ElementType>,
+                                                               false>,
+                                      ElementType>(
+                        input, output, input_shape, reduction_axes, arena);
+                }
+
+                template <typename ElementType>
+                void reduce_max_generic(void* input,
+                                        void* output,
+                                        const Shape& input_shape,
+                                        const AxisSet& reduction_axes,
+                                        int arena)
+                {
+                    reduction::reduce<
+                        reduction::FoldReduction<ElementType, reduction::Max<ElementType>, false>,
+                        ElementType>(input, output, input_shape, reduction_axes, arena);
+                }
+
+                template <typename ElementType>
+                void reduce_min_generic(void* input,
+                                        void* output,
+                                        const Shape& input_shape,
+                                        const AxisSet& reduction_axes,
+                                        int arena)
+                {
+                    reduction::reduce<
+                        reduction::FoldReduction<ElementType, reduction::Min<ElementType>, false>,
+                        ElementType>(input, output, input_shape, reduction_axes, arena);
+                }
+
+                inline void reduce_all_generic(void* input,
+                                               void* output,
+                                               const Shape& input_shape,
+                                               const AxisSet& reduction_axes,
+                                               int arena)
+                {
+                    reduction::reduce<reduction::FoldReduction<char, reduction::All, false>,
+                                      char>(input, output, input_shape, reduction_axes, arena);
+                }
+
+                inline void reduce_any_generic(void* input,
+                                               void* output,
+                                               const Shape& input_shape,
+                                               const AxisSet& reduction_axes,
+                                               int arena)
+                {
+                    reduction::reduce<reduction::FoldReduction<char, reduction::Any, false>,
+                                      char>(input, output, input_shape, reduction_axes, arena);
+                }
+
+                /// \brief Writes the index of the first maximum along axis as i32 or i64
+                template <typename ElementType>
+                void argmax_generic(void* input,
+                                    void* output,
+                                    const Shape& input_shape,
+                                    size_t axis,
+                                    const element::Type& index_element_type,
+                                    int arena)
+                {
+                    reduction::arg_reduce<ElementType, reduction::Greater<ElementType>>(
+                        input, output, input_shape, axis, index_element_type, arena);
+                }
+
+                /// \brief Writes the index of the first minimum along axis as i32 or i64
+                template <typename ElementType>
+                void argmin_generic(void* input,
+                                    void* output,
+                                    const Shape& input_shape,
+                                    size_t axis,
+                                    const element::Type& index_element_type,
+                                    int arena)
+                {
+                    reduction::arg_reduce<ElementType, reduction::Less<ElementType>>(
+                        input, output, input_shape, axis, index_element_type, arena);
+                }
+            }
+        }
+    }
+}
@@ -20,7 +20,7 @@
 #include <unsupported/Eigen/CXX11/Tensor>
 
 #include "ngraph/runtime/cpu/cpu_executor.hpp"
-#include "ngraph/runtime/reference/max.hpp"
+#include "ngraph/runtime/cpu/kernel/reduce_generic.hpp"
 #include "ngraph/shape.hpp"
 
 namespace ngraph
@@ -172,15 +172,11 @@ namespace ngraph
                 void max(void* arg,
                          void* out,
                          const Shape& in_shape,
-                         const Shape& out_shape,
+                         const Shape& /* out_shape */,
                          const AxisSet& reduction_axes,
-                         int /* arena */)
+                         int arena)
                 {
-                    reference::max(static_cast<ElementType*>(arg),
-                                   static_cast<ElementType*>(out),
-                                   in_shape,
-                                   out_shape,
-                                   reduction_axes);
+                    reduce_max_generic<ElementType>(arg, out, in_shape, reduction_axes, arena);
                 }
             }
         }
@@ -14,18 +14,23 @@
 // limitations under the License.
 //*****************************************************************************
 
+#include <algorithm>
+#include <unordered_set>
+
 #include "ngraph/runtime/cpu/pass/cpu_horizontal_fusion.hpp"
 #include "ngraph/graph_util.hpp"
 #include "ngraph/log.hpp"
 #include "ngraph/op/avg_pool.hpp"
 #include "ngraph/op/concat.hpp"
 #include "ngraph/op/convolution.hpp"
+#include "ngraph/op/dot.hpp"
 #include "ngraph/op/fused/conv_fused.hpp"
 #include "ngraph/op/slice.hpp"
 #include "ngraph/pass/graph_rewrite.hpp"
 #include "ngraph/pass/manager.hpp"
 #include "ngraph/pattern/matcher.hpp"
 #include "ngraph/pattern/op/label.hpp"
+#include "ngraph/runtime/cpu/op/matmul_bias.hpp"
 
 using namespace ngraph;
 using namespace std;
@@ -192,3 +197,278 @@ void ngraph::runtime::cpu::pass::CPUHorizontalFusion::cpu_conv_horizontal_fusion
         make_shared<pattern::Matcher>(conv_bias, "CPUHorizontalFusion.CpuConvHorizontalFusion");
     this->add_matcher(m, callback);
 }
+
+namespace
+{
+    // A Dot or MatmulBias that reads a shared input, and how it is fused with its siblings
+    struct DotSibling
+    {
+        std::shared_ptr<Node> node;
+        // Position of the shared input, 0 or 1
+        size_t position;
+        Output<Node> weights;
+        // The bias of a MatmulBias, if any
+        Output<Node> bias;
+        // The axis along which the weights of the siblings are concatenated
+        size_t weights_axis;
+        // The axis of the fused output that is sliced back
+        size_t output_axis;
+    };
+
+    bool get_dot_sibling(const Input<Node>& input, DotSibling& sibling)
+    {
+        auto node = input.get_node()->shared_from_this();
+        if (!is_type<op::Dot>(node) && !is_type<op::MatmulBias>(node))
+        {
+            return false;
+        }
+        sibling.node = node;
+        sibling.position = input.get_index();
+        if (sibling.position > 1 || node->input_value(0) == node->input_value(1))
+        {
+            return false;
+        }
+        sibling.weights = node->input_value(1 - sibling.position);
+        if (sibling.weights.get_shape().size() != 2)
+        {
+            NGRAPH_DEBUG << "dot_horizontal_fusion: weights of " << node->get_name()
+                         << " are not a matrix";
+            return false;
+        }
+
+        if (auto dot = as_type_ptr<op::Dot>(node))
+        {
+            if (dot->get_reduction_axes_count() != 1)
+            {
+                return false;
+            }
+            sibling.weights_axis = sibling.position == 0 ? 1 : 0;
+            sibling.output_axis = sibling.position == 0 ? dot->get_shape().size() - 1 : 0;
+        }
+        else
+        {
+            auto matmul = std::static_pointer_cast<op::MatmulBias>(node);
+            // Weights that MatmulBias reshapes on the fly cannot be concatenated as they are
+            Shape weights_shape =
+                sibling.position == 0 ? matmul->get_b_shape() : matmul->get_a_shape();
+            if (weights_shape != sibling.weights.get_shape())
+            {
+                return false;
+            }
+            bool transpose_weights = sibling.position == 0 ? matmul->get_is_b_transposed()
+                                                           : matmul->get_is_a_transposed();
+            // op(W) * op(x) is [P, Q]; the weights contribute the Q columns or the P rows
+            sibling.weights_axis = (sibling.position == 0) != transpose_weights ? 1 : 0;
+            sibling.output_axis = sibling.position == 0 ? 1 : 0;
+            if (node->get_input_size() > 2)
+            {
+                sibling.bias = node->input_value(2);
+                // The bias must run along the sliced axis
+                if (sibling.bias == input.get_source_output() ||
+                    matmul->get_broadcast_axes() != AxisSet{1 - sibling.output_axis})
+                {
+                    return false;
+                }
+            }
+        }
+        // Slicing the fused output copies unless the slices are contiguous blocks, which
+        // CPUMemoryOptimization makes in place. A column block of X * W is only contiguous
+        // when X has a single row, otherwise the copies would cost more than the fusion saves.
+        Shape shape = node->get_shape();
+        if (shape_size(Shape(shape.begin(), shape.begin() + sibling.output_axis)) != 1)
+        {
+            NGRAPH_DEBUG << "dot_horizontal_fusion: slices of " << node->get_name()
+                         << " would not be in place";
+            return false;
+        }
+        return true;
+    }
+
+    bool can_fuse_dots(const DotSibling& a, const DotSibling& b)
+    {
+        if (a.node->get_type_info() != b.node->get_type_info() || a.position != b.position ||
+            a.weights.get_element_type() != b.weights.get_element_type() ||
+            a.weights.get_shape()[1 - a.weights_axis] != b.weights.get_shape()[1 - b.weights_axis])
+        {
+            return false;
+        }
+        auto matmul_a = as_type_ptr<op::MatmulBias>(a.node);
+        auto matmul_b = as_type_ptr<op::MatmulBias>(b.node);
+        if (matmul_a)
+        {
+            if (matmul_a->get_is_a_transposed() != matmul_b->get_is_a_transposed() ||
+                matmul_a->get_is_b_transposed() != matmul_b->get_is_b_transposed() ||
+                (a.position == 0 ? matmul_a->get_a_shape() != matmul_b->get_a_shape()
+                                 : matmul_a->get_b_shape() != matmul_b->get_b_shape()) ||
+                (a.bias.get_node() == nullptr) != (b.bias.get_node() == nullptr))
+            {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    // Returns true if `value` is computed from any of `nodes`
+    bool depends_on(const Output<Node>& value, const std::unordered_set<Node*>& nodes)
+    {
+        std::unordered_set<Node*> visited;
+        std::vector<Node*> nodes_to_do{value.get_node()};
+        while (!nodes_to_do.empty())
+        {
+            Node* node = nodes_to_do.back();
+            nodes_to_do.pop_back();
+            if (nodes.count(node) != 0)
+            {
+                return true;
+            }
+            if (visited.insert(node).second)
+            {
+                for (auto& input : node->inputs())
+                {
+                    nodes_to_do.push_back(input.get_source_output().get_node());
+                }
+            }
+        }
+        return false;
+    }
+
+    void fuse_dots(const Output<Node>& data, const std::vector<DotSibling>& siblings)
+    {
+        const DotSibling& root = siblings.front();
+        OutputVector weights;
+        OutputVector biases;
+        for (auto& sibling : siblings)
+        {
+            weights.push_back(sibling.weights);
+            if (sibling.bias.get_node())
+            {
+                biases.push_back(sibling.bias);
+            }
+        }
+        auto concat_weights = std::make_shared<op::Concat>(weights, root.weights_axis);
+
+        std::shared_ptr<Node> fused;
+        if (is_type<op::Dot>(root.node))
+        {
+            fused = root.position == 0 ? std::make_shared<op::Dot>(data, concat_weights, 1)
+                                       : std::make_shared<op::Dot>(concat_weights, data, 1);
+        }
+        else
+        {
+            auto matmul = std::static_pointer_cast<op::MatmulBias>(root.node);
+            Output<Node> bias;
+            if (!biases.empty())
+            {
+                bias = std::make_shared<op::Concat>(biases, 0);
+            }
+            Output<Node> W = root.position == 0 ? data : concat_weights;
+            Output<Node> x = root.position == 0 ? concat_weights : data;
+            fused = std::make_shared<op::MatmulBias>(
+                W,
+                x,
+                bias,
+                root.position == 0 ? matmul->get_a_shape() : concat_weights->get_shape(),
+                root.position == 0 ? concat_weights->get_shape() : matmul->get_b_shape(),
+                matmul->get_is_a_transposed(),
+                matmul->get_is_b_transposed(),
+                matmul->get_broadcast_axes());
+        }
+        NGRAPH_DEBUG << "dot_horizontal_fusion: fused " << siblings.size() << " ops into "
+                     << fused->get_name() << " of shape " << fused->get_shape();
+
+        // The slices are contiguous, CPUMemoryOptimization does them in place
+        size_t offset = 0;
+        for (auto& sibling : siblings)
+        {
+            Shape shape = sibling.node->get_shape();
+            Coordinate lower_bounds(shape.size(), 0);
+            Coordinate upper_bounds(shape);
+            lower_bounds[root.output_axis] = offset;
+            offset += shape[root.output_axis];
+            upper_bounds[root.output_axis] = offset;
+            ngraph::replace_node(
+                sibling.node, std::make_shared<op::Slice>(fused, lower_bounds, upper_bounds));
+        }
+    }
+}
+
+void ngraph::runtime::cpu::pass::CPUHorizontalFusion::cpu_dot_horizontal_fusion()
+{
+    auto has_multiple_users = [](std::shared_ptr<Node> n) {
+        for (auto& output : n->outputs())
+        {
+            if (output.get_target_inputs().size() > 1)
+            {
+                return true;
+            }
+        }
+        return false;
+    };
+    auto data = std::make_shared<pattern::op::Label>(element::f32, Shape{}, has_multiple_users);
+
+    auto callback = [](pattern::Matcher& m) {
+        NGRAPH_DEBUG << "dot_horizontal_fusion: In a callback for dot horizontal fusion for "
+                     << m.get_match_root()->get_name();
+
+        bool fused = false;
+        for (auto& output : m.get_match_root()->outputs())
+        {
+            std::vector<DotSibling> candidates;
+            std::unordered_set<Node*> candidate_nodes;
+            for (auto& input : output.get_target_inputs())
+            {
+                DotSibling sibling;
+                if (is_used(input.get_node()) && get_dot_sibling(input, sibling))
+                {
+                    candidates.push_back(sibling);
+                    candidate_nodes.insert(input.get_node());
+                }
+            }
+            // Fusing an op whose weights are computed by a sibling would create a cycle
+            std::vector<DotSibling> independent;
+            for (auto& candidate : candidates)
+            {
+                if (depends_on(candidate.weights, candidate_nodes) ||
+                    (candidate.bias.get_node() && depends_on(candidate.bias, candidate_nodes)))
+                {
+                    NGRAPH_DEBUG << "dot_horizontal_fusion: " << candidate.node->get_name()
+                                 << " depends on a sibling\n";
+                    continue;
+                }
+                independent.push_back(candidate);
+            }
+
+            // Group the siblings that can share a GEMM, in the order of the first member
+            std::vector<std::vector<DotSibling>> groups;
+            for (auto& sibling : independent)
+            {
+                auto group =
+                    std::find_if(groups.begin(),
+                                 groups.end(),
+                                 [&sibling](const std::vector<DotSibling>& g) {
+                                     return can_fuse_dots(g.front(), sibling);
+                                 });
+                if (group == groups.end())
+                {
+                    groups.push_back({sibling});
+                }
+                else
+                {
+                    group->push_back(sibling);
+                }
+            }
+            for (auto& group : groups)
+            {
+                if (group.size() > 1)
+                {
+                    fuse_dots(output, group);
+                    fused = true;
+                }
+            }
+        }
+        return fused;
+    };
+
+    auto m = make_shared<pattern::Matcher>(data, "CPUHorizontalFusion.CpuDotHorizontalFusion");
+    this->add_matcher(m, callback);
+}
@@ -39,8 +39,12 @@ public:
         : GraphRewrite()
     {
         cpu_conv_horizontal_fusion();
+        cpu_dot_horizontal_fusion();
     }
 
 private:
     void cpu_conv_horizontal_fusion();
+    // Fuses sibling Dot and MatmulBias ops that share an input into one larger GEMM over
+    // their concatenated weights
+    void cpu_dot_horizontal_fusion();
 };
@@ -15,10 +15,14 @@
 //*****************************************************************************
 
 #include <algorithm>
+#include <cstdint>
+#include <limits>
 #include <memory>
 #include <string>
 #include <typeindex>
 #include <typeinfo>
+#include <unordered_map>
+#include <unordered_set>
 
 #include <mkldnn.hpp>
 
@@ -79,6 +83,33 @@ using namespace ngraph::runtime::cpu;
 #define FORMAT format_tag
 #endif
 
+// Returns a ConvertLayout of `output` to `layout`. A conversion already inserted for another
+// user of `output` is reused, so each tensor is reordered at most once into any layout.
+static shared_ptr<Node> get_conversion(const descriptor::Output& output,
+                                       const shared_ptr<runtime::cpu::LayoutDescriptor>& layout)
+{
+    for (descriptor::Input* user_input : output.get_inputs())
+    {
+        auto convert =
+            dynamic_cast<runtime::cpu::op::ConvertLayout*>(user_input->get_raw_pointer_node());
+        if (convert && convert->get_output_size() == 1)
+        {
+            auto convert_layout = dynamic_pointer_cast<runtime::cpu::LayoutDescriptor>(
+                convert->get_output_tensor_ptr()->get_tensor_layout());
+            if (convert_layout && convert_layout->is_mkldnn_layout() &&
+                mkldnn_utils::compare_mkldnn_mds(convert_layout->get_mkldnn_md(),
+                                                 layout->get_mkldnn_md()))
+            {
+                NGRAPH_DEBUG << "Reusing conversion node " << convert->get_name() << " of "
+                             << output.get_node()->get_name();
+                return convert->shared_from_this();
+            }
+        }
+    }
+    return std::shared_ptr<Node>(
+        new runtime::cpu::op::ConvertLayout(output.get_node(), output.get_index(), layout));
+}
+
 // Check if the input layout matches the layout requested in `required_mds`
 // If not, insert a layout conversion node between the input tensor and
 // the `node`. For now, only MKLDNN nodes/kernels can request specific layouts
@@ -127,8 +158,7 @@ static shared_ptr<Node>
         {
             auto layout = std::make_shared<ngraph::runtime::cpu::LayoutDescriptor>(*tv);
             layout->set_mkldnn_md(required_mds[index]);
-            auto new_node = std::shared_ptr<Node>(
-                new runtime::cpu::op::ConvertLayout(output.get_node(), output.get_index(), layout));
+            auto new_node = get_conversion(output, layout);
             new_args.push_back(new_node);
             replace_node = true;
 #if MKLDNN_VERSION_MAJOR < 1
@@ -215,8 +245,7 @@ static void set_native_layouts(runtime::cpu::CPU_ExternalFunction* external_func
             {
                 auto layout = std::make_shared<ngraph::runtime::cpu::LayoutDescriptor>(*tv);
                 layout->set_mkldnn_md(native_md);
-                auto new_node = std::shared_ptr<Node>(new runtime::cpu::op::ConvertLayout(
-                    output.get_node(), output.get_index(), layout));
+                auto new_node = get_conversion(output, layout);
                 new_args.push_back(new_node);
                 if (use_replace)
                 {
@@ -287,8 +316,18 @@ static void set_native_layouts(runtime::cpu::CPU_ExternalFunction* external_func
     }
 }
 
+// Layout plan_eltwise_layouts picked for an elementwise op. Ops it could not model keep the
+// local choice.
+enum class EltwisePlan
+{
+    Local,
+    Mkldnn,
+    Native
+};
+
 static void set_layouts_unaryeltwise(ngraph::runtime::cpu::CPU_ExternalFunction* external_function,
-                                     std::shared_ptr<ngraph::Node> node)
+                                     std::shared_ptr<ngraph::Node> node,
+                                     EltwisePlan plan)
 {
     auto input_md = mkldnn_utils::get_input_mkldnn_md(node.get(), 0);
     // Non MKLDNN kernels can handle MKLDNN layouts as long as there are not padded
@@ -303,7 +342,7 @@ static void set_layouts_unaryeltwise(ngraph::runtime::cpu::CPU_ExternalFunction*
                !mkldnn_utils::is_mkldnn_padded_layout(
                    input_md, ngraph::get_default_order(node->get_input_shape(0)));
 #endif
-    if (mkldnn_utils::use_mkldnn_kernel(node.get()) || md_check)
+    if (plan != EltwisePlan::Native && (mkldnn_utils::use_mkldnn_kernel(node.get()) || md_check))
     {
         vector<memory::desc> o_mds;
         o_mds.push_back(input_md);
@@ -315,8 +354,75 @@ static void set_layouts_unaryeltwise(ngraph::runtime::cpu::CPU_ExternalFunction*
     }
 }
 
+// Users that will not accept an MKLDNN specific layout and reorder their input to native
+static bool needs_native_layout(const Node* user)
+{
+    if (auto result = dynamic_cast<const ngraph::op::Result*>(user))
+    {
+        return result->needs_default_layout();
+    }
+    if (user->is_unary_elementwise_arithmetic() || user->is_binary_elementwise_arithmetic())
+    {
+        return false;
+    }
+    return !mkldnn_utils::use_mkldnn_kernel(user);
+}
+
+// Picks the argument whose layout a binary elementwise op adopts. The choice that reorders
+// fewer bytes wins: the other argument if its layout differs. Without a plan, the op looks only
+// at its direct users, and the output costs a reorder if some user will need it in the native
+// layout (one shared reorder serves all such users). With a plan to keep an MKLDNN layout, an
+// argument in the native layout is only picked if both are.
+static int select_eltwise_layout(const Node* node,
+                                 const vector<memory::desc>& arg_mds,
+                                 EltwisePlan plan)
+{
+    const Shape& shape = node->get_output_shape(0);
+    const element::Type& et = node->get_output_element_type(0);
+    auto native_md = mkldnn_utils::create_blocked_mkldnn_md(shape, row_major_strides(shape), et);
+    bool native_user = false;
+    if (plan == EltwisePlan::Local)
+    {
+        for (const auto& user : node->get_users())
+        {
+            native_user = native_user || needs_native_layout(user.get());
+        }
+    }
+
+    int best = -1;
+    size_t best_cost = 0;
+    for (int select = 0; select < 2; select++)
+    {
+        bool native = mkldnn_utils::compare_mkldnn_mds(arg_mds[select], native_md);
+        if (plan == EltwisePlan::Mkldnn && native)
+        {
+            continue;
+        }
+        size_t cost = 0;
+        for (size_t i = 0; i < arg_mds.size(); i++)
+        {
+            if (!mkldnn_utils::compare_mkldnn_mds(arg_mds[i], arg_mds[select]))
+            {
+                cost += shape_size(node->get_input_shape(i)) *
+                        node->get_input_element_type(i).size();
+            }
+        }
+        if (native_user && !native)
+        {
+            cost += shape_size(shape) * et.size();
+        }
+        if (best < 0 || cost < best_cost)
+        {
+            best = select;
+            best_cost = cost;
+        }
+    }
+    return best < 0 ? 0 : best;
+}
+
 void set_layouts_binaryeltwise(ngraph::runtime::cpu::CPU_ExternalFunction* external_function,
-                               std::shared_ptr<ngraph::Node> node)
+                               std::shared_ptr<ngraph::Node> node,
+                               EltwisePlan plan)
 {
     std::vector<mkldnn::memory::desc> arg_mds{mkldnn_utils::get_input_mkldnn_md(node.get(), 0),
                                               mkldnn_utils::get_input_mkldnn_md(node.get(), 1)};
@@ -338,11 +444,11 @@ void set_layouts_binaryeltwise(ngraph::runtime::cpu::CPU_ExternalFunction* exter
                !mkldnn_utils::is_mkldnn_padded_layout(
                    arg_mds[1], ngraph::get_default_order(node->get_input_shape(1)));
 #endif
-    if (mkldnn_utils::use_mkldnn_kernel(node.get()) || md_check)
+    if (plan != EltwisePlan::Native && (mkldnn_utils::use_mkldnn_kernel(node.get()) || md_check))
     {
         vector<memory::desc> i_mds;
         vector<memory::desc> o_mds;
-        int select = 0;
+        int select = select_eltwise_layout(node.get(), arg_mds, plan);
         char* ngraph_pass_cpu_layout_eltwise = std::getenv("NGRAPH_PASS_CPU_LAYOUT_ELTWISE");
         if (ngraph_pass_cpu_layout_eltwise != nullptr)
         {
@@ -2690,23 +2796,474 @@ static const runtime::cpu::pass::LayoutOpMap s_dispatcher{
      &runtime::cpu::pass::CPULayout::layout<ngraph::op::QuantizedMatmul>},
 };
 
+namespace
+{
+    const uint64_t s_infinite_capacity = numeric_limits<uint64_t>::max() / 4;
+
+    // Minimum s-t cut of a directed graph, found with Dinic's max-flow algorithm
+    class LayoutCut
+    {
+    public:
+        size_t add_node()
+        {
+            m_adjacency.emplace_back();
+            return m_adjacency.size() - 1;
+        }
+
+        void add_edge(size_t from, size_t to, uint64_t capacity)
+        {
+            m_adjacency[from].push_back(m_to.size());
+            m_to.push_back(to);
+            m_capacity.push_back(capacity);
+            m_adjacency[to].push_back(m_to.size());
+            m_to.push_back(from);
+            m_capacity.push_back(0);
+        }
+
+        // Returns, for each node, whether it is on the sink side of a minimum cut. Nodes that fit
+        // on either side are put on the source side.
+        vector<bool> solve(size_t source, size_t sink)
+        {
+            while (build_levels(source, sink))
+            {
+                m_next.assign(m_adjacency.size(), 0);
+                while (augment(source, sink) > 0)
+                {
+                }
+            }
+
+            vector<bool> sink_side(m_adjacency.size(), false);
+            vector<size_t> stack{sink};
+            sink_side[sink] = true;
+            while (!stack.empty())
+            {
+                size_t node = stack.back();
+                stack.pop_back();
+                for (size_t edge : m_adjacency[node])
+                {
+                    // edge ^ 1 is the residual edge from m_to[edge] into node
+                    size_t from = m_to[edge];
+                    if (!sink_side[from] && m_capacity[edge ^ 1] > 0)
+                    {
+                        sink_side[from] = true;
+                        stack.push_back(from);
+                    }
+                }
+            }
+            return sink_side;
+        }
+
+    private:
+        bool build_levels(size_t source, size_t sink)
+        {
+            m_level.assign(m_adjacency.size(), -1);
+            m_level[source] = 0;
+            vector<size_t> queue{source};
+            for (size_t i = 0; i < queue.size(); i++)
+            {
+                size_t node = queue[i];
+                for (size_t edge : m_adjacency[node])
+                {
+                    if (m_capacity[edge] > 0 && m_level[m_to[edge]] < 0)
+                    {
+                        m_level[m_to[edge]] = m_level[node] + 1;
+                        queue.push_back(m_to[edge]);
+                    }
+                }
+            }
+            return m_level[sink] >= 0;
+        }
+
+        // Pushes flow along one shortest augmenting path and returns the amount pushed
+        uint64_t augment(size_t source, size_t sink)
+        {
+            vector<size_t> path;
+            size_t node = source;
+            while (node != sink)
+            {
+                size_t& next = m_next[node];
+                while (next < m_adjacency[node].size())
+                {
+                    size_t edge = m_adjacency[node][next];
+                    if (m_capacity[edge] > 0 && m_level[m_to[edge]] == m_level[node] + 1)
+                    {
+                        break;
+                    }
+                    next++;
+                }
+                if (next < m_adjacency[node].size())
+                {
+                    path.push_back(m_adjacency[node][next]);
+                    node = m_to[path.back()];
+                }
+                else if (path.empty())
+                {
+                    return 0;
+                }
+                else
+                {
+                    // Dead end, so no path of this phase goes through node
+                    m_level[node] = -1;
+                    node = m_to[path.back() ^ 1];
+                    path.pop_back();
+                    m_next[node]++;
+                }
+            }
+
+            uint64_t flow = s_infinite_capacity;
+            for (size_t edge : path)
+            {
+                flow = std::min(flow, m_capacity[edge]);
+            }
+            for (size_t edge : path)
+            {
+                m_capacity[edge] -= flow;
+                m_capacity[edge ^ 1] += flow;
+            }
+            return flow;
+        }
+
+        vector<size_t> m_to;
+        vector<uint64_t> m_capacity;
+        vector<vector<size_t>> m_adjacency;
+        vector<int> m_level;
+        vector<size_t> m_next;
+    };
+
+    // How an op takes part in the layout plan
+    enum class PlanRole
+    {
+        // Handled by a handler the planner does not model; the op keeps its local choice
+        Neutral,
+        // Always reads and writes native layouts
+        Native,
+        // MKLDNN op that picks blocked layouts for its outputs and rank 4+ inputs
+        Blocked,
+        // Passes on the layout of one input to its outputs
+        Follower,
+        // Elementwise op that can either keep an MKLDNN layout or run in the native layout
+        Eltwise
+    };
+
+    struct PlanNode
+    {
+        PlanRole role;
+        // Cut node for the layout of the outputs: the source for MKLDNN, the sink for native
+        size_t cut_node;
+    };
+
+    // A tensor whose layout conversion depends on the plan
+    struct PlanTensor
+    {
+        size_t producer;
+        vector<size_t> consumers;
+        size_t bytes;
+    };
+
+    struct EltwiseLayoutPlan
+    {
+        unordered_map<const Node*, EltwisePlan> plans;
+        int64_t eliminated_reorder_count = 0;
+        size_t eliminated_reorder_bytes = 0;
+    };
+}
+
+// MKLDNN ops whose handlers query MKLDNN for blocked input and output layouts
+static const unordered_set<type_index> s_blocked_layout_ops{
+    TI(ngraph::op::Convolution),
+    TI(ngraph::op::ConvolutionAdd),
+    TI(ngraph::op::ConvolutionBackpropData),
+    TI(ngraph::op::ConvolutionBackpropFilters),
+    TI(ngraph::op::ConvolutionBias),
+    TI(ngraph::op::ConvolutionBiasAdd),
+    TI(ngraph::op::ConvolutionBiasBackpropFiltersBias),
+    TI(ngraph::op::ConvolutionRelu),
+    TI(ngraph::op::DeconvolutionBias),
+    TI(ngraph::op::GroupConvolution),
+    TI(ngraph::op::GroupConvolutionBias),
+    TI(ngraph::op::QuantizedConvolution),
+    TI(ngraph::op::QuantizedConvolutionBias),
+    TI(ngraph::op::QuantizedConvolutionBiasAdd),
+    TI(ngraph::op::QuantizedConvolutionBiasSignedAdd),
+    TI(ngraph::op::QuantizedConvolutionRelu),
+};
+
+// Ops whose handlers pick layouts by rules the planner does not model
+static const unordered_set<type_index> s_unplanned_layout_ops{
+    TI(ngraph::op::Concat),
+    TI(ngraph::op::Lstm),
+    TI(ngraph::op::QuantizedDotBias),
+    TI(ngraph::op::QuantizedMatmul),
+    TI(ngraph::op::Reshape),
+    TI(ngraph::op::Rnn),
+    TI(ngraph::op::Slice),
+};
+
+// The input whose layout a follower passes on: the first one of the highest rank
+static size_t get_layout_source_input(const Node* node)
+{
+    size_t source = 0;
+    for (size_t i = 1; i < node->get_input_size(); i++)
+    {
+        if (node->get_input_shape(i).size() > node->get_input_shape(source).size())
+        {
+            source = i;
+        }
+    }
+    return source;
+}
+
+// Decides for each elementwise op whether it keeps an MKLDNN layout or runs in the native layout,
+// so that the layout conversions in the whole graph move as few bytes as possible.
+//
+// Each op's output layout is a label: MKLDNN (the source side of a cut) or native (the sink
+// side). Blocked layout ops are tied to the source, native ops to the sink, and followers share
+// the label of their layout source. A tensor costs one conversion of its size if some consumer
+// wants a label other than the producer's. All consumers that want the same label share that
+// conversion. This cost is modelled exactly with two auxiliary cut nodes per tensor, so a minimum
+// cut is an optimal plan. Ops behind an unplanned op keep their local choice.
+//
+// The plan is compared with the per-op choices the handlers make without it, and the difference
+// is reported as the conversions eliminated.
+static EltwiseLayoutPlan plan_eltwise_layouts(const list<shared_ptr<Node>>& nodes)
+{
+    EltwiseLayoutPlan result;
+    LayoutCut cut;
+    const size_t source = cut.add_node();
+    const size_t sink = cut.add_node();
+
+    unordered_map<const Node*, PlanNode> plan_nodes;
+    vector<const Node*> eltwise_ops;
+    auto get_plan_node = [&plan_nodes](const Node* node) -> const PlanNode* {
+        auto it = plan_nodes.find(node);
+        return it == plan_nodes.end() || it->second.role == PlanRole::Neutral ? nullptr
+                                                                               : &it->second;
+    };
+    auto get_producer = [](const Node* node, size_t i) { return node->input_value(i).get_node(); };
+
+    for (const auto& node : nodes)
+    {
+        const Node* n = node.get();
+        PlanNode plan_node{PlanRole::Neutral, 0};
+        bool dispatched = s_dispatcher.find(TI(*n)) != s_dispatcher.end();
+        auto as_result = dynamic_cast<const ngraph::op::Result*>(n);
+        if (!dispatched &&
+            (n->is_unary_elementwise_arithmetic() || n->is_binary_elementwise_arithmetic()))
+        {
+            bool planned = true;
+            for (size_t i = 0; i < n->get_input_size(); i++)
+            {
+                planned = planned && get_plan_node(get_producer(n, i)) != nullptr;
+            }
+            if (planned)
+            {
+                plan_node = PlanNode{PlanRole::Eltwise, cut.add_node()};
+                eltwise_ops.push_back(n);
+            }
+        }
+        else if (!dispatched)
+        {
+            plan_node = PlanNode{PlanRole::Native, sink};
+        }
+        else if (s_unplanned_layout_ops.count(TI(*n)) != 0)
+        {
+        }
+        else if (as_result)
+        {
+            if (as_result->needs_default_layout())
+            {
+                plan_node = PlanNode{PlanRole::Native, sink};
+            }
+        }
+        else if (mkldnn_utils::use_mkldnn_kernel(n) || is_type<ngraph::op::GetOutputElement>(n))
+        {
+            if (s_blocked_layout_ops.count(TI(*n)) != 0)
+            {
+                plan_node = PlanNode{PlanRole::Blocked, source};
+            }
+            else if (n->get_input_size() > 0)
+            {
+                auto layout_source = get_plan_node(get_producer(n, get_layout_source_input(n)));
+                if (layout_source)
+                {
+                    plan_node = PlanNode{PlanRole::Follower, layout_source->cut_node};
+                }
+            }
+        }
+        else
+        {
+            plan_node = PlanNode{PlanRole::Native, sink};
+        }
+        plan_nodes[n] = plan_node;
+    }
+
+    if (eltwise_ops.empty())
+    {
+        return result;
+    }
+
+    // Conversions a consumer needs, by the cut node of the label it wants for the input
+    vector<PlanTensor> tensors;
+    for (const auto& node : nodes)
+    {
+        auto producer = get_plan_node(node.get());
+        if (!producer)
+        {
+            continue;
+        }
+        for (const Output<Node>& output : node->outputs())
+        {
+            PlanTensor tensor{producer->cut_node,
+                              {},
+                              shape_size(output.get_shape()) * output.get_element_type().size()};
+            // Only tensors next to an elementwise op's label change cost with the plan
+            auto is_eltwise_label = [source, sink](size_t cut_node) {
+                return cut_node != source && cut_node != sink;
+            };
+            bool planned = is_eltwise_label(tensor.producer);
+            for (const Input<Node>& input : output.get_target_inputs())
+            {
+                auto consumer = get_plan_node(input.get_node());
+                if (!consumer || consumer->role == PlanRole::Follower ||
+                    (consumer->role == PlanRole::Blocked && input.get_shape().size() < 4))
+                {
+                    continue;
+                }
+                planned = planned || is_eltwise_label(consumer->cut_node);
+                if (consumer->cut_node != tensor.producer &&
+                    std::find(tensor.consumers.begin(),
+                              tensor.consumers.end(),
+                              consumer->cut_node) == tensor.consumers.end())
+                {
+                    tensor.consumers.push_back(consumer->cut_node);
+                }
+            }
+            if (planned && !tensor.consumers.empty())
+            {
+                tensors.push_back(tensor);
+            }
+        }
+    }
+
+    // Bytes decide the cut; among cuts that move the same bytes, fewer conversions win
+    const uint64_t weight_per_byte = tensors.size() + 1;
+    for (const PlanTensor& tensor : tensors)
+    {
+        uint64_t weight = tensor.bytes * weight_per_byte + 1;
+        if (tensor.consumers.size() == 1)
+        {
+            cut.add_edge(tensor.producer, tensor.consumers[0], weight);
+            cut.add_edge(tensor.consumers[0], tensor.producer, weight);
+            continue;
+        }
+        // Cut once if the producer keeps an MKLDNN layout and some consumer wants native
+        size_t to_native = cut.add_node();
+        cut.add_edge(tensor.producer, to_native, weight);
+        // Cut once if the producer is native and some consumer wants an MKLDNN layout
+        size_t to_mkldnn = cut.add_node();
+        cut.add_edge(to_mkldnn, tensor.producer, weight);
+        for (size_t consumer : tensor.consumers)
+        {
+            cut.add_edge(to_native, consumer, s_infinite_capacity);
+            cut.add_edge(consumer, to_mkldnn, s_infinite_capacity);
+        }
+    }
+    vector<bool> native = cut.solve(source, sink);
+
+    // The handlers' own choices: unary ops keep the layout of their argument, and binary ops
+    // take the argument layout select_eltwise_layout costs lower
+    vector<bool> local_native(native.size(), false);
+    local_native[sink] = true;
+    for (const Node* n : eltwise_ops)
+    {
+        vector<size_t> args;
+        for (size_t i = 0; i < n->get_input_size(); i++)
+        {
+            args.push_back(get_plan_node(get_producer(n, i))->cut_node);
+        }
+        bool select_native = local_native[args[0]];
+        if (args.size() == 2 && local_native[args[0]] != local_native[args[1]])
+        {
+            bool native_user = false;
+            for (const auto& user : n->get_users())
+            {
+                native_user = native_user || needs_native_layout(user.get());
+            }
+            size_t output_bytes = shape_size(n->get_output_shape(0)) *
+                                  n->get_output_element_type(0).size();
+            size_t cost[2];
+            for (size_t select = 0; select < 2; select++)
+            {
+                size_t other = 1 - select;
+                cost[select] = shape_size(n->get_input_shape(other)) *
+                               n->get_input_element_type(other).size();
+                if (native_user && !local_native[args[select]])
+                {
+                    cost[select] += output_bytes;
+                }
+            }
+            select_native = local_native[args[cost[1] < cost[0] ? 1 : 0]];
+        }
+        local_native[plan_nodes[n].cut_node] = select_native;
+    }
+
+    int64_t planned_count = 0;
+    int64_t local_count = 0;
+    size_t planned_bytes = 0;
+    size_t local_bytes = 0;
+    for (const PlanTensor& tensor : tensors)
+    {
+        bool planned_reorder = false;
+        bool local_reorder = false;
+        for (size_t consumer : tensor.consumers)
+        {
+            planned_reorder = planned_reorder || native[consumer] != native[tensor.producer];
+            local_reorder =
+                local_reorder || local_native[consumer] != local_native[tensor.producer];
+        }
+        planned_count += planned_reorder ? 1 : 0;
+        planned_bytes += planned_reorder ? tensor.bytes : 0;
+        local_count += local_reorder ? 1 : 0;
+        local_bytes += local_reorder ? tensor.bytes : 0;
+    }
+
+    for (const Node* n : eltwise_ops)
+    {
+        result.plans[n] =
+            native[plan_nodes[n].cut_node] ? EltwisePlan::Native : EltwisePlan::Mkldnn;
+    }
+    result.eliminated_reorder_count = local_count - planned_count;
+    result.eliminated_reorder_bytes = local_bytes - planned_bytes;
+    return result;
+}
+
 bool runtime::cpu::pass::CPULayout::run_on_call_graph(const std::list<std::shared_ptr<Node>>& nodes)
 {
+    EltwiseLayoutPlan plan = plan_eltwise_layouts(nodes);
+    m_eliminated_reorder_count = plan.eliminated_reorder_count;
+    m_eliminated_reorder_bytes = plan.eliminated_reorder_bytes;
+    NGRAPH_DEBUG << "CPULayout: layout plan for " << plan.plans.size()
+                 << " elementwise ops eliminates " << m_eliminated_reorder_count
+                 << " layout conversions moving " << m_eliminated_reorder_bytes << " bytes";
+
     for (const auto& node : nodes)
     {
         auto& n = *node;
         auto handler = s_dispatcher.find(TI(n));
+        auto eltwise_plan = plan.plans.find(node.get());
+        EltwisePlan planned =
+            eltwise_plan == plan.plans.end() ? EltwisePlan::Local : eltwise_plan->second;
         if (handler != s_dispatcher.end())
         {
             handler->second(m_external_function, node);
         }
         else if (node->is_unary_elementwise_arithmetic())
         {
-            set_layouts_unaryeltwise(m_external_function, node);
+            set_layouts_unaryeltwise(m_external_function, node, planned);
         }
         else if (node->is_binary_elementwise_arithmetic())
         {
-            set_layouts_binaryeltwise(m_external_function, node);
+            set_layouts_binaryeltwise(m_external_function, node, planned);
         }
         else
         {
@@ -2714,5 +3271,27 @@ bool runtime::cpu::pass::CPULayout::run_on_call_graph(const std::list<std::share
         }
     }
 
+    m_reorder_count = 0;
+    m_reorder_bytes = 0;
+    m_shared_reorder_count = 0;
+    m_shared_reorder_bytes = 0;
+    for (const auto& node : m_external_function->get_function()->get_ops())
+    {
+        if (is_type<runtime::cpu::op::ConvertLayout>(node))
+        {
+            size_t users = node->output(0).get_target_inputs().size();
+            size_t shared = users > 1 ? users - 1 : 0;
+            size_t bytes = shape_size(node->get_output_shape(0)) *
+                           node->get_output_element_type(0).size();
+            m_reorder_count++;
+            m_reorder_bytes += bytes;
+            m_shared_reorder_count += shared;
+            m_shared_reorder_bytes += shared * bytes;
+        }
+    }
+    NGRAPH_DEBUG << "CPULayout: " << m_reorder_count << " layout conversions moving "
+                 << m_reorder_bytes << " bytes, " << m_shared_reorder_count
+                 << " conversions of " << m_shared_reorder_bytes << " bytes avoided by sharing";
+
     return false;
 }
@@ -16,6 +16,8 @@
 
 #pragma once
 
+#include <cstdint>
+
 #include "ngraph/pass/pass.hpp"
 #include "ngraph/runtime/cpu/cpu_external_function.hpp"
 
@@ -46,6 +48,33 @@ namespace ngraph
                     virtual bool
                         run_on_call_graph(const std::list<std::shared_ptr<Node>>& nodes) override;
 
+                    /// \return Number of layout conversions in the function after the pass
+                    size_t get_reorder_count() const { return m_reorder_count; }
+                    /// \return Bytes the layout conversions in the function move per call
+                    size_t get_reorder_bytes() const { return m_reorder_bytes; }
+                    /// \return Number of conversions avoided by sharing one conversion between
+                    ///         all users that need a tensor in the same layout
+                    size_t get_shared_reorder_count() const { return m_shared_reorder_count; }
+                    /// \return Bytes per call the shared conversions would have moved again.
+                    ///         Without sharing, conversions would move get_reorder_bytes() plus
+                    ///         this many bytes.
+                    size_t get_shared_reorder_bytes() const { return m_shared_reorder_bytes; }
+                    /// \return Number of layout conversions the graph-level layout plan for
+                    ///         elementwise ops eliminates, compared with each op choosing its
+                    ///         layout from its arguments and direct users. The plan minimizes
+                    ///         bytes moved, so this can be negative if it trades one large
+                    ///         conversion for several smaller ones.
+                    int64_t get_eliminated_reorder_count() const
+                    {
+                        return m_eliminated_reorder_count;
+                    }
+                    /// \return Bytes per call the conversions eliminated by the layout plan
+                    ///         would have moved
+                    size_t get_eliminated_reorder_bytes() const
+                    {
+                        return m_eliminated_reorder_bytes;
+                    }
+
                     template <typename OP>
                     static void
                         layout(ngraph::runtime::cpu::CPU_ExternalFunction* external_function,
@@ -53,6 +82,12 @@ namespace ngraph
 
                 private:
                     CPU_ExternalFunction* m_external_function;
+                    size_t m_reorder_count = 0;
+                    size_t m_reorder_bytes = 0;
+                    size_t m_shared_reorder_count = 0;
+                    size_t m_shared_reorder_bytes = 0;
+                    int64_t m_eliminated_reorder_count = 0;
+                    size_t m_eliminated_reorder_bytes = 0;
                 };
             }
         }
@@ -14,6 +14,7 @@
 // limitations under the License.
 //*****************************************************************************
 
+#include <deque>
 #include <exception>
 #include <sstream>
 
@@ -657,8 +658,10 @@ bool runtime::cpu::pass::CPUMemoryAssignment::run_on_function(shared_ptr<ngraph:
 
     // memory assignment using liveness analysis result
 
-    // memory manager for non-cacheable ops, memory allocation will be freed when not longer in use
-    ngraph::pass::MemoryManager mm(m_alignment, m_disable_memory_sharing);
+    // memory planner for non-cacheable ops, memory allocation will be freed when not longer in
+    // use. Offsets are assigned once all lifetimes are known.
+    ngraph::pass::MemoryPlanner mm(m_alignment);
+    unordered_map<descriptor::Tensor*, size_t> buffer_ids;
     // memory manager for cacheable ops, memory allocation will never be freed
     ngraph::pass::MemoryManager mm_caching(m_alignment, true);
 
@@ -794,9 +797,18 @@ bool runtime::cpu::pass::CPUMemoryAssignment::run_on_function(shared_ptr<ngraph:
                         // do not combine those two sets.
                         // change the label of output tensor set to that of input tensor set
                         output_buffer_it->second.first = input_buffer_it->second.first;
+                        auto input_id = buffer_ids.find(input_tensor);
                         for (auto& ele_t : output_set)
                         {
-                            ele_t->set_pool_offset(offset);
+                            if (input_id != buffer_ids.end())
+                            {
+                                // share the planned buffer, its offset is assigned later
+                                buffer_ids[ele_t] = input_id->second;
+                            }
+                            else
+                            {
+                                ele_t->set_pool_offset(offset);
+                            }
                         }
                     }
                 }
@@ -825,15 +837,20 @@ bool runtime::cpu::pass::CPUMemoryAssignment::run_on_function(shared_ptr<ngraph:
             if (m_tensor_caching.count(tensor) != 0)
             {
                 offset = mm_caching.allocate(size);
+                tensor->set_pool_offset(offset);
+                for (auto& e : tensor_set)
+                {
+                    e->set_pool_offset(offset);
+                }
             }
             else
             {
-                offset = mm.allocate(size);
-            }
-            tensor->set_pool_offset(offset);
-            for (auto& e : tensor_set)
-            {
-                e->set_pool_offset(offset);
+                size_t id = mm.allocate(size);
+                buffer_ids[tensor] = id;
+                for (auto& e : tensor_set)
+                {
+                    buffer_ids[e] = id;
+                }
             }
         }
 
@@ -846,15 +863,25 @@ bool runtime::cpu::pass::CPUMemoryAssignment::run_on_function(shared_ptr<ngraph:
                 {
                     continue;
                 }
-                if (m_tensor_caching.empty() ||
-                    (!m_tensor_caching.empty() && m_tensor_caching.count(tensor) == 0))
+                // Tensors placed in the buffer of an input that was not planned here, such
+                // as a parameter or a cacheable tensor, have no buffer of their own to free
+                auto id = buffer_ids.find(tensor);
+                if ((m_tensor_caching.empty() ||
+                     (!m_tensor_caching.empty() && m_tensor_caching.count(tensor) == 0)) &&
+                    id != buffer_ids.end())
                 {
-                    mm.free(tensor->get_pool_offset());
+                    mm.free(id->second);
                 }
             }
         }
     }
 
+    mm.plan();
+    for (auto& tensor_id : buffer_ids)
+    {
+        tensor_id.first->set_pool_offset(mm.get_offset(tensor_id.second));
+    }
+
     // update offsets in concat and slice tensors set.
     // In place concatenation optimization
     process_in_place_concat(ops);
@@ -877,7 +904,8 @@ bool runtime::cpu::pass::CPUMemoryAssignment::run_on_function(shared_ptr<ngraph:
         }
     }
 
-    NGRAPH_DEBUG << "cpu_memory_assignemnt: max allocated for mm is " << mm.max_allocated();
+    NGRAPH_DEBUG << "cpu_memory_assignemnt: max allocated for mm is " << mm.max_allocated()
+                 << ", lower bound " << mm.get_lower_bound();
     NGRAPH_DEBUG << "cpu_memory_assignment: max allocated for mm_caching is "
                  << mm_caching.max_allocated();
     NGRAPH_DEBUG << "cpu_memory_assignment: max allocated in total is "
@@ -19,6 +19,7 @@
 #include <initializer_list>
 #include <iostream>
 #include <memory>
+#include <mutex>
 #include <sstream>
 #include <string>
 #include <vector>
@@ -26,9 +27,15 @@
 #include "ngraph/ops.hpp"
 #include "ngraph/runtime/aligned_buffer.hpp"
 #include "ngraph/runtime/backend.hpp"
+#include "ngraph/runtime/generic_cpu/kernel/batch_norm.hpp"
 #include "ngraph/runtime/generic_cpu/kernel/broadcast.hpp"
+#include "ngraph/runtime/generic_cpu/kernel/convolution.hpp"
 #include "ngraph/runtime/generic_cpu/kernel/dot.hpp"
+#include "ngraph/runtime/generic_cpu/kernel/elementwise.hpp"
+#include "ngraph/runtime/generic_cpu/kernel/pool.hpp"
+#include "ngraph/runtime/generic_cpu/kernel/reduce.hpp"
 #include "ngraph/runtime/generic_cpu/kernel/reshape.hpp"
+#include "ngraph/runtime/generic_cpu/kernel/softmax.hpp"
 #include "ngraph/runtime/host_tensor.hpp"
 #include "ngraph/runtime/reference/abs.hpp"
 #include "ngraph/runtime/reference/acos.hpp"
@@ -124,21 +131,18 @@ namespace ngraph
             class GCPUBackend;
             class GCPUExecutable;
 
-            namespace
+            // This expands the op list in op_tbl.hpp into a list of enumerations that look like
+            // this:
+            // Abs,
+            // Acos,
+            // ...
+            enum class OP_TYPEID
             {
-                // This expands the op list in op_tbl.hpp into a list of enumerations that look like
-                // this:
-                // Abs,
-                // Acos,
-                // ...
-                enum class OP_TYPEID
-                {
-#define NGRAPH_OP(NAME, NAMESPACE) a,
+#define NGRAPH_OP(NAME, NAMESPACE) NAME,
 #include "ngraph/opsets/opset0_tbl.hpp"
 #undef NGRAPH_OP
-                    UnknownOp
-                };
-            }
+                UnknownOp
+            };
         } // namespace gcpu
     }     // namespace runtime
 } // namespace ngraph
@@ -169,22 +173,88 @@ private:
     bool m_performance_counters_enabled = false;
     std::shared_ptr<Function> m_function;
     std::unordered_map<std::shared_ptr<const Node>, stopwatch> m_timer_map;
-    std::vector<std::shared_ptr<Node>> m_nodes;
     std::unordered_map<const Node*, std::shared_ptr<ngraph::State>> m_states;
     std::set<std::string> m_unsupported_op_name_list;
 
+    using OpEngine = void (GCPUExecutable::*)(OP_TYPEID,
+                                              const Node&,
+                                              const std::vector<std::shared_ptr<HostTensor>>&,
+                                              const std::vector<std::shared_ptr<HostTensor>>&);
+
+    // An op of the function, with its kernel resolved when compiled
+    struct OpCall
+    {
+        std::shared_ptr<Node> node;
+        OP_TYPEID type_id;
+        element::Type type;
+        // nullptr if the element type is not supported
+        OpEngine engine;
+        // nullptr unless performance counters are enabled
+        stopwatch* timer;
+    };
+
+    // An op input or output, by its index in m_calls and in the op
+    struct TensorUse
+    {
+        size_t call;
+        size_t index;
+    };
+
+    // A tensor passed between two ops of the function
+    struct Intermediate
+    {
+        element::Type type;
+        Shape shape;
+        std::string name;
+        TensorUse output;
+        std::vector<TensorUse> inputs;
+    };
+
+    // The tensors of the ops of one call. A frame owns its intermediate tensors, and is bound to
+    // the function inputs and outputs of the call using it.
+    struct CallFrame
+    {
+        std::vector<std::vector<std::shared_ptr<HostTensor>>> inputs;
+        std::vector<std::vector<std::shared_ptr<HostTensor>>> outputs;
+    };
+
+    // Takes a frame from the pool and binds it to the tensors of a call, then unbinds it and
+    // returns it to the pool when destroyed
+    class BoundFrame
+    {
+    public:
+        BoundFrame(GCPUExecutable& executable,
+                   const std::vector<std::shared_ptr<Tensor>>& outputs,
+                   const std::vector<std::shared_ptr<Tensor>>& inputs);
+        ~BoundFrame();
+        CallFrame& get() { return *m_frame; }
+
+    private:
+        GCPUExecutable& m_executable;
+        std::unique_ptr<CallFrame> m_frame;
+    };
+
+    std::vector<OpCall> m_calls;
+    std::vector<std::vector<TensorUse>> m_input_uses;
+    std::vector<std::vector<TensorUse>> m_output_uses;
+    std::vector<Intermediate> m_intermediates;
+    // Frames not used by a call, concurrent calls each take their own
+    std::vector<std::unique_ptr<CallFrame>> m_frames;
+    std::mutex m_frames_mutex;
+
     static OP_TYPEID get_typeid(const NodeTypeInfo& type_info);
 
     static void perform_nan_check(const std::vector<std::shared_ptr<HostTensor>>&,
                                   const Node* op = nullptr);
 
-    void generate_calls(const element::Type& type,
-                        const Node& op,
-                        const std::vector<std::shared_ptr<HostTensor>>& outputs,
-                        const std::vector<std::shared_ptr<HostTensor>>& inputs);
+    void prepare_calls();
+    std::unique_ptr<CallFrame> make_frame() const;
+
+    static OpEngine get_engine(const element::Type& type);
 
     template <typename T>
-    void op_engine(const Node& node,
+    void op_engine(OP_TYPEID type_id,
+                   const Node& node,
                    const std::vector<std::shared_ptr<HostTensor>>& out,
                    const std::vector<std::shared_ptr<HostTensor>>& args)
     {
@@ -197,7 +267,7 @@ private:
 #pragma GCC diagnostic error "-Wswitch-enum"
 // #pragma GCC diagnostic error "-Wcovered-switch-default"
 #endif
-        switch (get_typeid(node.get_type_info()))
+        switch (type_id)
         {
         case OP_TYPEID::Abs:
         {
@@ -216,10 +286,10 @@ private:
         case OP_TYPEID::Add:
         {
             size_t element_count = shape_size(node.get_output_shape(0));
-            reference::add<T>(args[0]->get_data_ptr<const T>(),
-                              args[1]->get_data_ptr<const T>(),
-                              out[0]->get_data_ptr<T>(),
-                              element_count);
+            kernel::add<T>(args[0]->get_data_ptr<const T>(),
+                           args[1]->get_data_ptr<const T>(),
+                           out[0]->get_data_ptr<T>(),
+                           element_count);
             break;
         }
         case OP_TYPEID::All:
@@ -341,15 +411,15 @@ private:
         {
             const op::AvgPool* avg_pool = static_cast<const op::AvgPool*>(&node);
 
-            reference::avg_pool<T>(args[0]->get_data_ptr<const T>(),
-                                   out[0]->get_data_ptr<T>(),
-                                   node.get_input_shape(0),
-                                   node.get_output_shape(0),
-                                   avg_pool->get_window_shape(),
-                                   avg_pool->get_window_movement_strides(),
-                                   avg_pool->get_padding_below(),
-                                   avg_pool->get_padding_above(),
-                                   avg_pool->get_include_padding_in_avg_computation());
+            kernel::avg_pool<T>(args[0]->get_data_ptr<const T>(),
+                                out[0]->get_data_ptr<T>(),
+                                node.get_input_shape(0),
+                                node.get_output_shape(0),
+                                avg_pool->get_window_shape(),
+                                avg_pool->get_window_movement_strides(),
+                                avg_pool->get_padding_below(),
+                                avg_pool->get_padding_above(),
+                                avg_pool->get_include_padding_in_avg_computation());
             break;
         }
         case OP_TYPEID::GenerateMask:
@@ -405,28 +475,28 @@ private:
         {
             const ngraph::op::BatchNormTraining* bn =
                 static_cast<const ngraph::op::BatchNormTraining*>(&node);
-            reference::batch_norm_training<T>(bn->get_eps_value(),
-                                              args[0]->get_data_ptr<const T>(),
-                                              args[1]->get_data_ptr<const T>(),
-                                              args[2]->get_data_ptr<const T>(),
-                                              out[0]->get_data_ptr<T>(),
-                                              out[1]->get_data_ptr<T>(),
-                                              out[2]->get_data_ptr<T>(),
-                                              node.get_input_shape(2));
+            kernel::batch_norm_training<T>(bn->get_eps_value(),
+                                           args[0]->get_data_ptr<const T>(),
+                                           args[1]->get_data_ptr<const T>(),
+                                           args[2]->get_data_ptr<const T>(),
+                                           out[0]->get_data_ptr<T>(),
+                                           out[1]->get_data_ptr<T>(),
+                                           out[2]->get_data_ptr<T>(),
+                                           node.get_input_shape(2));
             break;
         }
         case OP_TYPEID::BatchNormInference:
         {
             const ngraph::op::BatchNormInference* bn =
                 static_cast<const ngraph::op::BatchNormInference*>(&node);
-            reference::batch_norm_inference<T>(bn->get_eps_value(),
-                                               args[0]->get_data_ptr<const T>(),
-                                               args[1]->get_data_ptr<const T>(),
-                                               args[2]->get_data_ptr<const T>(),
-                                               args[3]->get_data_ptr<const T>(),
-                                               args[4]->get_data_ptr<const T>(),
-                                               out[0]->get_data_ptr<T>(),
-                                               node.get_input_shape(2));
+            kernel::batch_norm_inference<T>(bn->get_eps_value(),
+                                            args[0]->get_data_ptr<const T>(),
+                                            args[1]->get_data_ptr<const T>(),
+                                            args[2]->get_data_ptr<const T>(),
+                                            args[3]->get_data_ptr<const T>(),
+                                            args[4]->get_data_ptr<const T>(),
+                                            out[0]->get_data_ptr<T>(),
+                                            node.get_input_shape(2));
             break;
         }
         case OP_TYPEID::BatchNormTrainingBackprop:
@@ -607,17 +677,17 @@ private:
         case OP_TYPEID::Convolution:
         {
             const op::Convolution* c = static_cast<const op::Convolution*>(&node);
-            reference::convolution<T>(args[0]->get_data_ptr<const T>(),
-                                      args[1]->get_data_ptr<const T>(),
-                                      out[0]->get_data_ptr<T>(),
-                                      node.get_input_shape(0),
-                                      node.get_input_shape(1),
-                                      node.get_output_shape(0),
-                                      c->get_window_movement_strides(),
-                                      c->get_window_dilation_strides(),
-                                      c->get_padding_below(),
-                                      c->get_padding_above(),
-                                      c->get_data_dilation_strides());
+            kernel::convolution<T>(args[0]->get_data_ptr<const T>(),
+                                   args[1]->get_data_ptr<const T>(),
+                                   out[0]->get_data_ptr<T>(),
+                                   node.get_input_shape(0),
+                                   node.get_input_shape(1),
+                                   node.get_output_shape(0),
+                                   c->get_window_movement_strides(),
+                                   c->get_window_dilation_strides(),
+                                   c->get_padding_below(),
+                                   c->get_padding_above(),
+                                   c->get_data_dilation_strides());
 
             break;
         }
@@ -709,11 +779,11 @@ private:
         {
             const op::Divide* divop = static_cast<const op::Divide*>(&node);
             size_t element_count = shape_size(node.get_output_shape(0));
-            reference::divide<T>(args[0]->get_data_ptr<const T>(),
-                                 args[1]->get_data_ptr<const T>(),
-                                 out[0]->get_data_ptr<T>(),
-                                 element_count,
-                                 divop->is_pythondiv());
+            kernel::divide<T>(args[0]->get_data_ptr<const T>(),
+                              args[1]->get_data_ptr<const T>(),
+                              out[0]->get_data_ptr<T>(),
+                              element_count,
+                              divop->is_pythondiv());
             break;
         }
         case OP_TYPEID::Dot:
@@ -803,7 +873,7 @@ private:
         case OP_TYPEID::Exp:
         {
             size_t element_count = shape_size(node.get_output_shape(0));
-            reference::exp<T>(
+            kernel::exp<T>(
                 args[0]->get_data_ptr<const T>(), out[0]->get_data_ptr<T>(), element_count);
             break;
         }
@@ -953,34 +1023,34 @@ private:
         case OP_TYPEID::Max:
         {
             const op::Max* max = static_cast<const op::Max*>(&node);
-            reference::max<T>(args[0]->get_data_ptr<const T>(),
-                              out[0]->get_data_ptr<T>(),
-                              node.get_input_shape(0),
-                              node.get_output_shape(0),
-                              max->get_reduction_axes());
+            kernel::max<T>(args[0]->get_data_ptr<const T>(),
+                           out[0]->get_data_ptr<T>(),
+                           node.get_input_shape(0),
+                           node.get_output_shape(0),
+                           max->get_reduction_axes());
             break;
         }
         case OP_TYPEID::Maximum:
         {
             size_t element_count = shape_size(node.get_output_shape(0));
-            reference::maximum<T>(args[0]->get_data_ptr<const T>(),
-                                  args[1]->get_data_ptr<const T>(),
-                                  out[0]->get_data_ptr<T>(),
-                                  element_count);
+            kernel::maximum<T>(args[0]->get_data_ptr<const T>(),
+                               args[1]->get_data_ptr<const T>(),
+                               out[0]->get_data_ptr<T>(),
+                               element_count);
             break;
         }
         case OP_TYPEID::MaxPool:
         {
             const op::MaxPool* max_pool = static_cast<const op::MaxPool*>(&node);
 
-            reference::max_pool<T>(args[0]->get_data_ptr<const T>(),
-                                   out[0]->get_data_ptr<T>(),
-                                   node.get_input_shape(0),
-                                   node.get_output_shape(0),
-                                   max_pool->get_window_shape(),
-                                   max_pool->get_window_movement_strides(),
-                                   max_pool->get_padding_below(),
-                                   max_pool->get_padding_above());
+            kernel::max_pool<T>(args[0]->get_data_ptr<const T>(),
+                                out[0]->get_data_ptr<T>(),
+                                node.get_input_shape(0),
+                                node.get_output_shape(0),
+                                max_pool->get_window_shape(),
+                                max_pool->get_window_movement_strides(),
+                                max_pool->get_padding_below(),
+                                max_pool->get_padding_above());
             break;
         }
         case OP_TYPEID::MaxPoolBackprop:
@@ -1002,29 +1072,29 @@ private:
         case OP_TYPEID::Min:
         {
             const op::Min* min = static_cast<const op::Min*>(&node);
-            reference::min<T>(args[0]->get_data_ptr<const T>(),
-                              out[0]->get_data_ptr<T>(),
-                              node.get_input_shape(0),
-                              node.get_output_shape(0),
-                              min->get_reduction_axes());
+            kernel::min<T>(args[0]->get_data_ptr<const T>(),
+                           out[0]->get_data_ptr<T>(),
+                           node.get_input_shape(0),
+                           node.get_output_shape(0),
+                           min->get_reduction_axes());
             break;
         }
         case OP_TYPEID::Minimum:
         {
             size_t element_count = shape_size(node.get_output_shape(0));
-            reference::minimum<T>(args[0]->get_data_ptr<const T>(),
-                                  args[1]->get_data_ptr<const T>(),
-                                  out[0]->get_data_ptr<T>(),
-                                  element_count);
+            kernel::minimum<T>(args[0]->get_data_ptr<const T>(),
+                               args[1]->get_data_ptr<const T>(),
+                               out[0]->get_data_ptr<T>(),
+                               element_count);
             break;
         }
         case OP_TYPEID::Multiply:
         {
             size_t element_count = shape_size(node.get_output_shape(0));
-            reference::multiply<T>(args[0]->get_data_ptr<const T>(),
-                                   args[1]->get_data_ptr<const T>(),
-                                   out[0]->get_data_ptr<T>(),
-                                   element_count);
+            kernel::multiply<T>(args[0]->get_data_ptr<const T>(),
+                                args[1]->get_data_ptr<const T>(),
+                                out[0]->get_data_ptr<T>(),
+                                element_count);
             break;
         }
         case OP_TYPEID::Negative:
@@ -1294,7 +1364,7 @@ private:
         case OP_TYPEID::Relu:
         {
             size_t element_count = shape_size(node.get_output_shape(0));
-            reference::relu<T>(
+            kernel::relu<T>(
                 args[0]->get_data_ptr<const T>(), out[0]->get_data_ptr<T>(), element_count);
             break;
         }
@@ -1460,7 +1530,7 @@ private:
         case OP_TYPEID::Sigmoid:
         {
             size_t element_count = shape_size(node.get_output_shape(0));
-            reference::sigmoid<T>(
+            kernel::sigmoid<T>(
                 args[0]->get_data_ptr<const T>(), out[0]->get_data_ptr<T>(), element_count);
             break;
         }
@@ -1509,10 +1579,10 @@ private:
         case OP_TYPEID::Softmax:
         {
             const op::Softmax* softmax = static_cast<const op::Softmax*>(&node);
-            reference::softmax<T>(args[0]->get_data_ptr<const T>(),
-                                  out[0]->get_data_ptr<T>(),
-                                  node.get_output_shape(0),
-                                  softmax->get_axes());
+            kernel::softmax<T>(args[0]->get_data_ptr<const T>(),
+                               out[0]->get_data_ptr<T>(),
+                               node.get_output_shape(0),
+                               softmax->get_axes());
             break;
         }
         case OP_TYPEID::Sqrt:
@@ -1527,20 +1597,20 @@ private:
         case OP_TYPEID::Subtract:
         {
             size_t element_count = shape_size(node.get_output_shape(0));
-            reference::subtract<T>(args[0]->get_data_ptr<const T>(),
-                                   args[1]->get_data_ptr<const T>(),
-                                   out[0]->get_data_ptr<T>(),
-                                   element_count);
+            kernel::subtract<T>(args[0]->get_data_ptr<const T>(),
+                                args[1]->get_data_ptr<const T>(),
+                                out[0]->get_data_ptr<T>(),
+                                element_count);
             break;
         }
         case OP_TYPEID::Sum:
         {
             const op::Sum* sum = static_cast<const op::Sum*>(&node);
-            reference::sum<T>(args[0]->get_data_ptr<const T>(),
-                              out[0]->get_data_ptr<T>(),
-                              node.get_input_shape(0),
-                              node.get_output_shape(0),
-                              sum->get_reduction_axes());
+            kernel::sum<T>(args[0]->get_data_ptr<const T>(),
+                           out[0]->get_data_ptr<T>(),
+                           node.get_input_shape(0),
+                           node.get_output_shape(0),
+                           sum->get_reduction_axes());
             break;
         }
         case OP_TYPEID::Tan:
@@ -1553,7 +1623,7 @@ private:
         case OP_TYPEID::Tanh:
         {
             size_t element_count = shape_size(node.get_output_shape(0));
-            reference::tanh<T>(
+            kernel::tanh<T>(
                 args[0]->get_data_ptr<const T>(), out[0]->get_data_ptr<T>(), element_count);
             break;
         }
@@ -1607,6 +1677,7 @@ private:
         case OP_TYPEID::CropAndResize:
         case OP_TYPEID::CrossEntropy:
         case OP_TYPEID::CrossEntropyBackprop:
+        case OP_TYPEID::CumSum:
         case OP_TYPEID::DepthToSpace:
         case OP_TYPEID::DynBroadcast:
         case OP_TYPEID::DynPad:
@@ -1614,6 +1685,8 @@ private:
         case OP_TYPEID::Elu:
         case OP_TYPEID::FakeQuantize:
         case OP_TYPEID::GroupConvolution:
+        case OP_TYPEID::GroupConvolutionBackpropData:
+        case OP_TYPEID::GroupConvolutionBackpropFilters:
         case OP_TYPEID::GRN:
         case OP_TYPEID::GRUCell:
         case OP_TYPEID::Gelu:
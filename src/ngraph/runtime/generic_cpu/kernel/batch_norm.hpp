@@ -0,0 +1,128 @@
+//*****************************************************************************
+// Copyright 2017-2019 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#pragma once
+
+#include <cmath>
+
+#include "ngraph/runtime/generic_cpu/kernel/parallel.hpp"
+#include "ngraph/shape.hpp"
+
+namespace ngraph
+{
+    namespace runtime
+    {
+        namespace gcpu
+        {
+            namespace kernel
+            {
+                // Normalizes every contiguous [batch, channel] plane in parallel, with the same
+                // arithmetic as reference::batch_norm_inference
+                template <typename T>
+                void batch_norm_inference(float eps,
+                                          const T* gamma,
+                                          const T* beta,
+                                          const T* input,
+                                          const T* mean,
+                                          const T* variance,
+                                          T* normed_input,
+                                          const Shape& input_shape)
+                {
+                    auto eps_casted = static_cast<T>(eps);
+                    size_t channels = input_shape[1];
+                    size_t planes = input_shape[0] * channels;
+                    size_t plane_size = planes == 0 ? 0 : shape_size(input_shape) / planes;
+                    parallel_for(planes, shape_size(input_shape), [&](size_t plane) {
+                        size_t c = plane % channels;
+                        T channel_gamma = gamma[c];
+                        T channel_beta = beta[c];
+                        T channel_mean = mean[c];
+                        auto channel_sqrt = std::sqrt(variance[c] + eps_casted);
+                        const T* in = input + plane * plane_size;
+                        T* out = normed_input + plane * plane_size;
+                        for (size_t i = 0; i < plane_size; i++)
+                        {
+                            auto normalized = (in[i] - channel_mean) / channel_sqrt;
+                            out[i] = normalized * channel_gamma + channel_beta;
+                        }
+                    });
+                }
+
+                // Computes the moments and normalizes every channel in parallel, with the same
+                // arithmetic as reference::batch_norm_training
+                template <typename T>
+                void batch_norm_training(float eps,
+                                         const T* gamma,
+                                         const T* beta,
+                                         const T* input,
+                                         T* normed_input,
+                                         T* mean,
+                                         T* variance,
+                                         const Shape& input_shape)
+                {
+                    auto eps_casted = static_cast<T>(eps);
+                    size_t batches = input_shape[0];
+                    size_t channels = input_shape[1];
+                    size_t elements = shape_size(input_shape);
+                    size_t plane_size = batches * channels == 0 ? 0 : elements / batches / channels;
+                    size_t channel_elements = channels == 0 ? 0 : elements / channels;
+                    size_t batch_stride = channels * plane_size;
+                    parallel_for(channels, 3 * elements, [&](size_t c) {
+                        const T* in = input + c * plane_size;
+                        T* out = normed_input + c * plane_size;
+
+                        T channel_sum = 0;
+                        for (size_t n = 0; n < batches; n++)
+                        {
+                            const T* plane = in + n * batch_stride;
+                            for (size_t i = 0; i < plane_size; i++)
+                            {
+                                channel_sum += plane[i];
+                            }
+                        }
+                        T channel_mean = channel_sum / channel_elements;
+                        mean[c] = channel_mean;
+
+                        T channel_diff_square_sum = 0;
+                        for (size_t n = 0; n < batches; n++)
+                        {
+                            const T* plane = in + n * batch_stride;
+                            for (size_t i = 0; i < plane_size; i++)
+                            {
+                                auto centered = plane[i] - channel_mean;
+                                channel_diff_square_sum += centered * centered;
+                            }
+                        }
+                        T channel_var = channel_diff_square_sum / channel_elements;
+                        variance[c] = channel_var;
+
+                        T scale = gamma[c] / std::sqrt(channel_var + eps_casted);
+                        T channel_beta = beta[c];
+                        for (size_t n = 0; n < batches; n++)
+                        {
+                            const T* plane = in + n * batch_stride;
+                            T* result = out + n * batch_stride;
+                            for (size_t i = 0; i < plane_size; i++)
+                            {
+                                result[i] = (plane[i] - channel_mean) * scale + channel_beta;
+                            }
+                        }
+                    });
+                }
+            }
+        }
+    }
+}
@@ -0,0 +1,157 @@
+//*****************************************************************************
+// Copyright 2017-2019 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#pragma once
+
+#include <Eigen/Dense>
+#include <algorithm>
+#include <cstdint>
+#include <type_traits>
+#include <vector>
+
+#include "ngraph/coordinate_diff.hpp"
+#include "ngraph/runtime/generic_cpu/kernel/parallel.hpp"
+#include "ngraph/runtime/reference/convolution.hpp"
+#include "ngraph/shape.hpp"
+#include "ngraph/strides.hpp"
+
+namespace ngraph
+{
+    namespace runtime
+    {
+        namespace gcpu
+        {
+            namespace kernel
+            {
+                // Bytes of the im2col matrix of one tile of output pixels, small enough for the
+                // tile to stay in the L2 cache while it is multiplied by the filters
+                constexpr size_t convolution_tile_bytes = 256 * 1024;
+
+                // 2D floating point convolutions of NCHW data with OIHW filters are computed as
+                // an im2col copy followed by a GEMM, a tile of output pixels of one image at a
+                // time. Tiles are spread over the OpenMP threads, and each one runs its GEMM
+                // single threaded. Other convolutions, such as those with data dilation, use
+                // the reference.
+                template <typename T>
+                void convolution(const T* in,
+                                 const T* filter,
+                                 T* out,
+                                 const Shape& in_shape,
+                                 const Shape& filter_shape,
+                                 const Shape& out_shape,
+                                 const Strides& stride,
+                                 const Strides& filter_dilation,
+                                 const CoordinateDiff& in_pad_below,
+                                 const CoordinateDiff& in_pad_above,
+                                 const Strides& in_dilation)
+                {
+                    bool dilated_input =
+                        std::any_of(in_dilation.begin(), in_dilation.end(), [](size_t d) {
+                            return d != 1;
+                        });
+                    if (!std::is_floating_point<T>::value || in_shape.size() != 4 ||
+                        dilated_input)
+                    {
+                        reference::convolution<T>(in,
+                                                  filter,
+                                                  out,
+                                                  in_shape,
+                                                  filter_shape,
+                                                  out_shape,
+                                                  stride,
+                                                  filter_dilation,
+                                                  in_pad_below,
+                                                  in_pad_above,
+                                                  in_dilation);
+                        return;
+                    }
+
+                    using Matrix =
+                        Eigen::Matrix<T, Eigen::Dynamic, Eigen::Dynamic, Eigen::RowMajor>;
+                    using ConstMap = Eigen::Map<const Matrix>;
+                    using OutMap = Eigen::Map<Matrix, Eigen::Unaligned, Eigen::OuterStride<>>;
+
+                    size_t batches = in_shape[0];
+                    size_t channels = in_shape[1];
+                    auto height = static_cast<int64_t>(in_shape[2]);
+                    auto width = static_cast<int64_t>(in_shape[3]);
+                    size_t filters = filter_shape[0];
+                    size_t filter_height = filter_shape[2];
+                    size_t filter_width = filter_shape[3];
+                    size_t out_width = out_shape[3];
+                    size_t pixels = out_shape[2] * out_width;
+                    size_t patch = channels * filter_height * filter_width;
+
+                    size_t tile = std::max<size_t>(
+                        16, convolution_tile_bytes / sizeof(T) / std::max<size_t>(patch, 1));
+                    tile = std::min(tile, std::max<size_t>(pixels, 1));
+                    size_t tiles = (pixels + tile - 1) / tile;
+
+                    ConstMap weights(filter, filters, patch);
+                    size_t work = batches * filters * patch * pixels;
+                    parallel_for(batches * tiles, work, [&](size_t task) {
+                        size_t n = task / tiles;
+                        size_t first = (task % tiles) * tile;
+                        size_t count = std::min(tile, pixels - first);
+                        const T* image = in + n * channels * height * width;
+
+                        // Input coordinates of the top left filter tap of every output pixel
+                        std::vector<int64_t> top(count);
+                        std::vector<int64_t> left(count);
+                        for (size_t i = 0; i < count; i++)
+                        {
+                            top[i] = static_cast<int64_t>(((first + i) / out_width) * stride[0]) -
+                                     in_pad_below[0];
+                            left[i] = static_cast<int64_t>(((first + i) % out_width) * stride[1]) -
+                                      in_pad_below[1];
+                        }
+
+                        // Row (c, kh, kw) of the im2col matrix holds the input element under
+                        // that filter tap for every output pixel of the tile
+                        std::vector<T> columns(patch * count);
+                        T* column = columns.data();
+                        for (size_t c = 0; c < channels; c++)
+                        {
+                            const T* channel = image + c * height * width;
+                            for (size_t kh = 0; kh < filter_height; kh++)
+                            {
+                                auto dh = static_cast<int64_t>(kh * filter_dilation[0]);
+                                for (size_t kw = 0; kw < filter_width; kw++)
+                                {
+                                    auto dw = static_cast<int64_t>(kw * filter_dilation[1]);
+                                    for (size_t i = 0; i < count; i++)
+                                    {
+                                        int64_t h = top[i] + dh;
+                                        int64_t w = left[i] + dw;
+                                        *column++ = h >= 0 && h < height && w >= 0 && w < width
+                                                        ? channel[h * width + w]
+                                                        : T(0);
+                                    }
+                                }
+                            }
+                        }
+
+                        OutMap result(out + n * filters * pixels + first,
+                                      filters,
+                                      count,
+                                      Eigen::OuterStride<>(pixels));
+                        result.noalias() = weights * ConstMap(columns.data(), patch, count);
+                    });
+                }
+            }
+        }
+    }
+}
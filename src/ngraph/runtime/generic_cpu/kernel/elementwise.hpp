@@ -0,0 +1,132 @@
+//*****************************************************************************
+// Copyright 2017-2019 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#pragma once
+
+#include <cmath>
+#include <type_traits>
+
+#include "ngraph/runtime/generic_cpu/kernel/parallel.hpp"
+#include "ngraph/runtime/reference/divide.hpp"
+
+namespace ngraph
+{
+    namespace runtime
+    {
+        namespace gcpu
+        {
+            namespace kernel
+            {
+                // The elementwise kernels compute exactly what the reference ones do, in
+                // parallel blocks that the compiler can vectorize.
+                template <typename T, typename OP>
+                void unary(const T* arg, T* out, size_t count, OP op)
+                {
+                    parallel_blocks(count, [&](size_t begin, size_t end) {
+                        for (size_t i = begin; i < end; i++)
+                        {
+                            out[i] = op(arg[i]);
+                        }
+                    });
+                }
+
+                template <typename T, typename OP>
+                void binary(const T* arg0, const T* arg1, T* out, size_t count, OP op)
+                {
+                    parallel_blocks(count, [&](size_t begin, size_t end) {
+                        for (size_t i = begin; i < end; i++)
+                        {
+                            out[i] = op(arg0[i], arg1[i]);
+                        }
+                    });
+                }
+
+                template <typename T>
+                void add(const T* arg0, const T* arg1, T* out, size_t count)
+                {
+                    binary(arg0, arg1, out, count, [](T x, T y) -> T { return x + y; });
+                }
+
+                template <typename T>
+                void subtract(const T* arg0, const T* arg1, T* out, size_t count)
+                {
+                    binary(arg0, arg1, out, count, [](T x, T y) -> T { return x - y; });
+                }
+
+                template <typename T>
+                void multiply(const T* arg0, const T* arg1, T* out, size_t count)
+                {
+                    binary(arg0, arg1, out, count, [](T x, T y) -> T { return x * y; });
+                }
+
+                // Integer division checks for zero and rounds like Python, so it stays serial
+                template <typename T>
+                typename std::enable_if<std::is_integral<T>::value>::type
+                    divide(const T* arg0, const T* arg1, T* out, size_t count, bool pythondiv)
+                {
+                    reference::divide<T>(arg0, arg1, out, count, pythondiv);
+                }
+
+                template <typename T>
+                typename std::enable_if<!std::is_integral<T>::value>::type
+                    divide(const T* arg0, const T* arg1, T* out, size_t count, bool /* pythondiv */)
+                {
+                    binary(arg0, arg1, out, count, [](T x, T y) -> T { return x / y; });
+                }
+
+                template <typename T>
+                void maximum(const T* arg0, const T* arg1, T* out, size_t count)
+                {
+                    binary(arg0, arg1, out, count, [](T x, T y) -> T { return x > y ? x : y; });
+                }
+
+                template <typename T>
+                void minimum(const T* arg0, const T* arg1, T* out, size_t count)
+                {
+                    binary(arg0, arg1, out, count, [](T x, T y) -> T { return x < y ? x : y; });
+                }
+
+                template <typename T>
+                void relu(const T* arg, T* out, size_t count)
+                {
+                    T zero = 0;
+                    unary(arg, out, count, [zero](T x) -> T { return x > zero ? x : zero; });
+                }
+
+                template <typename T>
+                void exp(const T* arg, T* out, size_t count)
+                {
+                    unary(arg, out, count, [](T x) -> T { return std::exp(x); });
+                }
+
+                template <typename T>
+                void sigmoid(const T* arg, T* out, size_t count)
+                {
+                    unary(arg, out, count, [](T x) -> T {
+                        T exp_value = std::exp(-x);
+                        return 1 / (1 + exp_value);
+                    });
+                }
+
+                template <typename T>
+                void tanh(const T* arg, T* out, size_t count)
+                {
+                    unary(arg, out, count, [](T x) -> T { return std::tanh(x); });
+                }
+            }
+        }
+    }
+}
@@ -0,0 +1,83 @@
+//*****************************************************************************
+// Copyright 2017-2019 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+#ifdef PARALLEL
+#include <omp.h>
+#endif
+
+namespace ngraph
+{
+    namespace runtime
+    {
+        namespace gcpu
+        {
+            namespace kernel
+            {
+                // Below this many elements of work, starting the OpenMP team costs more than
+                // the loop itself
+                constexpr size_t parallel_work_threshold = 32768;
+
+                // Elements of a contiguous block of work, such as a chunk of an elementwise op
+                constexpr size_t parallel_block_size = 4096;
+
+                // Calls f(i) for every i in [0, count), split statically across the OpenMP
+                // threads if PARALLEL is defined and there are `work` elements or more to do.
+                template <typename F>
+                void parallel_for(size_t count, size_t work, F f)
+                {
+                    auto n = static_cast<int64_t>(count);
+#ifdef PARALLEL
+                    // Even a parallel region with a false if clause goes through the OpenMP
+                    // runtime, which costs more than a small op
+                    if (n > 1 && work >= parallel_work_threshold)
+                    {
+#pragma omp parallel for schedule(static)
+                        for (int64_t i = 0; i < n; i++)
+                        {
+                            f(static_cast<size_t>(i));
+                        }
+                        return;
+                    }
+#else
+                    static_cast<void>(work);
+#endif
+                    for (int64_t i = 0; i < n; i++)
+                    {
+                        f(static_cast<size_t>(i));
+                    }
+                }
+
+                // Calls f(begin, end) for blocks of at most parallel_block_size elements of
+                // [0, count), in parallel
+                template <typename F>
+                void parallel_blocks(size_t count, F f)
+                {
+                    size_t blocks = (count + parallel_block_size - 1) / parallel_block_size;
+                    parallel_for(blocks, count, [&](size_t block) {
+                        size_t begin = block * parallel_block_size;
+                        size_t end = begin + parallel_block_size;
+                        f(begin, end < count ? end : count);
+                    });
+                }
+            }
+        }
+    }
+}
@@ -0,0 +1,237 @@
+//*****************************************************************************
+// Copyright 2017-2019 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <limits>
+#include <stdexcept>
+#include <type_traits>
+
+#include "ngraph/runtime/generic_cpu/kernel/parallel.hpp"
+#include "ngraph/runtime/reference/avg_pool.hpp"
+#include "ngraph/runtime/reference/max_pool.hpp"
+#include "ngraph/shape.hpp"
+#include "ngraph/strides.hpp"
+
+namespace ngraph
+{
+    namespace runtime
+    {
+        namespace gcpu
+        {
+            namespace kernel
+            {
+                namespace pool_detail
+                {
+                    // The part of a window along one axis that is inside of the input, and the
+                    // part that is inside of the padded input
+                    struct Span
+                    {
+                        size_t begin;
+                        size_t end;
+                        size_t padded;
+                    };
+
+                    inline Span window_span(size_t out_index,
+                                            size_t stride,
+                                            size_t window,
+                                            size_t size,
+                                            size_t pad_below,
+                                            size_t pad_above)
+                    {
+                        auto start = static_cast<int64_t>(out_index * stride) -
+                                     static_cast<int64_t>(pad_below);
+                        auto stop = start + static_cast<int64_t>(window);
+                        auto in_size = static_cast<int64_t>(size);
+                        Span span;
+                        span.begin = static_cast<size_t>(std::max<int64_t>(start, 0));
+                        span.end = static_cast<size_t>(std::max<int64_t>(
+                            std::min<int64_t>(stop, in_size), static_cast<int64_t>(span.begin)));
+                        span.padded = static_cast<size_t>(
+                            std::min<int64_t>(stop, in_size + static_cast<int64_t>(pad_above)) -
+                            std::max<int64_t>(start, -static_cast<int64_t>(pad_below)));
+                        return span;
+                    }
+
+                    // Calls f(in, out, row) for every output row of every [batch, channel]
+                    // plane of a 2D pooling, in parallel
+                    template <typename T, typename F>
+                    void for_each_row(const T* arg,
+                                      T* out,
+                                      const Shape& arg_shape,
+                                      const Shape& out_shape,
+                                      const Shape& window_shape,
+                                      F f)
+                    {
+                        size_t planes = arg_shape[0] * arg_shape[1];
+                        size_t in_plane = arg_shape[2] * arg_shape[3];
+                        size_t out_height = out_shape[2];
+                        size_t out_width = out_shape[3];
+                        parallel_for(planes * out_height,
+                                     shape_size(out_shape) * shape_size(window_shape),
+                                     [&](size_t task) {
+                                         size_t plane = task / out_height;
+                                         f(arg + plane * in_plane,
+                                           out + task * out_width,
+                                           task % out_height);
+                                     });
+                    }
+                }
+
+                // 2D pooling of NCHW tensors works on one output row at a time, reading the
+                // input window rows directly instead of through coordinate transforms. Other
+                // ranks use the reference.
+                template <typename T>
+                void max_pool(const T* arg,
+                              T* out,
+                              const Shape& arg_shape,
+                              const Shape& out_shape,
+                              const Shape& window_shape,
+                              const Strides& window_movement_strides,
+                              const Shape& padding_below,
+                              const Shape& padding_above)
+                {
+                    if (arg_shape.size() != 4)
+                    {
+                        reference::max_pool<T>(arg,
+                                               out,
+                                               arg_shape,
+                                               out_shape,
+                                               window_shape,
+                                               window_movement_strides,
+                                               padding_below,
+                                               padding_above);
+                        return;
+                    }
+                    size_t width = arg_shape[3];
+                    pool_detail::for_each_row(
+                        arg,
+                        out,
+                        arg_shape,
+                        out_shape,
+                        window_shape,
+                        [&](const T* in, T* result, size_t row) {
+                            auto rows = pool_detail::window_span(row,
+                                                                 window_movement_strides[0],
+                                                                 window_shape[0],
+                                                                 arg_shape[2],
+                                                                 padding_below[0],
+                                                                 padding_above[0]);
+                            for (size_t column = 0; column < out_shape[3]; column++)
+                            {
+                                auto columns = pool_detail::window_span(column,
+                                                                        window_movement_strides[1],
+                                                                        window_shape[1],
+                                                                        width,
+                                                                        padding_below[1],
+                                                                        padding_above[1]);
+                                T value = std::numeric_limits<T>::lowest();
+                                for (size_t h = rows.begin; h < rows.end; h++)
+                                {
+                                    const T* line = in + h * width;
+                                    for (size_t w = columns.begin; w < columns.end; w++)
+                                    {
+                                        value = line[w] > value ? line[w] : value;
+                                    }
+                                }
+                                result[column] = value;
+                            }
+                        });
+                }
+
+                // Like max_pool, for 2D floating point pooling. Integer averages are rounded by
+                // the reference.
+                template <typename T>
+                void avg_pool(const T* arg,
+                              T* out,
+                              const Shape& arg_shape,
+                              const Shape& out_shape,
+                              const Shape& window_shape,
+                              const Strides& window_movement_strides,
+                              const Shape& padding_below,
+                              const Shape& padding_above,
+                              bool include_padding_in_avg_computation)
+                {
+                    if (arg_shape.size() != 4 || !std::is_floating_point<T>::value)
+                    {
+                        reference::avg_pool<T>(arg,
+                                               out,
+                                               arg_shape,
+                                               out_shape,
+                                               window_shape,
+                                               window_movement_strides,
+                                               padding_below,
+                                               padding_above,
+                                               include_padding_in_avg_computation);
+                        return;
+                    }
+                    size_t width = arg_shape[3];
+                    std::atomic<bool> empty_window(false);
+                    pool_detail::for_each_row(
+                        arg,
+                        out,
+                        arg_shape,
+                        out_shape,
+                        window_shape,
+                        [&](const T* in, T* result, size_t row) {
+                            auto rows = pool_detail::window_span(row,
+                                                                 window_movement_strides[0],
+                                                                 window_shape[0],
+                                                                 arg_shape[2],
+                                                                 padding_below[0],
+                                                                 padding_above[0]);
+                            for (size_t column = 0; column < out_shape[3]; column++)
+                            {
+                                auto columns = pool_detail::window_span(column,
+                                                                        window_movement_strides[1],
+                                                                        window_shape[1],
+                                                                        width,
+                                                                        padding_below[1],
+                                                                        padding_above[1]);
+                                T value = 0;
+                                for (size_t h = rows.begin; h < rows.end; h++)
+                                {
+                                    const T* line = in + h * width;
+                                    for (size_t w = columns.begin; w < columns.end; w++)
+                                    {
+                                        value += line[w];
+                                    }
+                                }
+                                size_t n_elements = include_padding_in_avg_computation
+                                                        ? rows.padded * columns.padded
+                                                        : (rows.end - rows.begin) *
+                                                              (columns.end - columns.begin);
+                                if (n_elements == 0)
+                                {
+                                    // Exceptions cannot leave an OpenMP parallel region
+                                    empty_window = true;
+                                    continue;
+                                }
+                                result[column] = value / n_elements;
+                            }
+                        });
+                    if (empty_window)
+                    {
+                        throw std::runtime_error("AvgPool elements == 0, must be non-zero");
+                    }
+                }
+            }
+        }
+    }
+}
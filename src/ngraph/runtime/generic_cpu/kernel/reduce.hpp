@@ -0,0 +1,221 @@
+//*****************************************************************************
+// Copyright 2017-2019 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#pragma once
+
+#include <limits>
+
+#include "ngraph/axis_set.hpp"
+#include "ngraph/runtime/generic_cpu/kernel/parallel.hpp"
+#include "ngraph/runtime/reference/max.hpp"
+#include "ngraph/runtime/reference/min.hpp"
+#include "ngraph/runtime/reference/sum.hpp"
+#include "ngraph/shape.hpp"
+
+namespace ngraph
+{
+    namespace runtime
+    {
+        namespace gcpu
+        {
+            namespace kernel
+            {
+                namespace reduce_detail
+                {
+                    // Elements of the kept inner axes reduced together by one task
+                    constexpr size_t block_size = 256;
+
+                    // Views `shape` as [outer, reduced, inner], which only works if the
+                    // reduction axes are adjacent
+                    inline bool collapse(const Shape& shape,
+                                         const AxisSet& axes,
+                                         size_t& outer,
+                                         size_t& reduced,
+                                         size_t& inner)
+                    {
+                        outer = 1;
+                        reduced = 1;
+                        inner = 1;
+                        if (axes.empty())
+                        {
+                            outer = shape_size(shape);
+                            return true;
+                        }
+                        size_t first = *axes.begin();
+                        size_t last = *axes.rbegin();
+                        if (last - first + 1 != axes.size())
+                        {
+                            return false;
+                        }
+                        for (size_t axis = 0; axis < shape.size(); axis++)
+                        {
+                            if (axis < first)
+                            {
+                                outer *= shape[axis];
+                            }
+                            else if (axis <= last)
+                            {
+                                reduced *= shape[axis];
+                            }
+                            else
+                            {
+                                inner *= shape[axis];
+                            }
+                        }
+                        return true;
+                    }
+
+                    // Calls f(o, begin, end) for every block of inner elements of every outer
+                    // slice, in parallel. A task reduces its block over all of the reduced
+                    // elements, in the same order as the reference.
+                    template <typename F>
+                    void for_each_block(size_t outer, size_t reduced, size_t inner, F f)
+                    {
+                        size_t blocks = (inner + block_size - 1) / block_size;
+                        parallel_for(outer * blocks, outer * reduced * inner, [&](size_t task) {
+                            size_t begin = (task % blocks) * block_size;
+                            size_t end = begin + block_size;
+                            f(task / blocks, begin, end < inner ? end : inner);
+                        });
+                    }
+
+                    template <typename T, typename OP>
+                    void compare(const T* arg,
+                                 T* out,
+                                 size_t outer,
+                                 size_t reduced,
+                                 size_t inner,
+                                 T initial,
+                                 OP replace)
+                    {
+                        for_each_block(outer, reduced, inner, [&](size_t o, size_t b, size_t e) {
+                            T* result = out + o * inner;
+                            const T* slice = arg + o * reduced * inner;
+                            for (size_t j = b; j < e; j++)
+                            {
+                                result[j] = initial;
+                            }
+                            for (size_t r = 0; r < reduced; r++)
+                            {
+                                const T* row = slice + r * inner;
+                                for (size_t j = b; j < e; j++)
+                                {
+                                    if (replace(row[j], result[j]))
+                                    {
+                                        result[j] = row[j];
+                                    }
+                                }
+                            }
+                        });
+                    }
+                }
+
+                // Same compensated summation as reference::sum
+                template <typename T>
+                void sum(const T* arg,
+                         T* out,
+                         const Shape& in_shape,
+                         const Shape& out_shape,
+                         const AxisSet& reduction_axes)
+                {
+                    size_t outer;
+                    size_t reduced;
+                    size_t inner;
+                    if (!reduce_detail::collapse(in_shape, reduction_axes, outer, reduced, inner))
+                    {
+                        reference::sum<T>(arg, out, in_shape, out_shape, reduction_axes);
+                        return;
+                    }
+                    reduce_detail::for_each_block(
+                        outer, reduced, inner, [&](size_t o, size_t begin, size_t end) {
+                            T* result = out + o * inner;
+                            const T* slice = arg + o * reduced * inner;
+                            T cs[reduce_detail::block_size];
+                            for (size_t j = begin; j < end; j++)
+                            {
+                                result[j] = 0;
+                                cs[j - begin] = 0;
+                            }
+                            for (size_t r = 0; r < reduced; r++)
+                            {
+                                const T* row = slice + r * inner;
+                                for (size_t j = begin; j < end; j++)
+                                {
+                                    T x = row[j];
+                                    T& z = result[j];
+                                    if (reference::is_finite(x) && reference::is_finite(z))
+                                    {
+                                        T& c = cs[j - begin];
+                                        T t = z + (x - c);
+                                        c = (t - z) - (x - c);
+                                        z = t;
+                                    }
+                                    else
+                                    {
+                                        z = z + x;
+                                    }
+                                }
+                            }
+                        });
+                }
+
+                template <typename T>
+                void max(const T* arg,
+                         T* out,
+                         const Shape& in_shape,
+                         const Shape& out_shape,
+                         const AxisSet& reduction_axes)
+                {
+                    size_t outer;
+                    size_t reduced;
+                    size_t inner;
+                    if (!reduce_detail::collapse(in_shape, reduction_axes, outer, reduced, inner))
+                    {
+                        reference::max<T>(arg, out, in_shape, out_shape, reduction_axes);
+                        return;
+                    }
+                    T minval = std::numeric_limits<T>::has_infinity
+                                   ? T(-std::numeric_limits<T>::infinity())
+                                   : std::numeric_limits<T>::min();
+                    reduce_detail::compare(
+                        arg, out, outer, reduced, inner, minval, [](T x, T y) { return x > y; });
+                }
+
+                template <typename T>
+                void min(const T* arg,
+                         T* out,
+                         const Shape& in_shape,
+                         const Shape& out_shape,
+                         const AxisSet& reduction_axes)
+                {
+                    size_t outer;
+                    size_t reduced;
+                    size_t inner;
+                    if (!reduce_detail::collapse(in_shape, reduction_axes, outer, reduced, inner))
+                    {
+                        reference::min<T>(arg, out, in_shape, out_shape, reduction_axes);
+                        return;
+                    }
+                    T maxval = std::numeric_limits<T>::has_infinity
+                                   ? std::numeric_limits<T>::infinity()
+                                   : std::numeric_limits<T>::max();
+                    reduce_detail::compare(
+                        arg, out, outer, reduced, inner, maxval, [](T x, T y) { return x < y; });
+                }
+            }
+        }
+    }
+}
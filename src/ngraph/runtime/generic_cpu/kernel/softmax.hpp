@@ -0,0 +1,109 @@
+//*****************************************************************************
+// Copyright 2017-2019 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#pragma once
+
+#include <cmath>
+#include <limits>
+
+#include "ngraph/runtime/generic_cpu/kernel/reduce.hpp"
+#include "ngraph/runtime/reference/softmax.hpp"
+
+namespace ngraph
+{
+    namespace runtime
+    {
+        namespace gcpu
+        {
+            namespace kernel
+            {
+                // Every task normalizes a block of inner elements of one outer slice, doing the
+                // same arithmetic as reference::softmax while the slice is still in cache
+                template <typename T>
+                void softmax(const T* arg, T* out, const Shape& shape, const AxisSet& axes)
+                {
+                    size_t outer;
+                    size_t reduced;
+                    size_t inner;
+                    if (!reduce_detail::collapse(shape, axes, outer, reduced, inner))
+                    {
+                        reference::softmax<T>(arg, out, shape, axes);
+                        return;
+                    }
+                    T minval = std::numeric_limits<T>::has_infinity
+                                   ? T(-std::numeric_limits<T>::infinity())
+                                   : std::numeric_limits<T>::min();
+                    reduce_detail::for_each_block(
+                        outer, reduced, inner, [&](size_t o, size_t begin, size_t end) {
+                            const T* in_slice = arg + o * reduced * inner;
+                            T* out_slice = out + o * reduced * inner;
+                            T max_value[reduce_detail::block_size];
+                            T sum[reduce_detail::block_size];
+                            T cs[reduce_detail::block_size];
+                            size_t count = end - begin;
+                            for (size_t j = 0; j < count; j++)
+                            {
+                                max_value[j] = minval;
+                                sum[j] = 0;
+                                cs[j] = 0;
+                            }
+                            for (size_t r = 0; r < reduced; r++)
+                            {
+                                const T* row = in_slice + r * inner + begin;
+                                for (size_t j = 0; j < count; j++)
+                                {
+                                    if (row[j] > max_value[j])
+                                    {
+                                        max_value[j] = row[j];
+                                    }
+                                }
+                            }
+                            for (size_t r = 0; r < reduced; r++)
+                            {
+                                const T* row = in_slice + r * inner + begin;
+                                T* result = out_slice + r * inner + begin;
+                                for (size_t j = 0; j < count; j++)
+                                {
+                                    T x = std::exp(row[j] - max_value[j]);
+                                    result[j] = x;
+                                    T& z = sum[j];
+                                    if (reference::is_finite(x) && reference::is_finite(z))
+                                    {
+                                        T& c = cs[j];
+                                        T t = z + (x - c);
+                                        c = (t - z) - (x - c);
+                                        z = t;
+                                    }
+                                    else
+                                    {
+                                        z = z + x;
+                                    }
+                                }
+                            }
+                            for (size_t r = 0; r < reduced; r++)
+                            {
+                                T* result = out_slice + r * inner + begin;
+                                for (size_t j = 0; j < count; j++)
+                                {
+                                    result[j] /= sum[j];
+                                }
+                            }
+                        });
+                }
+            }
+        }
+    }
+}
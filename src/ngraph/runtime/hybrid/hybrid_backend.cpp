@@ -0,0 +1,253 @@
+//*****************************************************************************
+// Copyright 2017-2019 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+
+#include <algorithm>
+
+#include "ngraph/check.hpp"
+#include "ngraph/graph_util.hpp"
+#include "ngraph/runtime/hybrid/hybrid_backend.hpp"
+
+using namespace std;
+using namespace ngraph;
+
+runtime::hybrid::HybridBackend::HybridBackend(const vector<shared_ptr<runtime::Backend>>& backends)
+    : m_backends(backends)
+{
+    NGRAPH_CHECK(!m_backends.empty(), "The hybrid backend needs at least one backend");
+}
+
+shared_ptr<runtime::Tensor>
+    runtime::hybrid::HybridBackend::create_tensor(const element::Type& type, const Shape& shape)
+{
+    return make_shared<runtime::HostTensor>(type, shape);
+}
+
+shared_ptr<runtime::Tensor> runtime::hybrid::HybridBackend::create_tensor(
+    const element::Type& type, const Shape& shape, void* memory_pointer)
+{
+    return make_shared<runtime::HostTensor>(type, shape, memory_pointer);
+}
+
+shared_ptr<runtime::Executable>
+    runtime::hybrid::HybridBackend::compile(shared_ptr<Function> function,
+                                            bool enable_performance_collection)
+{
+    return make_shared<HybridExecutable>(m_backends, function, enable_performance_collection);
+}
+
+bool runtime::hybrid::HybridBackend::is_supported(const Node& node) const
+{
+    return any_of(m_backends.begin(),
+                  m_backends.end(),
+                  [&node](const shared_ptr<runtime::Backend>& backend) {
+                      return backend->is_supported(node);
+                  });
+}
+
+runtime::hybrid::HybridExecutable::HybridExecutable(
+    const vector<shared_ptr<runtime::Backend>>& backends,
+    const shared_ptr<Function>& function,
+    bool enable_performance_collection)
+    : m_performance_counters_enabled{enable_performance_collection}
+{
+    m_function = clone_function(*function);
+    set_parameters_and_results(*m_function);
+    place_nodes(m_function, backends);
+    m_split = split_function_by_placement(m_function);
+
+    size_t slot_count = m_split.slot_element_types.size();
+    size_t boundary_begin = m_split.input_count + m_split.output_count;
+    m_slot_tensors.resize(slot_count);
+    m_slot_data.resize(slot_count, nullptr);
+    m_staging_timers.resize(boundary_begin);
+    for (size_t slot = boundary_begin; slot < slot_count; slot++)
+    {
+        m_slot_tensors[slot] =
+            make_shared<HostTensor>(m_split.slot_element_types[slot], m_split.slot_shapes[slot]);
+        m_slot_data[slot] = m_slot_tensors[slot]->get_data_ptr();
+    }
+
+    for (auto& sub_function : m_split.sub_functions)
+    {
+        Stage stage;
+        stage.backend = backends[sub_function.placement];
+        stage.executable =
+            stage.backend->compile(sub_function.function, enable_performance_collection);
+        for (size_t slot : sub_function.parameter_slots)
+        {
+            stage.inputs.emplace_back();
+            stage.inputs.back().slot = slot;
+        }
+        for (size_t slot : sub_function.result_slots)
+        {
+            stage.outputs.emplace_back();
+            stage.outputs.back().slot = slot;
+        }
+        stage.input_tensors.resize(stage.inputs.size());
+        stage.output_tensors.resize(stage.outputs.size());
+        // The memory of boundary slots never moves, so only the slots of the caller are bound
+        // again by a call
+        bind_stage(stage);
+        m_stages.push_back(move(stage));
+    }
+}
+
+void runtime::hybrid::HybridExecutable::bind(Binding& binding,
+                                             shared_ptr<runtime::Tensor>& tensor,
+                                             runtime::Backend& backend)
+{
+    void* data = m_slot_data[binding.slot];
+    if (data != binding.data)
+    {
+        tensor = backend.create_tensor(
+            m_split.slot_element_types[binding.slot], m_split.slot_shapes[binding.slot], data);
+        binding.data = data;
+    }
+}
+
+void runtime::hybrid::HybridExecutable::bind_stage(Stage& stage)
+{
+    for (size_t i = 0; i < stage.inputs.size(); i++)
+    {
+        auto& binding = stage.inputs[i];
+        if (m_performance_counters_enabled)
+        {
+            binding.timer.start();
+        }
+        bind(binding, stage.input_tensors[i], *stage.backend);
+        if (m_performance_counters_enabled)
+        {
+            binding.timer.stop();
+        }
+    }
+    for (size_t i = 0; i < stage.outputs.size(); i++)
+    {
+        auto& binding = stage.outputs[i];
+        if (m_performance_counters_enabled)
+        {
+            binding.timer.start();
+        }
+        bind(binding, stage.output_tensors[i], *stage.backend);
+        if (m_performance_counters_enabled)
+        {
+            binding.timer.stop();
+        }
+    }
+}
+
+bool runtime::hybrid::HybridExecutable::call(const vector<shared_ptr<runtime::Tensor>>& outputs,
+                                             const vector<shared_ptr<runtime::Tensor>>& inputs)
+{
+    lock_guard<mutex> lock(m_call_mutex);
+
+    // Host tensors of the caller are handed to the parts as they are, and other tensors are
+    // staged through host memory
+    size_t io_count = m_split.input_count + m_split.output_count;
+    vector<shared_ptr<runtime::HostTensor>> host_tensors(io_count);
+    for (size_t slot = 0; slot < io_count; slot++)
+    {
+        bool is_input = slot < m_split.input_count;
+        auto& tensor = is_input ? inputs[slot] : outputs[slot - m_split.input_count];
+        host_tensors[slot] = dynamic_pointer_cast<runtime::HostTensor>(tensor);
+        if (!host_tensors[slot])
+        {
+            if (m_performance_counters_enabled)
+            {
+                m_staging_timers[slot].start();
+            }
+            if (!m_slot_tensors[slot])
+            {
+                m_slot_tensors[slot] = make_shared<HostTensor>(m_split.slot_element_types[slot],
+                                                               m_split.slot_shapes[slot]);
+            }
+            host_tensors[slot] = m_slot_tensors[slot];
+            if (is_input)
+            {
+                tensor->read(host_tensors[slot]->get_data_ptr(), tensor->get_size_in_bytes());
+            }
+            if (m_performance_counters_enabled)
+            {
+                m_staging_timers[slot].stop();
+            }
+        }
+        m_slot_data[slot] = host_tensors[slot]->get_data_ptr();
+    }
+
+    for (auto& stage : m_stages)
+    {
+        bind_stage(stage);
+        stage.executable->call(stage.output_tensors, stage.input_tensors);
+    }
+
+    for (size_t slot = m_split.input_count; slot < io_count; slot++)
+    {
+        auto& tensor = outputs[slot - m_split.input_count];
+        if (host_tensors[slot] != tensor)
+        {
+            if (m_performance_counters_enabled)
+            {
+                m_staging_timers[slot].start();
+            }
+            tensor->write(host_tensors[slot]->get_data_ptr(), tensor->get_size_in_bytes());
+            if (m_performance_counters_enabled)
+            {
+                m_staging_timers[slot].stop();
+            }
+        }
+    }
+    return true;
+}
+
+vector<runtime::PerformanceCounter>
+    runtime::hybrid::HybridExecutable::get_performance_data() const
+{
+    vector<runtime::PerformanceCounter> rc;
+    if (!m_performance_counters_enabled)
+    {
+        return rc;
+    }
+    auto add_counter = [&rc](const shared_ptr<const Node>& node, const stopwatch& timer) {
+        if (timer.get_call_count() > 0)
+        {
+            rc.emplace_back(node, timer.get_total_microseconds(), timer.get_call_count());
+        }
+    };
+    for (size_t i = 0; i < m_split.input_count; i++)
+    {
+        add_counter(get_parameters()[i], m_staging_timers[i]);
+    }
+    for (size_t i = 0; i < m_split.output_count; i++)
+    {
+        add_counter(get_results()[i], m_staging_timers[m_split.input_count + i]);
+    }
+    for (size_t i = 0; i < m_stages.size(); i++)
+    {
+        auto& stage = m_stages[i];
+        auto& function = *m_split.sub_functions[i].function;
+        for (size_t j = 0; j < stage.inputs.size(); j++)
+        {
+            add_counter(function.get_parameters()[j], stage.inputs[j].timer);
+        }
+        for (size_t j = 0; j < stage.outputs.size(); j++)
+        {
+            add_counter(function.get_results()[j], stage.outputs[j].timer);
+        }
+        auto stage_data = stage.executable->get_performance_data();
+        rc.insert(rc.end(), stage_data.begin(), stage_data.end());
+    }
+    return rc;
+}
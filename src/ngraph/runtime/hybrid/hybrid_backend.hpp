@@ -0,0 +1,144 @@
+//*****************************************************************************
+// Copyright 2017-2019 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+
+#pragma once
+
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include "ngraph/runtime/backend.hpp"
+#include "ngraph/runtime/host_tensor.hpp"
+#include "ngraph/runtime/hybrid/hybrid_util.hpp"
+#include "ngraph/util.hpp"
+
+namespace ngraph
+{
+    namespace runtime
+    {
+        namespace hybrid
+        {
+            class HybridBackend;
+            class HybridExecutable;
+        }
+    }
+}
+
+///
+/// \brief Backend placing every op on the first of a list of backends supporting it.
+///
+/// `compile` splits the function into parts that each run on a single backend, see
+/// `split_function_by_placement`, and compiles every part on its backend. The values handed
+/// from one part to another live in host memory wrapped by the tensors of both backends, so
+/// the backends must accept host memory pointers in `create_tensor`.
+///
+/// `Backend::create("HYBRID:CPU,INTERPRETER")` creates a hybrid backend over the listed
+/// backends, in order of preference.
+///
+class ngraph::runtime::hybrid::HybridBackend : public Backend
+{
+public:
+    HybridBackend(const std::vector<std::shared_ptr<runtime::Backend>>& backends);
+
+    std::shared_ptr<Tensor>
+        create_tensor(const element::Type& type, const Shape& shape, void* memory_pointer) override;
+
+    std::shared_ptr<Tensor> create_tensor(const element::Type& type, const Shape& shape) override;
+
+    std::shared_ptr<Executable> compile(std::shared_ptr<Function> function,
+                                        bool enable_performance_data = false) override;
+
+    /// \returns true if any of the backends supports `node`
+    bool is_supported(const Node& node) const override;
+
+    const std::vector<std::shared_ptr<runtime::Backend>>& get_backends() const
+    {
+        return m_backends;
+    }
+
+private:
+    std::vector<std::shared_ptr<runtime::Backend>> m_backends;
+};
+
+///
+/// \brief Runs the parts of a function split by placement one after the other.
+///
+/// The host tensors of the caller are handed to the parts without a copy, and other tensors
+/// are staged through host memory. With performance data enabled, the time taken to hand the
+/// tensors to and from every part is reported as the time of its Parameters and Results,
+/// along with the performance data of the parts.
+///
+/// The slots and the tensors bound to the parts are shared by all calls, so concurrent calls
+/// run one after the other.
+///
+class ngraph::runtime::hybrid::HybridExecutable : public runtime::Executable
+{
+public:
+    HybridExecutable(const std::vector<std::shared_ptr<runtime::Backend>>& backends,
+                     const std::shared_ptr<Function>& function,
+                     bool enable_performance_collection = false);
+
+    bool call(const std::vector<std::shared_ptr<runtime::Tensor>>& outputs,
+              const std::vector<std::shared_ptr<runtime::Tensor>>& inputs) override;
+
+    std::vector<PerformanceCounter> get_performance_data() const override;
+
+    const std::vector<SubFunction>& get_sub_functions() const
+    {
+        return m_split.sub_functions;
+    }
+
+private:
+    // Where a part reads or writes a slot, and the host memory its tensor wraps
+    struct Binding
+    {
+        size_t slot;
+        void* data = nullptr;
+        stopwatch timer;
+    };
+
+    struct Stage
+    {
+        std::shared_ptr<runtime::Backend> backend;
+        std::shared_ptr<runtime::Executable> executable;
+        std::vector<Binding> inputs;
+        std::vector<Binding> outputs;
+        std::vector<std::shared_ptr<runtime::Tensor>> input_tensors;
+        std::vector<std::shared_ptr<runtime::Tensor>> output_tensors;
+    };
+
+    // Wraps the current host memory of the slot of `binding` in a tensor of `backend`, unless
+    // `tensor` already wraps it
+    void bind(Binding& binding,
+              std::shared_ptr<runtime::Tensor>& tensor,
+              runtime::Backend& backend);
+    void bind_stage(Stage& stage);
+
+    std::shared_ptr<Function> m_function;
+    SplitFunction m_split;
+    std::vector<Stage> m_stages;
+    // The host memory of every slot during a call. Boundary slots are allocated once, and the
+    // parameters and results of the function are the tensors of the caller or staging tensors.
+    std::vector<std::shared_ptr<HostTensor>> m_slot_tensors;
+    std::vector<void*> m_slot_data;
+    // Time taken to stage the parameters and results of the function
+    std::vector<stopwatch> m_staging_timers;
+    bool m_performance_counters_enabled;
+    // Held by a call while it binds and runs the parts
+    std::mutex m_call_mutex;
+};
@@ -0,0 +1,204 @@
+//*****************************************************************************
+// Copyright 2017-2019 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+
+#include <algorithm>
+#include <map>
+#include <tuple>
+#include <unordered_map>
+
+#include "ngraph/except.hpp"
+#include "ngraph/op/get_output_element.hpp"
+#include "ngraph/op/parameter.hpp"
+#include "ngraph/op/result.hpp"
+#include "ngraph/runtime/hybrid/hybrid_util.hpp"
+
+using namespace std;
+using namespace ngraph;
+
+void runtime::hybrid::place_nodes(const shared_ptr<Function>& function,
+                                  const vector<shared_ptr<runtime::Backend>>& backends)
+{
+    for (auto& node : function->get_ordered_ops())
+    {
+        if (node->is_parameter() || node->is_constant())
+        {
+            node->set_placement_index(Node::placement_invalid);
+        }
+        else if (node->is_output() || is_type<op::GetOutputElement>(node))
+        {
+            size_t placement = node->input_value(0).get_node()->get_placement_index();
+            node->set_placement_index(placement == Node::placement_invalid ? 0 : placement);
+        }
+        else
+        {
+            size_t placement = 0;
+            while (placement < backends.size() && !backends[placement]->is_supported(*node))
+            {
+                placement++;
+            }
+            if (placement == backends.size())
+            {
+                throw ngraph_error("No backend supports " + node->description() + " op '" +
+                                   node->get_name() + "'");
+            }
+            node->set_placement_index(placement);
+        }
+    }
+}
+
+namespace
+{
+    // A part of the split function while it is being built
+    struct Part
+    {
+        size_t placement;
+        ParameterVector parameters;
+        ResultVector results;
+        vector<size_t> parameter_slots;
+        vector<size_t> result_slots;
+        // The parameter of every slot used by the part, and its copy of every constant
+        unordered_map<size_t, shared_ptr<op::Parameter>> slot_parameters;
+        unordered_map<Node*, shared_ptr<Node>> constants;
+    };
+}
+
+runtime::hybrid::SplitFunction
+    runtime::hybrid::split_function_by_placement(const shared_ptr<Function>& function)
+{
+    SplitFunction split;
+    split.input_count = function->get_parameters().size();
+    split.output_count = function->get_results().size();
+    unordered_map<Node*, size_t> parameter_slots;
+    for (auto& parameter : function->get_parameters())
+    {
+        parameter_slots[parameter.get()] = split.slot_element_types.size();
+        split.slot_element_types.push_back(parameter->get_element_type());
+        split.slot_shapes.push_back(parameter->get_shape());
+    }
+    unordered_map<Node*, size_t> result_slots;
+    for (auto& result : function->get_results())
+    {
+        result_slots[result.get()] = split.slot_element_types.size();
+        split.slot_element_types.push_back(result->get_element_type());
+        split.slot_shapes.push_back(result->get_shape());
+    }
+
+    // A placement change costs a level, so every value handed between parts goes from a lower
+    // level to a higher one, and the parts ordered by level run after all of their inputs
+    auto ops = function->get_ordered_ops();
+    unordered_map<Node*, size_t> levels;
+    map<pair<size_t, size_t>, Part> parts;
+    unordered_map<Node*, Part*> node_parts;
+    for (auto& node : ops)
+    {
+        size_t placement = node->get_placement_index();
+        if (placement == Node::placement_invalid)
+        {
+            continue;
+        }
+        size_t level = 0;
+        for (auto& input : node->inputs())
+        {
+            Node* source = input.get_source_output().get_node();
+            auto it = levels.find(source);
+            if (it != levels.end())
+            {
+                size_t change = source->get_placement_index() == placement ? 0 : 1;
+                level = max(level, it->second + change);
+            }
+        }
+        levels[node.get()] = level;
+        Part& part = parts[make_pair(level, placement)];
+        part.placement = placement;
+        node_parts[node.get()] = &part;
+    }
+
+    // Slots of the values already handed out of their part
+    map<pair<Node*, size_t>, size_t> boundary_slots;
+    auto slot_parameter = [&split](Part& part, size_t slot) {
+        auto& parameter = part.slot_parameters[slot];
+        if (!parameter)
+        {
+            parameter =
+                make_shared<op::Parameter>(split.slot_element_types[slot], split.slot_shapes[slot]);
+            part.parameters.push_back(parameter);
+            part.parameter_slots.push_back(slot);
+        }
+        return parameter;
+    };
+    for (auto& node : ops)
+    {
+        auto node_part = node_parts.find(node.get());
+        if (node_part == node_parts.end())
+        {
+            continue;
+        }
+        Part& part = *node_part->second;
+        for (auto& input : node->inputs())
+        {
+            auto source = input.get_source_output();
+            Node* source_node = source.get_node();
+            if (source_node->is_parameter())
+            {
+                input.replace_source_output(
+                    slot_parameter(part, parameter_slots.at(source_node))->output(0));
+            }
+            else if (source_node->is_constant())
+            {
+                auto& constant = part.constants[source_node];
+                if (!constant)
+                {
+                    constant = source_node->copy_with_new_inputs({});
+                }
+                input.replace_source_output(constant->output(0));
+            }
+            else if (node_parts.at(source_node) != &part)
+            {
+                auto key = make_pair(source_node, source.get_index());
+                auto it = boundary_slots.find(key);
+                if (it == boundary_slots.end())
+                {
+                    size_t slot = split.slot_element_types.size();
+                    split.slot_element_types.push_back(source.get_element_type());
+                    split.slot_shapes.push_back(source.get_shape());
+                    Part& source_part = *node_parts.at(source_node);
+                    source_part.results.push_back(make_shared<op::Result>(source));
+                    source_part.result_slots.push_back(slot);
+                    it = boundary_slots.insert(make_pair(key, slot)).first;
+                }
+                input.replace_source_output(slot_parameter(part, it->second)->output(0));
+            }
+        }
+        if (node->is_output())
+        {
+            part.results.push_back(as_type_ptr<op::Result>(node));
+            part.result_slots.push_back(result_slots.at(node.get()));
+        }
+    }
+
+    for (auto& entry : parts)
+    {
+        Part& part = entry.second;
+        SubFunction sub_function;
+        sub_function.function = make_shared<Function>(part.results, part.parameters);
+        sub_function.placement = part.placement;
+        sub_function.parameter_slots = move(part.parameter_slots);
+        sub_function.result_slots = move(part.result_slots);
+        split.sub_functions.push_back(move(sub_function));
+    }
+    return split;
+}
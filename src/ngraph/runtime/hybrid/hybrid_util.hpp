@@ -0,0 +1,74 @@
+//*****************************************************************************
+// Copyright 2017-2019 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+
+#pragma once
+
+#include <memory>
+#include <vector>
+
+#include "ngraph/function.hpp"
+#include "ngraph/runtime/backend.hpp"
+
+namespace ngraph
+{
+    namespace runtime
+    {
+        namespace hybrid
+        {
+            /// \brief A part of a function split by placement, run on a single backend
+            struct SubFunction
+            {
+                std::shared_ptr<Function> function;
+                /// Index of the backend the part is placed on
+                size_t placement;
+                /// The value slot of every parameter and result of `function`
+                std::vector<size_t> parameter_slots;
+                std::vector<size_t> result_slots;
+            };
+
+            /// \brief A function split into parts that can each run on a single backend.
+            ///
+            /// Every value crossing a part boundary is held in a slot. The first slots are the
+            /// parameters of the function, followed by its results and then by the values
+            /// handed from one part to another. The parts are in execution order: every slot is
+            /// the result of one part, which comes before all of the parts using it.
+            struct SplitFunction
+            {
+                std::vector<SubFunction> sub_functions;
+                size_t input_count;
+                size_t output_count;
+                std::vector<element::Type> slot_element_types;
+                std::vector<Shape> slot_shapes;
+            };
+
+            /// \brief Sets the placement index of every op of `function` to the first of
+            ///        `backends` supporting it. Results and GetOutputElements follow their
+            ///        inputs, and Parameters and Constants are left unplaced.
+            /// \throws ngraph_error if no backend supports an op
+            void place_nodes(const std::shared_ptr<Function>& function,
+                             const std::vector<std::shared_ptr<runtime::Backend>>& backends);
+
+            /// \brief Splits a placed function into maximal parts of ops with the same placement
+            ///
+            /// Ops are levelled by the number of placement changes along their longest input
+            /// path, and every part holds the ops of one level and placement, so the parts
+            /// can run one after the other. Parameters are duplicated into every part using
+            /// them, and Constants copied. The nodes of `function` are rewired in place.
+            SplitFunction split_function_by_placement(const std::shared_ptr<Function>& function);
+        }
+    }
+}
@@ -73,11 +73,8 @@ runtime::interpreter::INTExecutable::INTExecutable(const shared_ptr<Function>& f
     pass_manager.register_pass<pass::AssignLayout<DenseTensorLayout>>();
     pass_manager.register_pass<pass::Liveness>();
     pass_manager.run_passes(m_function);
-    for (auto node : m_function->get_ordered_ops())
-    {
-        m_nodes.push_back(node);
-    }
     set_parameters_and_results(*m_function);
+    prepare_calls();
 }
 
 runtime::interpreter::INTExecutable::INTExecutable(const std::string& model_string)
@@ -85,51 +82,26 @@ runtime::interpreter::INTExecutable::INTExecutable(const std::string& model_stri
     , m_performance_counters_enabled{false}
 {
     m_function = deserialize(model_string);
-    for (auto node : m_function->get_ordered_ops())
-    {
-        m_nodes.push_back(node);
-    }
     set_parameters_and_results(*m_function);
+    prepare_calls();
 }
 
-bool runtime::interpreter::INTExecutable::call(const vector<shared_ptr<runtime::Tensor>>& outputs,
-                                               const vector<shared_ptr<runtime::Tensor>>& inputs)
+void runtime::interpreter::INTExecutable::prepare_calls()
 {
-    runtime::event::Duration d1("call", "Interpreter");
-
-    // convert inputs to HostTensor
-    vector<shared_ptr<HostTensor>> func_inputs;
-    for (auto tensor : inputs)
-    {
-        auto host_tensor = static_pointer_cast<runtime::HostTensor>(tensor);
-        func_inputs.push_back(host_tensor);
-    }
-    if (m_nan_check_enabled)
-    {
-        perform_nan_check(func_inputs);
-    }
-
-    // convert outputs to HostTensor
-    vector<shared_ptr<HostTensor>> func_outputs;
-    for (auto tensor : outputs)
-    {
-        auto host_tensor = static_pointer_cast<runtime::HostTensor>(tensor);
-        func_outputs.push_back(host_tensor);
-    }
-
-    // map function params -> HostTensor
-    unordered_map<descriptor::Tensor*, shared_ptr<HostTensor>> tensor_map;
-    size_t input_count = 0;
+    // map function params -> call inputs
+    unordered_map<descriptor::Tensor*, size_t> input_map;
     for (auto param : get_parameters())
     {
         for (size_t i = 0; i < param->get_output_size(); ++i)
         {
             descriptor::Tensor* tensor = &param->output(i).get_tensor();
-            tensor_map.insert({tensor, func_inputs[input_count++]});
+            input_map.insert({tensor, input_map.size()});
         }
     }
+    m_input_uses.resize(input_map.size());
 
-    // map function outputs -> HostTensor
+    // map function outputs -> call outputs
+    unordered_map<descriptor::Tensor*, size_t> output_map;
     for (size_t output_count = 0; output_count < get_results().size(); ++output_count)
     {
         auto output = get_results()[output_count];
@@ -138,54 +110,63 @@ bool runtime::interpreter::INTExecutable::call(const vector<shared_ptr<runtime::
             throw ngraph_error("One of function's outputs isn't op::Result");
         }
         descriptor::Tensor* tensor = &output->output(0).get_tensor();
-        tensor_map.insert({tensor, func_outputs[output_count]});
+        output_map.insert({tensor, output_count});
     }
+    m_output_uses.resize(output_map.size());
 
     // for each ordered op in the graph
-    for (auto op : m_nodes)
+    unordered_map<descriptor::Tensor*, size_t> intermediate_map;
+    for (auto op : m_function->get_ordered_ops())
     {
-        runtime::event::Duration d2(op->description(), "Interpreter");
         if (op->is_parameter())
         {
             continue;
         }
+        OpCall op_call;
+        op_call.node = op;
+        op_call.type_id = get_typeid(op->get_type_info());
 
-        // get op inputs from map
-        vector<shared_ptr<HostTensor>> op_inputs;
-        for (auto input : op->inputs())
+        // get op inputs from the ops producing them, or bind them to function params
+        for (size_t i = 0; i < op->get_input_size(); ++i)
         {
-            descriptor::Tensor* tensor = &input.get_tensor();
-            op_inputs.push_back(tensor_map.at(tensor));
+            descriptor::Tensor* tensor = &op->input(i).get_tensor();
+            auto it = input_map.find(tensor);
+            if (it == input_map.end())
+            {
+                m_intermediates[intermediate_map.at(tensor)].inputs.push_back({m_calls.size(), i});
+            }
+            else
+            {
+                m_input_uses[it->second].push_back({m_calls.size(), i});
+            }
         }
 
-        // get op outputs from map or create
-        vector<shared_ptr<HostTensor>> op_outputs;
+        // bind op outputs to function outputs, or make them intermediates
         for (size_t i = 0; i < op->get_output_size(); ++i)
         {
             descriptor::Tensor* tensor = &op->output(i).get_tensor();
-            shared_ptr<HostTensor> host_tensor;
-            auto it = tensor_map.find(tensor);
-            if (it == tensor_map.end())
+            auto it = output_map.find(tensor);
+            if (it == output_map.end())
             {
-                const Shape& shape = op->get_output_shape(i);
-                const element::Type& type = op->get_output_element_type(i);
-                string name = op->output(i).get_tensor().get_name();
-                host_tensor = make_shared<runtime::HostTensor>(type, shape, name);
-                tensor_map.insert({tensor, host_tensor});
+                intermediate_map.insert({tensor, m_intermediates.size()});
+                m_intermediates.push_back({op->get_output_element_type(i),
+                                           op->get_output_shape(i),
+                                           tensor->get_name(),
+                                           {m_calls.size(), i},
+                                           {}});
             }
             else
             {
-                host_tensor = it->second;
+                m_output_uses[it->second].push_back({m_calls.size(), i});
             }
-            op_outputs.push_back(host_tensor);
         }
 
         // get op type
-        element::Type type;
         if (is_type<op::Convert>(op) || is_type<op::Quantize>(op) || is_type<op::Dequantize>(op) ||
-            is_type<op::ArgMin>(op) || is_type<op::ArgMax>(op))
+            is_type<op::ArgMin>(op) || is_type<op::ArgMax>(op) ||
+            is_type<op::v1::NonMaxSuppression>(op))
         {
-            type = op->get_input_element_type(0);
+            op_call.type = op->get_input_element_type(0);
         }
         else if (is_type<op::Equal>(op) || is_type<op::Greater>(op) || is_type<op::GreaterEq>(op) ||
                  is_type<op::Less>(op) || is_type<op::LessEq>(op) || is_type<op::NotEqual>(op))
@@ -193,62 +174,180 @@ bool runtime::interpreter::INTExecutable::call(const vector<shared_ptr<runtime::
             // Get the type of the second input, not the first
             // All BinaryElementwiseComparision ops have the same type for inputs
             // Select has bool for first input and the type we are interested in for the second
-            type = op->get_input_element_type(1);
+            op_call.type = op->get_input_element_type(1);
         }
         else if (is_type<op::TopK>(op))
         {
-            type = op->get_output_element_type(1);
+            op_call.type = op->get_output_element_type(1);
         }
         else
         {
-            type = op->get_output_element_type(0);
+            op_call.type = op->get_output_element_type(0);
+        }
+        op_call.engine = get_engine(op_call.type);
+
+        op_call.timer = m_performance_counters_enabled ? &m_timer_map[op] : nullptr;
+        m_calls.push_back(op_call);
+    }
+
+    // allocate the intermediate tensors of the first call now
+    m_frames.push_back(make_frame());
+}
+
+unique_ptr<runtime::interpreter::INTExecutable::CallFrame>
+    runtime::interpreter::INTExecutable::make_frame() const
+{
+    unique_ptr<CallFrame> frame(new CallFrame);
+    frame->inputs.resize(m_calls.size());
+    frame->outputs.resize(m_calls.size());
+    for (size_t i = 0; i < m_calls.size(); ++i)
+    {
+        frame->inputs[i].resize(m_calls[i].node->get_input_size());
+        frame->outputs[i].resize(m_calls[i].node->get_output_size());
+    }
+    for (const Intermediate& intermediate : m_intermediates)
+    {
+        auto host_tensor = make_shared<runtime::HostTensor>(
+            intermediate.type, intermediate.shape, intermediate.name);
+        frame->outputs[intermediate.output.call][intermediate.output.index] = host_tensor;
+        for (const TensorUse& use : intermediate.inputs)
+        {
+            frame->inputs[use.call][use.index] = host_tensor;
+        }
+    }
+    return frame;
+}
+
+runtime::interpreter::INTExecutable::BoundFrame::BoundFrame(
+    INTExecutable& executable,
+    const vector<shared_ptr<Tensor>>& outputs,
+    const vector<shared_ptr<Tensor>>& inputs)
+    : m_executable(executable)
+{
+    {
+        lock_guard<mutex> lock(m_executable.m_frames_mutex);
+        if (!m_executable.m_frames.empty())
+        {
+            m_frame = move(m_executable.m_frames.back());
+            m_executable.m_frames.pop_back();
+        }
+    }
+    if (!m_frame)
+    {
+        m_frame = m_executable.make_frame();
+    }
+
+    // bind function inputs and outputs to the ops using them
+    for (size_t i = 0; i < m_executable.m_input_uses.size(); ++i)
+    {
+        auto host_tensor = static_pointer_cast<runtime::HostTensor>(inputs[i]);
+        for (const TensorUse& use : m_executable.m_input_uses[i])
+        {
+            m_frame->inputs[use.call][use.index] = host_tensor;
+        }
+    }
+    for (size_t i = 0; i < m_executable.m_output_uses.size(); ++i)
+    {
+        auto host_tensor = static_pointer_cast<runtime::HostTensor>(outputs[i]);
+        for (const TensorUse& use : m_executable.m_output_uses[i])
+        {
+            m_frame->outputs[use.call][use.index] = host_tensor;
+        }
+    }
+}
+
+runtime::interpreter::INTExecutable::BoundFrame::~BoundFrame()
+{
+    // don't keep the caller's tensors alive
+    for (const vector<TensorUse>& uses : m_executable.m_input_uses)
+    {
+        for (const TensorUse& use : uses)
+        {
+            m_frame->inputs[use.call][use.index] = nullptr;
+        }
+    }
+    for (const vector<TensorUse>& uses : m_executable.m_output_uses)
+    {
+        for (const TensorUse& use : uses)
+        {
+            m_frame->outputs[use.call][use.index] = nullptr;
+        }
+    }
+    lock_guard<mutex> lock(m_executable.m_frames_mutex);
+    m_executable.m_frames.push_back(move(m_frame));
+}
+
+bool runtime::interpreter::INTExecutable::call(const vector<shared_ptr<runtime::Tensor>>& outputs,
+                                               const vector<shared_ptr<runtime::Tensor>>& inputs)
+{
+    runtime::event::Duration d1("call", "Interpreter");
+
+    if (m_nan_check_enabled)
+    {
+        vector<shared_ptr<HostTensor>> func_inputs;
+        for (auto tensor : inputs)
+        {
+            func_inputs.push_back(static_pointer_cast<runtime::HostTensor>(tensor));
+        }
+        perform_nan_check(func_inputs);
+    }
+
+    BoundFrame bound_frame(*this, outputs, inputs);
+    CallFrame& frame = bound_frame.get();
+
+    for (size_t i = 0; i < m_calls.size(); ++i)
+    {
+        const OpCall& op_call = m_calls[i];
+        const Node& op = *op_call.node;
+        runtime::event::Duration d2(op.description(), "Interpreter");
+        if (!op_call.engine)
+        {
+            stringstream ss;
+            ss << "unsupported element type " << op_call.type << " op " << op.get_name();
+            throw ngraph_error(ss.str());
         }
 
-        if (m_performance_counters_enabled)
+        if (op_call.timer)
         {
-            m_timer_map[op].start();
+            op_call.timer->start();
         }
-        generate_calls(type, *op.get(), op_outputs, op_inputs);
-        if (m_performance_counters_enabled)
+        (this->*op_call.engine)(op_call.type_id, op, frame.outputs[i], frame.inputs[i]);
+        if (op_call.timer)
         {
-            m_timer_map[op].stop();
+            op_call.timer->stop();
         }
         if (m_nan_check_enabled)
         {
-            perform_nan_check(op_outputs, op.get());
+            perform_nan_check(frame.outputs[i], &op);
         }
     }
 
     return true;
 }
 
-void runtime::interpreter::INTExecutable::generate_calls(const element::Type& type,
-                                                         const Node& op,
-                                                         const vector<shared_ptr<HostTensor>>& out,
-                                                         const vector<shared_ptr<HostTensor>>& in)
+runtime::interpreter::INTExecutable::OpEngine
+    runtime::interpreter::INTExecutable::get_engine(const element::Type& type)
 {
-    stringstream ss;
     switch (type)
     {
-    case element::Type_t::boolean: op_engine<char>(op, out, in); break;
-    case element::Type_t::f32: op_engine<float>(op, out, in); break;
-    case element::Type_t::f64: op_engine<double>(op, out, in); break;
-    case element::Type_t::i8: op_engine<int8_t>(op, out, in); break;
-    case element::Type_t::i16: op_engine<int16_t>(op, out, in); break;
-    case element::Type_t::i32: op_engine<int32_t>(op, out, in); break;
-    case element::Type_t::i64: op_engine<int64_t>(op, out, in); break;
-    case element::Type_t::u8: op_engine<uint8_t>(op, out, in); break;
-    case element::Type_t::u16: op_engine<uint16_t>(op, out, in); break;
-    case element::Type_t::u32: op_engine<uint32_t>(op, out, in); break;
-    case element::Type_t::u64: op_engine<uint64_t>(op, out, in); break;
+    case element::Type_t::boolean: return &INTExecutable::op_engine<char>;
+    case element::Type_t::f32: return &INTExecutable::op_engine<float>;
+    case element::Type_t::f64: return &INTExecutable::op_engine<double>;
+    case element::Type_t::i8: return &INTExecutable::op_engine<int8_t>;
+    case element::Type_t::i16: return &INTExecutable::op_engine<int16_t>;
+    case element::Type_t::i32: return &INTExecutable::op_engine<int32_t>;
+    case element::Type_t::i64: return &INTExecutable::op_engine<int64_t>;
+    case element::Type_t::u8: return &INTExecutable::op_engine<uint8_t>;
+    case element::Type_t::u16: return &INTExecutable::op_engine<uint16_t>;
+    case element::Type_t::u32: return &INTExecutable::op_engine<uint32_t>;
+    case element::Type_t::u64: return &INTExecutable::op_engine<uint64_t>;
     case element::Type_t::undefined:
     case element::Type_t::dynamic:
     case element::Type_t::u1:
     case element::Type_t::bf16:
-    case element::Type_t::f16:
-        ss << "unsupported element type " << type << " op " << op.get_name();
-        throw ngraph_error(ss.str());
+    case element::Type_t::f16: break;
     }
+    return nullptr;
 }
 
 void runtime::interpreter::INTExecutable::set_nan_check(bool enable)
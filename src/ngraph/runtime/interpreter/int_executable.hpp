@@ -19,6 +19,7 @@
 #include <initializer_list>
 #include <iostream>
 #include <memory>
+#include <mutex>
 #include <sstream>
 #include <string>
 #include <vector>
@@ -55,6 +56,7 @@
 #include "ngraph/runtime/reference/copy.hpp"
 #include "ngraph/runtime/reference/cos.hpp"
 #include "ngraph/runtime/reference/cosh.hpp"
+#include "ngraph/runtime/reference/crop_and_resize.hpp"
 #include "ngraph/runtime/reference/cum_sum.hpp"
 #include "ngraph/runtime/reference/dequantize.hpp"
 #include "ngraph/runtime/reference/divide.hpp"
@@ -66,9 +68,11 @@
 #include "ngraph/runtime/reference/floor.hpp"
 #include "ngraph/runtime/reference/gather.hpp"
 #include "ngraph/runtime/reference/gather_nd.hpp"
+#include "ngraph/runtime/reference/gather_tree.hpp"
 #include "ngraph/runtime/reference/generate_mask.hpp"
 #include "ngraph/runtime/reference/greater.hpp"
 #include "ngraph/runtime/reference/greater_eq.hpp"
+#include "ngraph/runtime/reference/interpolate.hpp"
 #include "ngraph/runtime/reference/less.hpp"
 #include "ngraph/runtime/reference/less_eq.hpp"
 #include "ngraph/runtime/reference/log.hpp"
@@ -80,6 +84,7 @@
 #include "ngraph/runtime/reference/minimum.hpp"
 #include "ngraph/runtime/reference/multiply.hpp"
 #include "ngraph/runtime/reference/negate.hpp"
+#include "ngraph/runtime/reference/non_max_suppression.hpp"
 #include "ngraph/runtime/reference/not.hpp"
 #include "ngraph/runtime/reference/not_equal.hpp"
 #include "ngraph/runtime/reference/one_hot.hpp"
@@ -127,21 +132,18 @@ namespace ngraph
             class INTBackend;
             class INTExecutable;
 
-            namespace
-            {
-                // This expands the op list in op_tbl.hpp into a list of enumerations that look like
-                // this:
-                // Abs,
-                // Acos,
-                // ...
-                enum class OP_TYPEID
-                {
+            // This expands the op list in op_tbl.hpp into a list of enumerations that look like
+            // this:
+            // Abs,
+            // Acos,
+            // ...
+            enum class OP_TYPEID
+            {
 #define NGRAPH_OP(NAME, NAMESPACE) ID_SUFFIX(NAME),
 #include "ngraph/runtime/interpreter/opset_int_tbl.hpp"
 #undef NGRAPH_OP
-                    UnknownOp
-                };
-            }
+                UnknownOp
+            };
 
         } // namespace interpreter
     }     // namespace runtime
@@ -185,22 +187,88 @@ private:
     bool m_performance_counters_enabled = false;
     std::shared_ptr<Function> m_function;
     std::unordered_map<std::shared_ptr<const Node>, stopwatch> m_timer_map;
-    std::vector<std::shared_ptr<Node>> m_nodes;
     std::unordered_map<const Node*, std::shared_ptr<State>> m_states;
     std::set<std::string> m_unsupported_op_name_list;
 
+    using OpEngine = void (INTExecutable::*)(OP_TYPEID,
+                                             const Node&,
+                                             const std::vector<std::shared_ptr<HostTensor>>&,
+                                             const std::vector<std::shared_ptr<HostTensor>>&);
+
+    // An op of the function, with its kernel resolved when compiled
+    struct OpCall
+    {
+        std::shared_ptr<Node> node;
+        OP_TYPEID type_id;
+        element::Type type;
+        // nullptr if the element type is not supported
+        OpEngine engine;
+        // nullptr unless performance counters are enabled
+        stopwatch* timer;
+    };
+
+    // An op input or output, by its index in m_calls and in the op
+    struct TensorUse
+    {
+        size_t call;
+        size_t index;
+    };
+
+    // A tensor passed between two ops of the function
+    struct Intermediate
+    {
+        element::Type type;
+        Shape shape;
+        std::string name;
+        TensorUse output;
+        std::vector<TensorUse> inputs;
+    };
+
+    // The tensors of the ops of one call. A frame owns its intermediate tensors, and is bound to
+    // the function inputs and outputs of the call using it.
+    struct CallFrame
+    {
+        std::vector<std::vector<std::shared_ptr<HostTensor>>> inputs;
+        std::vector<std::vector<std::shared_ptr<HostTensor>>> outputs;
+    };
+
+    // Takes a frame from the pool and binds it to the tensors of a call, then unbinds it and
+    // returns it to the pool when destroyed
+    class BoundFrame
+    {
+    public:
+        BoundFrame(INTExecutable& executable,
+                   const std::vector<std::shared_ptr<Tensor>>& outputs,
+                   const std::vector<std::shared_ptr<Tensor>>& inputs);
+        ~BoundFrame();
+        CallFrame& get() { return *m_frame; }
+
+    private:
+        INTExecutable& m_executable;
+        std::unique_ptr<CallFrame> m_frame;
+    };
+
+    std::vector<OpCall> m_calls;
+    std::vector<std::vector<TensorUse>> m_input_uses;
+    std::vector<std::vector<TensorUse>> m_output_uses;
+    std::vector<Intermediate> m_intermediates;
+    // Frames not used by a call, concurrent calls each take their own
+    std::vector<std::unique_ptr<CallFrame>> m_frames;
+    std::mutex m_frames_mutex;
+
     static OP_TYPEID get_typeid(const NodeTypeInfo& type_info);
 
     static void perform_nan_check(const std::vector<std::shared_ptr<HostTensor>>&,
                                   const Node* op = nullptr);
 
-    void generate_calls(const element::Type& type,
-                        const Node& op,
-                        const std::vector<std::shared_ptr<HostTensor>>& outputs,
-                        const std::vector<std::shared_ptr<HostTensor>>& inputs);
+    void prepare_calls();
+    std::unique_ptr<CallFrame> make_frame() const;
+
+    static OpEngine get_engine(const element::Type& type);
 
     template <typename T>
-    void op_engine(const Node& node,
+    void op_engine(OP_TYPEID type_id,
+                   const Node& node,
                    const std::vector<std::shared_ptr<HostTensor>>& out,
                    const std::vector<std::shared_ptr<HostTensor>>& args)
     {
@@ -213,7 +281,7 @@ private:
 #pragma GCC diagnostic error "-Wswitch-enum"
 // #pragma GCC diagnostic error "-Wcovered-switch-default"
 #endif
-        switch (get_typeid(node.get_type_info()))
+        switch (type_id)
         {
         case OP_TYPEID::Abs:
         {
@@ -713,7 +781,64 @@ private:
         }
         case OP_TYPEID::CropAndResize:
         {
-            throw unsupported_op("Unsupported op '" + node.description() + "'");
+            auto crop_and_resize = static_cast<const op::CropAndResize*>(&node);
+            auto boxes_et = node.get_input_element_type(1);
+            auto box_indices_et = node.get_input_element_type(2);
+            if (boxes_et == element::f32 && box_indices_et == element::i32)
+            {
+                reference::crop_and_resize<T, float, int32_t>(
+                    args[0]->get_data_ptr<const T>(),
+                    args[1]->get_data_ptr<const float>(),
+                    args[2]->get_data_ptr<const int32_t>(),
+                    out[0]->get_data_ptr<T>(),
+                    node.get_input_shape(0),
+                    node.get_output_shape(0),
+                    crop_and_resize->get_resize_method(),
+                    crop_and_resize->get_extrapolation_value());
+            }
+            else if (boxes_et == element::f32 && box_indices_et == element::i64)
+            {
+                reference::crop_and_resize<T, float, int64_t>(
+                    args[0]->get_data_ptr<const T>(),
+                    args[1]->get_data_ptr<const float>(),
+                    args[2]->get_data_ptr<const int64_t>(),
+                    out[0]->get_data_ptr<T>(),
+                    node.get_input_shape(0),
+                    node.get_output_shape(0),
+                    crop_and_resize->get_resize_method(),
+                    crop_and_resize->get_extrapolation_value());
+            }
+            else if (boxes_et == element::f64 && box_indices_et == element::i32)
+            {
+                reference::crop_and_resize<T, double, int32_t>(
+                    args[0]->get_data_ptr<const T>(),
+                    args[1]->get_data_ptr<const double>(),
+                    args[2]->get_data_ptr<const int32_t>(),
+                    out[0]->get_data_ptr<T>(),
+                    node.get_input_shape(0),
+                    node.get_output_shape(0),
+                    crop_and_resize->get_resize_method(),
+                    crop_and_resize->get_extrapolation_value());
+            }
+            else if (boxes_et == element::f64 && box_indices_et == element::i64)
+            {
+                reference::crop_and_resize<T, double, int64_t>(
+                    args[0]->get_data_ptr<const T>(),
+                    args[1]->get_data_ptr<const double>(),
+                    args[2]->get_data_ptr<const int64_t>(),
+                    out[0]->get_data_ptr<T>(),
+                    node.get_input_shape(0),
+                    node.get_output_shape(0),
+                    crop_and_resize->get_resize_method(),
+                    crop_and_resize->get_extrapolation_value());
+            }
+            else
+            {
+                std::stringstream ss;
+                ss << "unsupported element types " << boxes_et.get_type_name() << " boxes and "
+                   << box_indices_et.get_type_name() << " box indices op CropAndResize";
+                throw ngraph_error(ss.str());
+            }
             break;
         }
         case OP_TYPEID::Dequantize:
@@ -942,6 +1067,23 @@ private:
             }
             break;
         }
+        case OP_TYPEID::GatherTree_v1:
+        {
+            for (size_t i = 1; i < args.size(); i++)
+            {
+                if (args[i]->get_element_type() != node.get_input_element_type(0))
+                {
+                    throw ngraph_error("GatherTree inputs must have the same element type");
+                }
+            }
+            reference::gather_tree<T>(args[0]->get_data_ptr<const T>(),
+                                      args[1]->get_data_ptr<const T>(),
+                                      args[2]->get_data_ptr<const T>(),
+                                      args[3]->get_data_ptr<const T>(),
+                                      out[0]->get_data_ptr<T>(),
+                                      node.get_input_shape(0));
+            break;
+        }
         case OP_TYPEID::Greater:
         {
             auto greater = static_cast<const op::Greater*>(&node);
@@ -964,6 +1106,16 @@ private:
                                      greater_eq->get_autob());
             break;
         }
+        case OP_TYPEID::Interpolate:
+        {
+            auto interpolate = static_cast<const op::Interpolate*>(&node);
+            reference::interpolate<T>(args[0]->get_data_ptr<const T>(),
+                                      out[0]->get_data_ptr<T>(),
+                                      node.get_input_shape(0),
+                                      node.get_output_shape(0),
+                                      interpolate->get_attrs());
+            break;
+        }
         case OP_TYPEID::Less:
         {
             auto less = static_cast<const op::Less*>(&node);
@@ -1140,6 +1292,25 @@ private:
                 args[0]->get_data_ptr<const T>(), out[0]->get_data_ptr<T>(), element_count);
             break;
         }
+        case OP_TYPEID::NonMaxSuppression_v1:
+        {
+            auto nms = static_cast<const op::v1::NonMaxSuppression*>(&node);
+            reference::non_max_suppression<T>(
+                args[0]->get_data_ptr<const T>(),
+                args[1]->get_data_ptr<const T>(),
+                out[0]->get_data_ptr<int64_t>(),
+                node.get_input_shape(1),
+                node.get_output_shape(0),
+                reference::non_max_suppression_scalar<int64_t>(args[2]->get_data_ptr(),
+                                                               args[2]->get_element_type()),
+                reference::non_max_suppression_scalar<float>(args[3]->get_data_ptr(),
+                                                             args[3]->get_element_type()),
+                reference::non_max_suppression_scalar<float>(args[4]->get_data_ptr(),
+                                                             args[4]->get_element_type()),
+                nms->get_box_encoding(),
+                nms->get_sort_result_descending());
+            break;
+        }
         case OP_TYPEID::LogicalNot_v1:
         case OP_TYPEID::Not:
         {
@@ -1866,7 +2037,6 @@ private:
         case OP_TYPEID::Gemm:
         case OP_TYPEID::GroupConvolutionTranspose:
         case OP_TYPEID::HardSigmoid:
-        case OP_TYPEID::Interpolate:
         case OP_TYPEID::LayerNorm:
         case OP_TYPEID::LayerNormBackprop:
         case OP_TYPEID::LogSoftmax:
@@ -0,0 +1,130 @@
+//*****************************************************************************
+// Copyright 2017-2019 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#pragma once
+
+#include <cmath>
+
+#include "ngraph/except.hpp"
+#include "ngraph/op/crop_and_resize.hpp"
+#include "ngraph/shape.hpp"
+
+namespace ngraph
+{
+    namespace runtime
+    {
+        namespace reference
+        {
+            // Where the crop coordinate `i` of a box from `start` to `end` samples an image
+            // dimension of `size`, as in TensorFlow's crop_and_resize
+            inline float crop_and_resize_source(
+                float start, float end, size_t i, size_t crop_size, size_t size)
+            {
+                if (crop_size > 1)
+                {
+                    return start * (size - 1) + i * ((end - start) * (size - 1) / (crop_size - 1));
+                }
+                return 0.5f * (start + end) * (size - 1);
+            }
+
+            template <typename T, typename B, typename I>
+            void crop_and_resize(const T* image,
+                                 const B* boxes,
+                                 const I* box_indices,
+                                 T* out,
+                                 const Shape& image_shape,
+                                 const Shape& out_shape,
+                                 op::CropAndResize::ResizeMethod resize_method,
+                                 float extrapolation_value)
+            {
+                size_t image_height = image_shape[1];
+                size_t image_width = image_shape[2];
+                size_t depth = image_shape[3];
+                size_t num_boxes = out_shape[0];
+                size_t crop_height = out_shape[1];
+                size_t crop_width = out_shape[2];
+                auto pixel = [&](size_t batch, size_t y, size_t x) {
+                    return image + ((batch * image_height + y) * image_width + x) * depth;
+                };
+
+                for (size_t box = 0; box < num_boxes; box++)
+                {
+                    auto batch = static_cast<int64_t>(box_indices[box]);
+                    if (batch < 0 || batch >= static_cast<int64_t>(image_shape[0]))
+                    {
+                        throw ngraph_error("CropAndResize box index out of range");
+                    }
+                    float y1 = static_cast<float>(boxes[4 * box]);
+                    float x1 = static_cast<float>(boxes[4 * box + 1]);
+                    float y2 = static_cast<float>(boxes[4 * box + 2]);
+                    float x2 = static_cast<float>(boxes[4 * box + 3]);
+                    for (size_t y = 0; y < crop_height; y++)
+                    {
+                        float in_y = crop_and_resize_source(y1, y2, y, crop_height, image_height);
+                        for (size_t x = 0; x < crop_width; x++)
+                        {
+                            float in_x = crop_and_resize_source(x1, x2, x, crop_width, image_width);
+                            T* result = out + ((box * crop_height + y) * crop_width + x) * depth;
+                            if (in_y < 0 || in_y > image_height - 1 || in_x < 0 ||
+                                in_x > image_width - 1)
+                            {
+                                for (size_t c = 0; c < depth; c++)
+                                {
+                                    result[c] = static_cast<T>(extrapolation_value);
+                                }
+                            }
+                            else if (resize_method == op::CropAndResize::ResizeMethod::nearest)
+                            {
+                                const T* source = pixel(batch,
+                                                        static_cast<size_t>(std::round(in_y)),
+                                                        static_cast<size_t>(std::round(in_x)));
+                                for (size_t c = 0; c < depth; c++)
+                                {
+                                    result[c] = source[c];
+                                }
+                            }
+                            else
+                            {
+                                auto top = static_cast<size_t>(std::floor(in_y));
+                                auto bottom = static_cast<size_t>(std::ceil(in_y));
+                                auto left = static_cast<size_t>(std::floor(in_x));
+                                auto right = static_cast<size_t>(std::ceil(in_x));
+                                float y_lerp = in_y - top;
+                                float x_lerp = in_x - left;
+                                const T* top_left = pixel(batch, top, left);
+                                const T* top_right = pixel(batch, top, right);
+                                const T* bottom_left = pixel(batch, bottom, left);
+                                const T* bottom_right = pixel(batch, bottom, right);
+                                for (size_t c = 0; c < depth; c++)
+                                {
+                                    float top_value =
+                                        top_left[c] +
+                                        (static_cast<float>(top_right[c]) - top_left[c]) * x_lerp;
+                                    float bottom_value =
+                                        bottom_left[c] +
+                                        (static_cast<float>(bottom_right[c]) - bottom_left[c]) *
+                                            x_lerp;
+                                    result[c] = static_cast<T>(
+                                        top_value + (bottom_value - top_value) * y_lerp);
+                                }
+                            }
+                        }
+                    }
+                }
+            }
+        }
+    }
+}
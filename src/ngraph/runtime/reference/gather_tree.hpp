@@ -0,0 +1,98 @@
+//*****************************************************************************
+// Copyright 2017-2019 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#pragma once
+
+#include <algorithm>
+#include <cstdint>
+
+#include "ngraph/shape.hpp"
+
+namespace ngraph
+{
+    namespace runtime
+    {
+        namespace reference
+        {
+            // Backtracks every beam from its last step through its parents, like TensorFlow's
+            // gather_tree. All inputs are [max_time, batch_size, beam_width], except for
+            // max_seq_len, which is [batch_size], and the scalar end_token. Steps past the
+            // length of a sequence and after its first end token are set to end_token, and a
+            // step whose parent is out of range is set to -1, with the steps before it left
+            // as end_token.
+            template <typename T>
+            void gather_tree(const T* step_ids,
+                             const T* parent_ids,
+                             const T* max_seq_len,
+                             const T* end_token,
+                             T* out,
+                             const Shape& shape)
+            {
+                size_t max_time = shape[0];
+                size_t batch_size = shape[1];
+                size_t beam_width = shape[2];
+                T end = *end_token;
+                auto index = [batch_size, beam_width](size_t time, size_t batch, size_t beam) {
+                    return (time * batch_size + batch) * beam_width + beam;
+                };
+
+                std::fill(out, out + max_time * batch_size * beam_width, end);
+                for (size_t batch = 0; batch < batch_size; batch++)
+                {
+                    auto sequence_length = std::min(static_cast<int64_t>(max_seq_len[batch]),
+                                                    static_cast<int64_t>(max_time));
+                    if (sequence_length <= 0)
+                    {
+                        continue;
+                    }
+                    auto length = static_cast<size_t>(sequence_length);
+                    for (size_t beam = 0; beam < beam_width; beam++)
+                    {
+                        out[index(length - 1, batch, beam)] =
+                            step_ids[index(length - 1, batch, beam)];
+                        auto parent =
+                            static_cast<int64_t>(parent_ids[index(length - 1, batch, beam)]);
+                        for (size_t level = length - 1; level-- > 0;)
+                        {
+                            if (parent < 0 || parent >= static_cast<int64_t>(beam_width))
+                            {
+                                out[index(level, batch, beam)] = static_cast<T>(-1);
+                                break;
+                            }
+                            auto source = index(level, batch, static_cast<size_t>(parent));
+                            out[index(level, batch, beam)] = step_ids[source];
+                            parent = static_cast<int64_t>(parent_ids[source]);
+                        }
+
+                        bool finished = false;
+                        for (size_t time = 0; time < length; time++)
+                        {
+                            T& id = out[index(time, batch, beam)];
+                            if (finished)
+                            {
+                                id = end;
+                            }
+                            else if (!(id < end) && !(end < id))
+                            {
+                                finished = true;
+                            }
+                        }
+                    }
+                }
+            }
+        }
+    }
+}
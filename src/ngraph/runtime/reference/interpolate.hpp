@@ -0,0 +1,193 @@
+//*****************************************************************************
+// Copyright 2017-2019 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#pragma once
+
+#include <algorithm>
+#include <cmath>
+#include <string>
+#include <vector>
+
+#include "ngraph/check.hpp"
+#include "ngraph/coordinate_transform.hpp"
+#include "ngraph/except.hpp"
+#include "ngraph/op/experimental/layers/interpolate.hpp"
+#include "ngraph/shape.hpp"
+
+namespace ngraph
+{
+    namespace runtime
+    {
+        namespace reference
+        {
+            // The input elements every output element along one axis is interpolated from. Output
+            // element `i` is the sum of weights[i * taps + k] * input[indices[i * taps + k]].
+            struct InterpolateTaps
+            {
+                size_t taps;
+                std::vector<size_t> indices;
+                std::vector<double> weights;
+            };
+
+            // Keys' cubic convolution kernel, with the coefficient used by TensorFlow and OpenCV
+            inline double cubic_interpolation_weight(double distance)
+            {
+                const double a = -0.75;
+                distance = std::abs(distance);
+                if (distance <= 1)
+                {
+                    return ((a + 2) * distance - (a + 3)) * distance * distance + 1;
+                }
+                if (distance < 2)
+                {
+                    return ((a * distance - 5 * a) * distance + 8 * a) * distance - 4 * a;
+                }
+                return 0;
+            }
+
+            // Output coordinates are mapped to the input like TensorFlow's resize ops without
+            // half-pixel centers. Taps outside of the input are clamped to its border.
+            inline InterpolateTaps interpolate_taps(size_t in_size,
+                                                    size_t out_size,
+                                                    const std::string& mode,
+                                                    bool align_corners)
+            {
+                double scale = static_cast<double>(in_size) / out_size;
+                if (align_corners)
+                {
+                    scale = out_size > 1 ? static_cast<double>(in_size - 1) / (out_size - 1) : 0;
+                }
+                auto clamp = [in_size](int64_t index) {
+                    return static_cast<size_t>(
+                        std::min<int64_t>(std::max<int64_t>(index, 0), in_size - 1));
+                };
+
+                InterpolateTaps result;
+                if (mode == "nearest")
+                {
+                    result.taps = 1;
+                }
+                else if (mode == "linear")
+                {
+                    result.taps = 2;
+                }
+                else if (mode == "cubic")
+                {
+                    result.taps = 4;
+                }
+                else
+                {
+                    throw ngraph_error("Unsupported interpolation mode '" + mode + "'");
+                }
+                result.indices.reserve(out_size * result.taps);
+                result.weights.reserve(out_size * result.taps);
+                for (size_t i = 0; i < out_size; i++)
+                {
+                    double source = i * scale;
+                    double base = std::floor(source);
+                    double t = source - base;
+                    auto index = static_cast<int64_t>(base);
+                    if (result.taps == 1)
+                    {
+                        if (align_corners)
+                        {
+                            index = static_cast<int64_t>(std::round(source));
+                        }
+                        result.indices.push_back(clamp(index));
+                        result.weights.push_back(1);
+                    }
+                    else if (result.taps == 2)
+                    {
+                        result.indices.push_back(clamp(index));
+                        result.indices.push_back(clamp(index + 1));
+                        result.weights.push_back(1 - t);
+                        result.weights.push_back(t);
+                    }
+                    else
+                    {
+                        for (int64_t k = -1; k <= 2; k++)
+                        {
+                            result.indices.push_back(clamp(index + k));
+                            result.weights.push_back(cubic_interpolation_weight(t - k));
+                        }
+                    }
+                }
+                return result;
+            }
+
+            template <typename T>
+            void interpolate(const T* arg,
+                             T* out,
+                             const Shape& arg_shape,
+                             const Shape& out_shape,
+                             const op::InterpolateAttrs& attrs)
+            {
+                NGRAPH_CHECK(!attrs.antialias, "Antialiased interpolation is not supported");
+                for (auto pad : attrs.pads_begin)
+                {
+                    NGRAPH_CHECK(pad == 0, "Padded interpolation is not supported");
+                }
+                for (auto pad : attrs.pads_end)
+                {
+                    NGRAPH_CHECK(pad == 0, "Padded interpolation is not supported");
+                }
+
+                std::vector<size_t> axes(attrs.axes.begin(), attrs.axes.end());
+                std::vector<InterpolateTaps> axis_taps;
+                size_t combinations = 1;
+                for (auto axis : axes)
+                {
+                    axis_taps.push_back(interpolate_taps(
+                        arg_shape[axis], out_shape[axis], attrs.mode, attrs.align_corners));
+                    combinations *= axis_taps.back().taps;
+                }
+
+                auto arg_strides = row_major_strides(arg_shape);
+                CoordinateTransform output_transform(out_shape);
+                for (const Coordinate& out_coord : output_transform)
+                {
+                    size_t base = 0;
+                    for (size_t axis = 0; axis < arg_shape.size(); axis++)
+                    {
+                        if (attrs.axes.count(axis) == 0)
+                        {
+                            base += out_coord[axis] * arg_strides[axis];
+                        }
+                    }
+
+                    // Every combination of the taps along the interpolated axes
+                    double sum = 0;
+                    for (size_t combination = 0; combination < combinations; combination++)
+                    {
+                        size_t rest = combination;
+                        size_t offset = base;
+                        double weight = 1;
+                        for (size_t i = 0; i < axes.size(); i++)
+                        {
+                            auto& taps = axis_taps[i];
+                            size_t tap = out_coord[axes[i]] * taps.taps + rest % taps.taps;
+                            rest /= taps.taps;
+                            offset += taps.indices[tap] * arg_strides[axes[i]];
+                            weight *= taps.weights[tap];
+                        }
+                        sum += weight * arg[offset];
+                    }
+                    out[output_transform.index(out_coord)] = static_cast<T>(sum);
+                }
+            }
+        }
+    }
+}
@@ -0,0 +1,219 @@
+//*****************************************************************************
+// Copyright 2017-2019 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#pragma once
+
+#include <algorithm>
+#include <cstdint>
+#include <vector>
+
+#include "ngraph/except.hpp"
+#include "ngraph/op/non_max_suppression.hpp"
+#include "ngraph/shape.hpp"
+#include "ngraph/type/element_type.hpp"
+
+namespace ngraph
+{
+    namespace runtime
+    {
+        namespace reference
+        {
+            // The scalar inputs of NonMaxSuppression can be of any numeric type
+            template <typename U>
+            U non_max_suppression_scalar(const void* data, const element::Type& element_type)
+            {
+#if defined(__clang__)
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wswitch-enum"
+#endif
+                switch (static_cast<element::Type_t>(element_type))
+                {
+                case element::Type_t::f32: return static_cast<U>(*static_cast<const float*>(data));
+                case element::Type_t::f64:
+                    return static_cast<U>(*static_cast<const double*>(data));
+                case element::Type_t::i8: return static_cast<U>(*static_cast<const int8_t*>(data));
+                case element::Type_t::i16:
+                    return static_cast<U>(*static_cast<const int16_t*>(data));
+                case element::Type_t::i32:
+                    return static_cast<U>(*static_cast<const int32_t*>(data));
+                case element::Type_t::i64:
+                    return static_cast<U>(*static_cast<const int64_t*>(data));
+                case element::Type_t::u8:
+                    return static_cast<U>(*static_cast<const uint8_t*>(data));
+                case element::Type_t::u16:
+                    return static_cast<U>(*static_cast<const uint16_t*>(data));
+                case element::Type_t::u32:
+                    return static_cast<U>(*static_cast<const uint32_t*>(data));
+                case element::Type_t::u64:
+                    return static_cast<U>(*static_cast<const uint64_t*>(data));
+                default: throw ngraph_error("Unsupported NonMaxSuppression input element type");
+                }
+#if defined(__clang__)
+#pragma clang diagnostic pop
+#endif
+            }
+
+            // Corners of a box as [ymin, xmin, ymax, xmax]
+            template <typename T>
+            void non_max_suppression_corners(
+                const T* box,
+                op::v1::NonMaxSuppression::BoxEncodingType box_encoding,
+                T* corners)
+            {
+                if (box_encoding == op::v1::NonMaxSuppression::BoxEncodingType::CENTER)
+                {
+                    // [x_center, y_center, width, height]
+                    corners[0] = box[1] - box[3] / 2;
+                    corners[1] = box[0] - box[2] / 2;
+                    corners[2] = box[1] + box[3] / 2;
+                    corners[3] = box[0] + box[2] / 2;
+                }
+                else
+                {
+                    // [y1, x1, y2, x2], where the two corners can be any diagonal pair
+                    corners[0] = std::min(box[0], box[2]);
+                    corners[1] = std::min(box[1], box[3]);
+                    corners[2] = std::max(box[0], box[2]);
+                    corners[3] = std::max(box[1], box[3]);
+                }
+            }
+
+            template <typename T>
+            T intersection_over_union(const T* a, const T* b)
+            {
+                T area_a = (a[2] - a[0]) * (a[3] - a[1]);
+                T area_b = (b[2] - b[0]) * (b[3] - b[1]);
+                if (area_a <= 0 || area_b <= 0)
+                {
+                    return 0;
+                }
+                T height = std::min(a[2], b[2]) - std::max(a[0], b[0]);
+                T width = std::min(a[3], b[3]) - std::max(a[1], b[1]);
+                if (height <= 0 || width <= 0)
+                {
+                    return 0;
+                }
+                T intersection = height * width;
+                return intersection / (area_a + area_b - intersection);
+            }
+
+            // Writes [batch, class, box] for every selected box, and -1 in the rows left over
+            template <typename T>
+            void non_max_suppression(const T* boxes,
+                                     const T* scores,
+                                     int64_t* out,
+                                     const Shape& scores_shape,
+                                     const Shape& out_shape,
+                                     int64_t max_output_boxes_per_class,
+                                     float iou_threshold,
+                                     float score_threshold,
+                                     op::v1::NonMaxSuppression::BoxEncodingType box_encoding,
+                                     bool sort_result_descending)
+            {
+                struct SelectedBox
+                {
+                    T score;
+                    int64_t batch;
+                    int64_t class_id;
+                    int64_t box;
+                };
+
+                size_t num_batches = scores_shape[0];
+                size_t num_classes = scores_shape[1];
+                size_t num_boxes = scores_shape[2];
+                std::vector<SelectedBox> selected;
+                std::vector<T> corners(4 * num_boxes);
+                for (size_t batch = 0; batch < num_batches; batch++)
+                {
+                    for (size_t i = 0; i < num_boxes; i++)
+                    {
+                        non_max_suppression_corners(
+                            boxes + (batch * num_boxes + i) * 4, box_encoding, &corners[4 * i]);
+                    }
+                    for (size_t class_id = 0; class_id < num_classes; class_id++)
+                    {
+                        const T* class_scores =
+                            scores + (batch * num_classes + class_id) * num_boxes;
+                        std::vector<size_t> candidates;
+                        for (size_t i = 0; i < num_boxes; i++)
+                        {
+                            if (class_scores[i] > score_threshold)
+                            {
+                                candidates.push_back(i);
+                            }
+                        }
+                        std::stable_sort(candidates.begin(),
+                                         candidates.end(),
+                                         [class_scores](size_t a, size_t b) {
+                                             return class_scores[a] > class_scores[b];
+                                         });
+
+                        std::vector<size_t> kept;
+                        for (size_t candidate : candidates)
+                        {
+                            if (static_cast<int64_t>(kept.size()) >= max_output_boxes_per_class)
+                            {
+                                break;
+                            }
+                            bool suppressed = false;
+                            for (size_t k : kept)
+                            {
+                                if (intersection_over_union(&corners[4 * candidate],
+                                                            &corners[4 * k]) > iou_threshold)
+                                {
+                                    suppressed = true;
+                                    break;
+                                }
+                            }
+                            if (!suppressed)
+                            {
+                                kept.push_back(candidate);
+                                selected.push_back({class_scores[candidate],
+                                                    static_cast<int64_t>(batch),
+                                                    static_cast<int64_t>(class_id),
+                                                    static_cast<int64_t>(candidate)});
+                            }
+                        }
+                    }
+                }
+
+                if (sort_result_descending)
+                {
+                    std::stable_sort(selected.begin(),
+                                     selected.end(),
+                                     [](const SelectedBox& a, const SelectedBox& b) {
+                                         return a.score > b.score;
+                                     });
+                }
+
+                for (size_t row = 0; row < out_shape[0]; row++)
+                {
+                    int64_t* triplet = out + 3 * row;
+                    if (row < selected.size())
+                    {
+                        triplet[0] = selected[row].batch;
+                        triplet[1] = selected[row].class_id;
+                        triplet[2] = selected[row].box;
+                    }
+                    else
+                    {
+                        std::fill(triplet, triplet + 3, -1);
+                    }
+                }
+            }
+        }
+    }
+}
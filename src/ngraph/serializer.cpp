@@ -24,6 +24,7 @@
 #include "ngraph/graph_util.hpp"
 #include "ngraph/ops.hpp"
 #include "ngraph/provenance.hpp"
+#include "ngraph/runtime/constant_loader.hpp"
 #include "ngraph/serializer.hpp"
 #include "ngraph/util.hpp"
 #include "nlohmann/json.hpp"
@@ -85,13 +86,13 @@ static OP_TYPEID get_typeid(const NodeTypeInfo& type_info)
     return rc;
 }
 
-bool has_key(json j, const std::string& key)
+bool has_key(const json& j, const std::string& key)
 {
     return j.count(key) != 0;
 }
 
 template <typename T>
-T get_or_default(json j, const std::string& key, const T& default_value)
+T get_or_default(const json& j, const std::string& key, const T& default_value)
 {
     return has_key(j, key) ? j.at(key).get<T>() : default_value;
 }
@@ -139,13 +140,20 @@ public:
         m_const_data_callback = const_data_callback;
     }
 
+    /// \brief Makes a json parser callback that deserializes the model while it is parsed.
+    ///
+    /// Each op of a function is built as soon as its json is complete and then dropped, and so
+    /// is each function, so the parsed json never holds more than one op. Models that are not
+    /// an array of functions are left to be deserialized from the returned json.
+    /// \param rc Set to the last function deserialized
+    json::parser_callback_t get_streaming_callback(shared_ptr<Function>& rc);
     shared_ptr<Function> deserialize_function(json j);
-    Output<Node> deserialize_output(json j);
-    OutputVector deserialize_output_vector(json j);
-    ParameterVector deserialize_parameter_vector(json j);
-    shared_ptr<Node> deserialize_node_reference(json j);
+    Output<Node> deserialize_output(const json& j);
+    OutputVector deserialize_output_vector(const json& j);
+    ParameterVector deserialize_parameter_vector(const json& j);
+    shared_ptr<Node> deserialize_node_reference(const json& j);
     shared_ptr<Node> deserialize_node(json j);
-    AxisSet deserialize_axis_set(json j);
+    AxisSet deserialize_axis_set(const json& j);
     shared_ptr<op::TensorIterator::InputDescription>
         deserialize_tensor_iterator_input_description(json j);
     shared_ptr<op::TensorIterator::OutputDescription>
@@ -172,7 +180,7 @@ static json write_dimension(Dimension d)
     }
 }
 
-static Dimension read_dimension(json j)
+static Dimension read_dimension(const json& j)
 {
     if (j.is_null())
     {
@@ -201,7 +209,7 @@ static json write_partial_shape(const PartialShape& s)
     }
 }
 
-static PartialShape read_partial_shape(json j)
+static PartialShape read_partial_shape(const json& j)
 {
     if (j.is_null())
     {
@@ -227,7 +235,7 @@ static json write_auto_broadcast(const op::AutoBroadcastSpec& autob)
 }
 
 static op::AutoBroadcastSpec
-    read_auto_broadcast(json js_node,
+    read_auto_broadcast(const json& js_node,
                         const std::string& attr,
                         const op::AutoBroadcastSpec& autob = op::AutoBroadcastSpec())
 {
@@ -243,19 +251,19 @@ static op::AutoBroadcastSpec
     }
 }
 
-static op::PadType read_pad_type(json node_js)
+static op::PadType read_pad_type(const json& node_js)
 {
     return has_key(node_js, "pad_type") ? static_cast<op::PadType>(node_js.at("pad_type"))
                                         : op::PadType::EXPLICIT;
 }
 
-static op::PadMode read_pad_mode(json node_js)
+static op::PadMode read_pad_mode(const json& node_js)
 {
     return has_key(node_js, "pad_mode") ? static_cast<op::PadMode>(node_js.at("pad_mode"))
                                         : op::PadMode::CONSTANT;
 }
 
-static op::RoundingType read_rounding_type(json node_js)
+static op::RoundingType read_rounding_type(const json& node_js)
 {
     return has_key(node_js, "rounding_type")
                ? static_cast<op::RoundingType>(node_js.at("rounding_type"))
@@ -269,7 +277,7 @@ static json write_element_type(const ngraph::element::Type& n)
     return j;
 }
 
-static element::Type read_element_type(json j)
+static element::Type read_element_type(const json& j)
 {
     size_t bitwidth = 0;
     bool is_real = false;
@@ -321,16 +329,16 @@ void ngraph::serialize(ostream& out, shared_ptr<ngraph::Function> func, size_t i
     out << ::serialize(func, indent, false);
 }
 
-#if defined ENABLE_CPIO_FILE
-static void serialize_to_cpio(ostream& out, shared_ptr<ngraph::Function> func, size_t indent)
+void ngraph::serialize_to_cpio(const string& path, shared_ptr<ngraph::Function> func, size_t indent)
 {
+    ofstream out(path, ios_base::binary);
     string j = ::serialize(func, indent, true);
     cpio::Writer writer(out);
     writer.write(func->get_name(), j.c_str(), static_cast<uint32_t>(j.size()));
 
     traverse_nodes(const_cast<Function*>(func.get()),
                    [&](shared_ptr<Node> node) {
-                       if (auto c = node->as_type<op::Constant>())
+                       if (auto c = as_type_ptr<op::Constant>(node))
                        {
                            uint32_t size =
                                static_cast<uint32_t>(shape_size(c->get_output_shape(0)) *
@@ -340,7 +348,6 @@ static void serialize_to_cpio(ostream& out, shared_ptr<ngraph::Function> func, s
                    },
                    true);
 }
-#endif
 
 static string serialize(shared_ptr<Function> func, size_t indent, bool binary_constant_data)
 {
@@ -369,7 +376,25 @@ std::string ngraph::serialize(std::shared_ptr<ngraph::Function> func, size_t ind
     return ::serialize(func, indent, false);
 }
 
-shared_ptr<ngraph::Function> ngraph::deserialize(istream& in)
+static shared_ptr<Function>
+    deserialize_json(JSONDeserializer& deserializer,
+                     const function<json(const json::parser_callback_t&)>& parse)
+{
+    // Ops are validated once, when their function is constructed
+    DeferredValidation deferred;
+    shared_ptr<Function> rc;
+    json js = parse(deserializer.get_streaming_callback(rc));
+    // Only left over if the model was not streamed
+    for (json func : js)
+    {
+        rc = deserializer.deserialize_function(func);
+    }
+    return rc;
+}
+
+// With the path of the file `in` reads from, the data of the Constants of a cpio archive is
+// only loaded from the file when it is first used
+static shared_ptr<Function> deserialize_stream(istream& in, const string& path)
 {
     shared_ptr<Function> rc;
     if (cpio::is_cpio(in))
@@ -379,12 +404,7 @@ shared_ptr<ngraph::Function> ngraph::deserialize(istream& in)
         if (file_info.size() > 0)
         {
             // The first file is the model
-            uint32_t size = static_cast<uint32_t>(file_info[0].get_size());
-            char* data = new char[size];
-            reader.read(file_info[0].get_name(), data, size);
-            string jstr(data, size);
-            delete[] data;
-            json js = json::parse(jstr);
+            vector<char> data = reader.read(file_info[0]);
             JSONDeserializer deserializer;
             deserializer.set_const_data_callback(
                 [&](const string& const_name, const element::Type& et, const Shape& shape) {
@@ -393,6 +413,13 @@ shared_ptr<ngraph::Function> ngraph::deserialize(istream& in)
                     {
                         if (info.get_name() == const_name)
                         {
+                            if (!path.empty())
+                            {
+                                auto loader = make_shared<runtime::FileConstantLoader>(
+                                    path, info.get_offset(), info.get_size());
+                                const_node = make_shared<op::Constant>(et, shape, loader);
+                                break;
+                            }
                             void* const_data = ngraph_malloc(info.get_size());
                             reader.read(const_name, const_data, info.get_size());
                             const_node = make_shared<op::Constant>(et, shape, const_data);
@@ -402,22 +429,27 @@ shared_ptr<ngraph::Function> ngraph::deserialize(istream& in)
                     }
                     return const_node;
                 });
-            for (json func : js)
-            {
-                rc = deserializer.deserialize_function(func);
-            }
+            rc = deserialize_json(deserializer, [&](const json::parser_callback_t& callback) {
+                return json::parse(data.begin(), data.end(), callback);
+            });
         }
     }
     else
     {
         // json file?
-        std::stringstream ss;
-        ss << in.rdbuf();
-        rc = deserialize(ss.str());
+        JSONDeserializer deserializer;
+        rc = deserialize_json(deserializer, [&](const json::parser_callback_t& callback) {
+            return json::parse(in, callback);
+        });
     }
     return rc;
 }
 
+shared_ptr<ngraph::Function> ngraph::deserialize(istream& in)
+{
+    return deserialize_stream(in, "");
+}
+
 shared_ptr<ngraph::Function> ngraph::deserialize(const string& s)
 {
     shared_ptr<Function> rc;
@@ -425,16 +457,14 @@ shared_ptr<ngraph::Function> ngraph::deserialize(const string& s)
     {
         // s is a file and not a json string
         ifstream in(s, ios_base::binary | ios_base::in);
-        rc = deserialize(in);
+        rc = deserialize_stream(in, s);
     }
     else
     {
-        json js = json::parse(s);
         JSONDeserializer deserializer;
-        for (json func : js)
-        {
-            rc = deserializer.deserialize_function(func);
-        }
+        rc = deserialize_json(deserializer, [&](const json::parser_callback_t& callback) {
+            return json::parse(s, callback);
+        });
     }
     return rc;
 }
@@ -465,7 +495,7 @@ json JSONSerializer::serialize_function(const Function& f)
 }
 
 template <typename T>
-T get_value(json js, const string& key)
+T get_value(const json& js, const string& key)
 {
     T rc = {};
     auto it = js.find(key);
@@ -476,13 +506,13 @@ T get_value(json js, const string& key)
     return rc;
 }
 
-shared_ptr<Node> JSONDeserializer::deserialize_node_reference(json j)
+shared_ptr<Node> JSONDeserializer::deserialize_node_reference(const json& j)
 {
     const string& name = j;
     return m_node_map.at(name);
 }
 
-Output<Node> JSONDeserializer::deserialize_output(json j)
+Output<Node> JSONDeserializer::deserialize_output(const json& j)
 {
     size_t index;
     json json_node_reference;
@@ -493,8 +523,8 @@ Output<Node> JSONDeserializer::deserialize_output(json j)
     }
     else if (j.is_object())
     {
-        json_node_reference = j["node"];
-        index = j["index"];
+        json_node_reference = j.at("node");
+        index = j.at("index");
     }
     else
     {
@@ -503,7 +533,7 @@ Output<Node> JSONDeserializer::deserialize_output(json j)
     return Output<Node>(deserialize_node_reference(json_node_reference), index);
 }
 
-OutputVector JSONDeserializer::deserialize_output_vector(json j)
+OutputVector JSONDeserializer::deserialize_output_vector(const json& j)
 {
     OutputVector result;
     if (j.is_array())
@@ -521,7 +551,7 @@ json JSONSerializer::serialize_axis_set(const AxisSet& axis_set)
     return static_cast<set<size_t>>(axis_set);
 }
 
-AxisSet JSONDeserializer::deserialize_axis_set(json j)
+AxisSet JSONDeserializer::deserialize_axis_set(const json& j)
 {
     AxisSet result;
     if (j.is_array())
@@ -669,7 +699,7 @@ std::shared_ptr<op::TensorIterator::OutputDescription>
     return result;
 }
 
-ParameterVector JSONDeserializer::deserialize_parameter_vector(json json_parameters)
+ParameterVector JSONDeserializer::deserialize_parameter_vector(const json& json_parameters)
 {
     std::vector<std::shared_ptr<op::Parameter>> params;
     for (auto& param_ref : json_parameters)
@@ -679,6 +709,52 @@ ParameterVector JSONDeserializer::deserialize_parameter_vector(json json_paramet
     return params;
 }
 
+json::parser_callback_t JSONDeserializer::get_streaming_callback(shared_ptr<Function>& rc)
+{
+    // Depth 0 is the array of functions, 1 a function, 2 its members and 3 the ops
+    struct StreamState
+    {
+        bool is_function_array = false;
+        bool in_ops = false;
+    };
+    auto state = make_shared<StreamState>();
+    return [this, &rc, state](int depth, json::parse_event_t event, json& parsed) {
+        bool keep = true;
+        switch (event)
+        {
+        case json::parse_event_t::array_start:
+            if (depth == 0)
+            {
+                state->is_function_array = true;
+            }
+            break;
+        case json::parse_event_t::key:
+            if (depth == 2)
+            {
+                state->in_ops = parsed == "ops";
+            }
+            break;
+        case json::parse_event_t::object_end:
+            if (state->is_function_array && depth == 3 && state->in_ops)
+            {
+                deserialize_node(move(parsed));
+                keep = false;
+            }
+            else if (state->is_function_array && depth == 1)
+            {
+                rc = deserialize_function(move(parsed));
+                state->in_ops = false;
+                keep = false;
+            }
+            break;
+        case json::parse_event_t::object_start:
+        case json::parse_event_t::array_end:
+        case json::parse_event_t::value: break;
+        }
+        return keep;
+    };
+}
+
 shared_ptr<Function> JSONDeserializer::deserialize_function(json func_js)
 {
     string func_name = func_js.at("name").get<string>();
@@ -1047,6 +1123,15 @@ shared_ptr<Node> JSONDeserializer::deserialize_node(json node_js)
                 has_key(node_js, "element_type") ? node_js : node_js.at("value_type");
             auto element_type = read_element_type(type_node_js.at("element_type"));
             auto shape = type_node_js.at("shape");
+            if (!has_key(node_js, "value") && m_const_data_callback)
+            {
+                node = m_const_data_callback(node_name, element_type, shape);
+                if (!node)
+                {
+                    throw ngraph_error("No data for constant '" + node_name + "'");
+                }
+                break;
+            }
             auto value = node_js.at("value").get<vector<string>>();
             node = make_shared<op::Constant>(element_type, shape, value);
             break;
@@ -3338,15 +3423,19 @@ json JSONSerializer::serialize_node(const Node& n)
     case OP_TYPEID::Constant:
     {
         auto tmp = static_cast<const op::Constant*>(&n);
-        if (tmp->get_all_data_elements_bitwise_identical() && shape_size(tmp->get_shape()) > 0)
-        {
-            vector<string> vs;
-            vs.push_back(tmp->convert_value_to_string(0));
-            node["value"] = vs;
-        }
-        else
+        // Binary data is written as a record of the archive named after the node
+        if (!m_binary_constant_data)
         {
-            node["value"] = tmp->get_value_strings();
+            if (tmp->get_all_data_elements_bitwise_identical() && shape_size(tmp->get_shape()) > 0)
+            {
+                vector<string> vs;
+                vs.push_back(tmp->convert_value_to_string(0));
+                node["value"] = vs;
+            }
+            else
+            {
+                node["value"] = tmp->get_value_strings();
+            }
         }
         node["shape"] = tmp->get_shape();
         node["element_type"] = write_element_type(tmp->get_element_type());
@@ -48,6 +48,18 @@ namespace ngraph
     ///    indent level specified.
     void serialize(std::ostream& out, std::shared_ptr<ngraph::Function> func, size_t indent = 0);
 
+    /// \brief Serialize a Function to a cpio archive holding the json and, as separate
+    ///        records, the data of the Constants
+    ///
+    /// Deserializing the archive from its path only reads the data of a Constant when it is
+    /// first used.
+    /// \param path The path to the output file
+    /// \param func The Function to serialize
+    /// \param indent The indent level of the json, as for serialize
+    void serialize_to_cpio(const std::string& path,
+                           std::shared_ptr<ngraph::Function> func,
+                           size_t indent = 0);
+
     /// \brief Deserialize a Function
     /// \param in An isteam to the input data
     std::shared_ptr<ngraph::Function> deserialize(std::istream& in);
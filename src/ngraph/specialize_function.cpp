@@ -21,6 +21,15 @@
 
 using namespace ngraph;
 
+// Copies through a const reference so nodes without runtime info do not allocate any
+static void copy_rt_info(const Node& from, Node& to)
+{
+    if (!from.get_rt_info().empty())
+    {
+        to.get_rt_info() = from.get_rt_info();
+    }
+}
+
 std::shared_ptr<Function>
     ngraph::specialize_function(std::shared_ptr<Function> f,
                                 const std::vector<element::Type>& parameter_element_types,
@@ -61,7 +70,7 @@ std::shared_ptr<Function>
             m[f->get_parameters()[i].get()] =
                 std::make_shared<op::Parameter>(parameter_element_types[i], parameter_shapes[i]);
         }
-        m[f->get_parameters()[i].get()]->get_rt_info() = f->get_parameters()[i]->get_rt_info();
+        copy_rt_info(*f->get_parameters()[i], *m[f->get_parameters()[i].get()]);
     }
 
     for (auto old_node : f->get_ordered_ops())
@@ -90,7 +99,7 @@ std::shared_ptr<Function>
             {
                 m[old_node.get()]->validate_and_infer_types();
             }
-            m[old_node.get()]->get_rt_info() = old_node->get_rt_info();
+            copy_rt_info(*old_node, *m[old_node.get()]);
         }
 
         m[old_node.get()]->set_friendly_name(old_node->get_friendly_name());
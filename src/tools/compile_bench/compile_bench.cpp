@@ -0,0 +1,294 @@
+//*****************************************************************************
+// Copyright 2017-2019 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+// Compile-time benchmark. Deserializes every model in a directory (for example test/models),
+// compiles it on the given backend and reports the profile of every pass the backend ran,
+// as collected by pass::CompileProfiler. Per-pass times are the minimum over all repetitions.
+// On Linux the resident memory before compiling and its peak during compilation are reported
+// as well, which shows how much transient memory, such as cloned weights, compiling needs. The
+// peak while deserializing is reported separately.
+//
+// $ compile_bench -d test/models -b CPU -r 5 > compile_profile.csv
+
+#include <algorithm>
+#include <fstream>
+#include <iostream>
+
+#include "ngraph/file_util.hpp"
+#include "ngraph/pass/pass_profile.hpp"
+#include "ngraph/runtime/backend.hpp"
+#include "ngraph/runtime/backend_manager.hpp"
+#include "ngraph/runtime/interpreter/int_backend.hpp"
+#include "ngraph/serializer.hpp"
+#include "ngraph/util.hpp"
+
+using namespace std;
+using namespace ngraph;
+
+static void configure_static_backends()
+{
+#ifdef NGRAPH_INTERPRETER_STATIC_LIB_ENABLE
+    ngraph::runtime::BackendManager::register_backend(
+        "INTERPRETER", ngraph::runtime::interpreter::get_backend_constructor_pointer());
+#endif
+}
+
+struct CompileResult
+{
+    size_t deserialize_microseconds = 0;
+    size_t deserialize_peak_resident_kb = 0;
+    size_t compile_microseconds = 0;
+    size_t nodes = 0;
+    size_t resident_kb = 0;
+    size_t peak_resident_kb = 0;
+    vector<pass::PassProfile> passes;
+};
+
+/// \brief Reads a field, in kB, from /proc/self/status
+static size_t read_status_kb(const string& field)
+{
+    size_t rc = 0;
+    ifstream status("/proc/self/status");
+    string line;
+    while (getline(status, line))
+    {
+        if (line.compare(0, field.size(), field) == 0 && line[field.size()] == ':')
+        {
+            rc = strtoul(line.c_str() + field.size() + 1, nullptr, 10);
+            break;
+        }
+    }
+    return rc;
+}
+
+/// \brief Resets the peak resident memory (VmHWM) to the current resident memory. Needs
+///        Linux 4.0 or later, on other systems the peak is that of the whole process.
+static void reset_peak_resident()
+{
+    ofstream clear_refs("/proc/self/clear_refs");
+    clear_refs << "5";
+}
+
+static CompileResult compile_model(const string& model, const string& backend_name)
+{
+    CompileResult result;
+    stopwatch timer;
+
+    reset_peak_resident();
+    timer.start();
+    shared_ptr<Function> f = deserialize(model);
+    timer.stop();
+    result.deserialize_microseconds = timer.get_microseconds();
+    result.deserialize_peak_resident_kb = read_status_kb("VmHWM");
+    result.nodes = f->get_ops().size();
+
+    auto backend = runtime::Backend::create(backend_name);
+    pass::CompileProfiler profiler;
+    reset_peak_resident();
+    result.resident_kb = read_status_kb("VmRSS");
+    timer.start();
+    backend->compile(f);
+    timer.stop();
+    result.compile_microseconds = timer.get_microseconds();
+    result.peak_resident_kb = read_status_kb("VmHWM");
+    result.passes = profiler.get_pass_profiles();
+    return result;
+}
+
+/// Keeps the fastest time seen for each pass and the highest memory peak. Pass pipelines are
+/// deterministic so the passes line up between repetitions; the counters are identical on every
+/// run.
+static void merge_min(CompileResult& best, const CompileResult& current)
+{
+    best.deserialize_microseconds =
+        min(best.deserialize_microseconds, current.deserialize_microseconds);
+    best.deserialize_peak_resident_kb =
+        max(best.deserialize_peak_resident_kb, current.deserialize_peak_resident_kb);
+    best.compile_microseconds = min(best.compile_microseconds, current.compile_microseconds);
+    best.peak_resident_kb = max(best.peak_resident_kb, current.peak_resident_kb);
+    for (size_t i = 0; i < best.passes.size() && i < current.passes.size(); i++)
+    {
+        best.passes[i].microseconds =
+            min(best.passes[i].microseconds, current.passes[i].microseconds);
+    }
+}
+
+int main(int argc, char** argv)
+{
+    string model_arg;
+    string directory;
+    string backend = "CPU";
+    string output_file;
+    size_t repetitions = 3;
+    bool summary_only = false;
+    bool failed = false;
+
+    configure_static_backends();
+    for (int i = 1; i < argc; i++)
+    {
+        string arg = argv[i];
+        bool has_value = i + 1 < argc;
+        if ((arg == "-f" || arg == "--file") && has_value)
+        {
+            model_arg = argv[++i];
+        }
+        else if ((arg == "-d" || arg == "--directory") && has_value)
+        {
+            directory = argv[++i];
+        }
+        else if ((arg == "-b" || arg == "--backend") && has_value)
+        {
+            backend = argv[++i];
+        }
+        else if ((arg == "-r" || arg == "--repetitions") && has_value)
+        {
+            repetitions = max<size_t>(1, strtoul(argv[++i], nullptr, 10));
+        }
+        else if ((arg == "-o" || arg == "--output") && has_value)
+        {
+            output_file = argv[++i];
+        }
+        else if (arg == "--summary")
+        {
+            summary_only = true;
+        }
+        else
+        {
+            cout << "Unknown option: " << arg << endl;
+            failed = true;
+        }
+    }
+    if (!model_arg.empty() && !file_util::exists(model_arg))
+    {
+        cout << "File " << model_arg << " not found\n";
+        failed = true;
+    }
+    else if (!directory.empty() && !file_util::exists(directory))
+    {
+        cout << "Directory " << directory << " not found\n";
+        failed = true;
+    }
+    else if (directory.empty() && model_arg.empty())
+    {
+        cout << "Either file or directory must be specified\n";
+        failed = true;
+    }
+
+    if (failed)
+    {
+        cout << R"###(
+DESCRIPTION
+    Profile the compile time of nGraph JSON models on a backend, pass by pass.
+
+SYNOPSIS
+        compile_bench [-f <filename>] [-d <directory>] [-b <backend>] [-r <repetitions>]
+
+OPTIONS
+        -f|--file                 Serialized model file
+        -d|--directory            Directory to scan for models. All .json models are compiled.
+        -b|--backend              Backend to use (default: CPU)
+        -r|--repetitions          Compiles per model, the fastest time is reported (default: 3)
+        -o|--output               Write CSV results to a file instead of stdout
+        --summary                 Only report one line per model
+)###";
+        return 1;
+    }
+
+    vector<string> models;
+    if (!directory.empty())
+    {
+        file_util::iterate_files(directory,
+                                 [&](const string& file, bool is_dir) {
+                                     if (!is_dir && file_util::get_file_ext(file) == ".json")
+                                     {
+                                         models.push_back(file);
+                                     }
+                                 },
+                                 true);
+        sort(models.begin(), models.end());
+    }
+    else
+    {
+        models.push_back(model_arg);
+    }
+
+    ofstream file_out;
+    if (!output_file.empty())
+    {
+        file_out.open(output_file);
+        if (!file_out)
+        {
+            cout << "Failed to open " << output_file << endl;
+            return 1;
+        }
+    }
+    ostream& out = output_file.empty() ? cout : file_out;
+
+    out << "model,backend,nodes,deserialize_us,deserialize_peak_rss_kb,compile_us,passes_us,rss_kb,"
+           "peak_rss_kb";
+    if (!summary_only)
+    {
+        out << ",";
+        pass::PassProfile::write_csv_header(out);
+    }
+    else
+    {
+        out << "\n";
+    }
+
+    int rc = 0;
+    for (const string& model : models)
+    {
+        try
+        {
+            CompileResult best = compile_model(model, backend);
+            for (size_t i = 1; i < repetitions; i++)
+            {
+                merge_min(best, compile_model(model, backend));
+            }
+            size_t passes_microseconds = 0;
+            for (const pass::PassProfile& p : best.passes)
+            {
+                passes_microseconds += p.microseconds;
+            }
+
+            string prefix = model + "," + backend + "," + to_string(best.nodes) + "," +
+                            to_string(best.deserialize_microseconds) + "," +
+                            to_string(best.deserialize_peak_resident_kb) + "," +
+                            to_string(best.compile_microseconds) + "," +
+                            to_string(passes_microseconds) + "," + to_string(best.resident_kb) +
+                            "," + to_string(best.peak_resident_kb);
+            if (summary_only)
+            {
+                out << prefix << "\n";
+            }
+            else
+            {
+                for (const pass::PassProfile& p : best.passes)
+                {
+                    out << prefix << ",";
+                    p.write_csv(out);
+                }
+            }
+        }
+        catch (const exception& e)
+        {
+            cerr << "Failed to compile " << model << ": " << e.what() << endl;
+            rc = 1;
+        }
+    }
+    return rc;
+}
@@ -0,0 +1,175 @@
+//*****************************************************************************
+// Copyright 2017-2019 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+// Graph construction benchmark. Builds a synthetic graph of the requested size, clones it and
+// destroys both, reporting the time of each step and the memory the graph occupies. The graph
+// is a stack of layers of Dot, Add and Relu ops fed by Constants, similar to an MLP. With -d,
+// the graph is built in a DeferredValidation scope and validated once by its Function.
+//
+// $ graph_bench -n 100000 -r 3
+
+#include <algorithm>
+#include <fstream>
+#include <iostream>
+
+#include "ngraph/graph_util.hpp"
+#include "ngraph/ngraph.hpp"
+#include "ngraph/util.hpp"
+
+using namespace std;
+using namespace ngraph;
+
+/// \return Resident set size of the process in bytes, or 0 if it is unknown
+static size_t get_resident_bytes()
+{
+    size_t rc = 0;
+#ifdef __linux__
+    ifstream statm("/proc/self/statm");
+    size_t pages;
+    size_t resident;
+    if (statm >> pages >> resident)
+    {
+        rc = resident * 4096;
+    }
+#endif
+    return rc;
+}
+
+static shared_ptr<Function> build_graph(size_t node_count)
+{
+    const size_t width = 4;
+    auto input = make_shared<op::Parameter>(element::f32, Shape{1, width});
+    Output<Node> value = input;
+    // Each layer adds five nodes
+    for (size_t i = 0; i + 5 <= node_count; i += 5)
+    {
+        auto weights = op::Constant::create(element::f32, Shape{width, width}, {0.5f});
+        auto bias = op::Constant::create(element::f32, Shape{1, width}, {0.1f});
+        auto dot = make_shared<op::Dot>(value, weights);
+        auto add = make_shared<op::Add>(dot, bias);
+        value = make_shared<op::Relu>(add);
+    }
+    return make_shared<Function>(OutputVector{value}, ParameterVector{input});
+}
+
+struct GraphResult
+{
+    size_t build_microseconds = 0;
+    size_t clone_microseconds = 0;
+    size_t destroy_microseconds = 0;
+    size_t nodes = 0;
+    size_t graph_bytes = 0;
+};
+
+static GraphResult run(size_t node_count, bool deferred)
+{
+    GraphResult result;
+    stopwatch timer;
+    size_t resident_before = get_resident_bytes();
+
+    timer.start();
+    shared_ptr<Function> f;
+    if (deferred)
+    {
+        DeferredValidation deferred_validation;
+        f = build_graph(node_count);
+    }
+    else
+    {
+        f = build_graph(node_count);
+    }
+    timer.stop();
+    result.build_microseconds = timer.get_microseconds();
+    size_t resident_after = get_resident_bytes();
+    result.graph_bytes = resident_after > resident_before ? resident_after - resident_before : 0;
+    result.nodes = f->get_ops().size();
+
+    timer.start();
+    shared_ptr<Function> g = clone_function(*f);
+    timer.stop();
+    result.clone_microseconds = timer.get_microseconds();
+
+    timer.start();
+    g = nullptr;
+    f = nullptr;
+    timer.stop();
+    result.destroy_microseconds = timer.get_microseconds();
+    return result;
+}
+
+int main(int argc, char** argv)
+{
+    size_t node_count = 100000;
+    size_t repetitions = 3;
+    bool deferred = false;
+    bool failed = false;
+
+    for (int i = 1; i < argc; i++)
+    {
+        string arg = argv[i];
+        bool has_value = i + 1 < argc;
+        if ((arg == "-n" || arg == "--nodes") && has_value)
+        {
+            node_count = strtoul(argv[++i], nullptr, 10);
+        }
+        else if ((arg == "-r" || arg == "--repetitions") && has_value)
+        {
+            repetitions = max<size_t>(1, strtoul(argv[++i], nullptr, 10));
+        }
+        else if (arg == "-d" || arg == "--deferred")
+        {
+            deferred = true;
+        }
+        else
+        {
+            cout << "Unknown option: " << arg << endl;
+            failed = true;
+        }
+    }
+
+    if (failed)
+    {
+        cout << R"###(
+DESCRIPTION
+    Measure the time and memory needed to build, clone and destroy a large graph.
+
+SYNOPSIS
+        graph_bench [-n <nodes>] [-r <repetitions>] [-d]
+
+OPTIONS
+        -n|--nodes                Approximate number of nodes in the graph (default: 100000)
+        -r|--repetitions          Number of runs, the fastest time is reported (default: 3)
+        -d|--deferred             Defer validation while the graph is built
+)###";
+        return 1;
+    }
+
+    GraphResult best = run(node_count, deferred);
+    for (size_t i = 1; i < repetitions; i++)
+    {
+        GraphResult current = run(node_count, deferred);
+        best.build_microseconds = min(best.build_microseconds, current.build_microseconds);
+        best.clone_microseconds = min(best.clone_microseconds, current.clone_microseconds);
+        best.destroy_microseconds = min(best.destroy_microseconds, current.destroy_microseconds);
+    }
+
+    // Memory is measured on the first run only, later runs mostly reuse the freed heap
+    cout << "nodes,build_us,clone_us,destroy_us,graph_bytes,bytes_per_node,sizeof_node\n";
+    cout << best.nodes << "," << best.build_microseconds << "," << best.clone_microseconds << ","
+         << best.destroy_microseconds << "," << best.graph_bytes << ","
+         << best.graph_bytes / max<size_t>(1, best.nodes) << "," << sizeof(op::Add) << "\n";
+    return 0;
+}
@@ -0,0 +1,170 @@
+//*****************************************************************************
+// Copyright 2017-2019 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+// Memory planner benchmark. Deserializes every model in a directory (for example test/models)
+// and plans its temporary memory pool with each pass::MemoryPlanner strategy, reporting the
+// pool size against the lower bound, the most memory that is ever live at once. With -i, the
+// InPlaceElementwise pass runs first so elementwise ops may overwrite their dying inputs.
+//
+// $ memory_bench -d test/models > memory_plan.csv
+
+#include <algorithm>
+#include <iostream>
+
+#include "ngraph/file_util.hpp"
+#include "ngraph/pass/in_place_elementwise.hpp"
+#include "ngraph/pass/liveness.hpp"
+#include "ngraph/pass/manager.hpp"
+#include "ngraph/pass/memory_layout.hpp"
+#include "ngraph/serializer.hpp"
+#include "ngraph/util.hpp"
+
+using namespace std;
+using namespace ngraph;
+
+int main(int argc, char** argv)
+{
+    string model_arg;
+    string directory;
+    size_t alignment = 64;
+    bool in_place = false;
+    bool failed = false;
+
+    for (int i = 1; i < argc; i++)
+    {
+        string arg = argv[i];
+        bool has_value = i + 1 < argc;
+        if ((arg == "-f" || arg == "--file") && has_value)
+        {
+            model_arg = argv[++i];
+        }
+        else if ((arg == "-d" || arg == "--directory") && has_value)
+        {
+            directory = argv[++i];
+        }
+        else if ((arg == "-a" || arg == "--alignment") && has_value)
+        {
+            alignment = max<size_t>(1, strtoul(argv[++i], nullptr, 10));
+        }
+        else if (arg == "-i" || arg == "--in-place")
+        {
+            in_place = true;
+        }
+        else
+        {
+            cout << "Unknown option: " << arg << endl;
+            failed = true;
+        }
+    }
+    if (!model_arg.empty() && !file_util::exists(model_arg))
+    {
+        cout << "File " << model_arg << " not found\n";
+        failed = true;
+    }
+    else if (!directory.empty() && !file_util::exists(directory))
+    {
+        cout << "Directory " << directory << " not found\n";
+        failed = true;
+    }
+    else if (directory.empty() && model_arg.empty())
+    {
+        cout << "Either file or directory must be specified\n";
+        failed = true;
+    }
+
+    if (failed)
+    {
+        cout << R"###(
+DESCRIPTION
+    Compare the memory planner strategies on nGraph JSON models.
+
+SYNOPSIS
+        memory_bench [-f <filename>] [-d <directory>] [-a <alignment>] [-i]
+
+OPTIONS
+        -f|--file                 Serialized model file
+        -d|--directory            Directory to scan for models. All .json models are planned.
+        -a|--alignment            Buffer alignment in bytes (default: 64)
+        -i|--in-place             Let elementwise ops overwrite inputs that die at the op
+)###";
+        return 1;
+    }
+
+    vector<string> models;
+    if (!directory.empty())
+    {
+        file_util::iterate_files(directory,
+                                 [&](const string& file, bool is_dir) {
+                                     if (!is_dir && file_util::get_file_ext(file) == ".json")
+                                     {
+                                         models.push_back(file);
+                                     }
+                                 },
+                                 true);
+        sort(models.begin(), models.end());
+    }
+    else
+    {
+        models.push_back(model_arg);
+    }
+
+    const vector<pass::MemoryPlanner::strategy> strategies{
+        pass::MemoryPlanner::strategy::FIRST_FIT,
+        pass::MemoryPlanner::strategy::GREEDY_BY_SIZE,
+        pass::MemoryPlanner::strategy::GREEDY_BY_LIFETIME,
+        pass::MemoryPlanner::strategy::BEST};
+
+    cout << "model,nodes,strategy,pool_bytes,lower_bound_bytes,overhead_percent,plan_us\n";
+    int rc = 0;
+    for (const string& model : models)
+    {
+        try
+        {
+            shared_ptr<Function> f = deserialize(model);
+            pass::Manager liveness;
+            if (in_place)
+            {
+                liveness.register_pass<pass::InPlaceElementwise>();
+            }
+            liveness.register_pass<pass::Liveness>();
+            liveness.run_passes(f);
+            for (pass::MemoryPlanner::strategy s : strategies)
+            {
+                pass::MemoryLayout layout(alignment);
+                layout.set_strategy(s);
+                stopwatch timer;
+                timer.start();
+                layout.run_on_function(f);
+                timer.stop();
+                size_t lower_bound = layout.get_lower_bound();
+                double overhead =
+                    lower_bound == 0
+                        ? 0
+                        : 100.0 * (layout.get_max_allocated() - lower_bound) / lower_bound;
+                cout << model << "," << f->get_ops().size() << ","
+                     << pass::MemoryPlanner::get_strategy_name(s) << ","
+                     << layout.get_max_allocated() << "," << lower_bound << "," << overhead
+                     << "," << timer.get_microseconds() << "\n";
+            }
+        }
+        catch (const exception& e)
+        {
+            cerr << "Failed to plan " << model << ": " << e.what() << endl;
+            rc = 1;
+        }
+    }
+    return rc;
+}
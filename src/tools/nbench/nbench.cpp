@@ -41,6 +41,7 @@
 #include "ngraph/pass/visualize_tree.hpp"
 #include "ngraph/runtime/backend.hpp"
 #include "ngraph/runtime/backend_manager.hpp"
+#include "ngraph/runtime/constant_loader.hpp"
 #include "ngraph/runtime/interpreter/int_backend.hpp"
 #include "ngraph/serializer.hpp"
 #include "ngraph/util.hpp"
@@ -421,6 +422,7 @@ OPTIONS
             if (!backend.empty())
             {
                 cout << "\n---- Benchmark ----\n";
+                runtime::ConstantLoader::reset_stats();
                 shared_ptr<Function> f = deserialize(model);
                 vector<runtime::PerformanceCounter> perf_data;
                 if (double_buffer)
@@ -433,6 +435,14 @@ OPTIONS
                     perf_data = run_benchmark(
                         f, backend, iterations, timing_detail, warmup_iterations, copy_data);
                 }
+                auto load_stats = runtime::ConstantLoader::get_stats();
+                if (load_stats.constants_declared > 0)
+                {
+                    cout << "Constant data loaded: " << locale_string(load_stats.bytes_loaded)
+                         << " of " << locale_string(load_stats.bytes_declared) << " bytes in "
+                         << load_stats.constants_loaded << " of "
+                         << load_stats.constants_declared << " constants\n";
+                }
                 auto perf_shape = to_perf_shape(f, perf_data);
                 aggregate_perf_data.insert(
                     aggregate_perf_data.end(), perf_shape.begin(), perf_shape.end());
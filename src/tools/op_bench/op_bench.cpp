@@ -0,0 +1,529 @@
+//*****************************************************************************
+// Copyright 2017-2019 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+// Per-op micro-benchmark. Every case builds a Function holding a single op, compiles it on each
+// requested backend and reports the time per call together with the derived ns/element, GB/s
+// and GFLOP/s figures. The output is CSV or JSON so that results can be diffed between releases.
+//
+// $ op_bench -b INTERPRETER,CPU,CPU:codegen -t f32,i32 --op Add,Dot --format json
+
+#include <cstdlib>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <set>
+
+#include "../nbench/benchmark_utils.hpp"
+#include "ngraph/runtime/backend.hpp"
+#include "ngraph/runtime/backend_manager.hpp"
+#include "ngraph/runtime/interpreter/int_backend.hpp"
+#include "ngraph/util.hpp"
+#include "op_bench_cases.hpp"
+
+using namespace std;
+using namespace ngraph;
+
+static void configure_static_backends()
+{
+#ifdef NGRAPH_INTERPRETER_STATIC_LIB_ENABLE
+    ngraph::runtime::BackendManager::register_backend(
+        "INTERPRETER", ngraph::runtime::interpreter::get_backend_constructor_pointer());
+#endif
+}
+
+struct OpBenchResult
+{
+    string backend;
+    string op;
+    string config;
+    string element_type;
+    size_t elements;
+    size_t bytes;
+    size_t iterations;
+    double ns_per_call;
+    double ns_per_element;
+    double gbps;
+    double gflops;
+    string error;
+};
+
+static void init_tensor(shared_ptr<runtime::Tensor> tensor, pair<double, double> range)
+{
+    switch (tensor->get_element_type())
+    {
+    case element::Type_t::boolean:
+        init_int_tensor<char>(tensor, 0, 1);
+        break;
+    case element::Type_t::f32:
+        init_real_tensor<float>(tensor, range.first, range.second);
+        break;
+    case element::Type_t::f64:
+        init_real_tensor<double>(tensor, range.first, range.second);
+        break;
+    case element::Type_t::i8:
+        init_int_tensor<int8_t>(tensor, range.first, range.second);
+        break;
+    case element::Type_t::i16:
+        init_int_tensor<int16_t>(tensor, range.first, range.second);
+        break;
+    case element::Type_t::i32:
+        init_int_tensor<int32_t>(tensor, range.first, range.second);
+        break;
+    case element::Type_t::i64:
+        init_int_tensor<int64_t>(tensor, range.first, range.second);
+        break;
+    case element::Type_t::u8:
+        init_int_tensor<uint8_t>(tensor, max(0.0, range.first), range.second);
+        break;
+    case element::Type_t::u16:
+        init_int_tensor<uint16_t>(tensor, max(0.0, range.first), range.second);
+        break;
+    case element::Type_t::u32:
+        init_int_tensor<uint32_t>(tensor, max(0.0, range.first), range.second);
+        break;
+    case element::Type_t::u64:
+        init_int_tensor<uint64_t>(tensor, max(0.0, range.first), range.second);
+        break;
+    default: random_init(tensor); break;
+    }
+}
+
+/// \brief Selects the CPU code generator for names of the form "CPU:codegen". The CPU backend
+///        reads NGRAPH_CODEGEN when a Function is compiled, so the variable only needs to be set
+///        around compile().
+class CodegenScope
+{
+public:
+    CodegenScope(const string& backend_name)
+        : m_enabled(backend_name == "CPU:codegen")
+    {
+        if (m_enabled)
+        {
+            const char* old = getenv("NGRAPH_CODEGEN");
+            m_had_old = old != nullptr;
+            m_old = m_had_old ? old : "";
+            setenv("NGRAPH_CODEGEN", "1", 1);
+        }
+    }
+    ~CodegenScope()
+    {
+        if (m_enabled)
+        {
+            if (m_had_old)
+            {
+                setenv("NGRAPH_CODEGEN", m_old.c_str(), 1);
+            }
+            else
+            {
+                unsetenv("NGRAPH_CODEGEN");
+            }
+        }
+    }
+
+private:
+    bool m_enabled;
+    bool m_had_old = false;
+    string m_old;
+};
+
+static OpBenchResult run_case(const OpBenchCase& bench_case,
+                              const string& backend_name,
+                              shared_ptr<runtime::Backend> backend,
+                              size_t iterations,
+                              size_t warmup_iterations,
+                              double min_milliseconds)
+{
+    OpBenchResult result;
+    result.backend = backend_name;
+    result.op = bench_case.op;
+    result.config = bench_case.config;
+    result.element_type = bench_case.element_type.c_type_string();
+    result.elements = 0;
+    result.bytes = 0;
+    result.iterations = 0;
+    result.ns_per_call = 0;
+    result.ns_per_element = 0;
+    result.gbps = 0;
+    result.gflops = 0;
+
+    try
+    {
+        shared_ptr<Function> f = bench_case.make_function();
+
+        vector<shared_ptr<runtime::Tensor>> args;
+        size_t input_index = 0;
+        for (const shared_ptr<op::Parameter>& param : f->get_parameters())
+        {
+            auto tensor = backend->create_tensor(param->get_element_type(), param->get_shape());
+            pair<double, double> range{-1, 1};
+            if (input_index < bench_case.input_ranges.size())
+            {
+                range = bench_case.input_ranges[input_index];
+            }
+            init_tensor(tensor, range);
+            result.bytes += tensor->get_size_in_bytes();
+            args.push_back(tensor);
+            input_index++;
+        }
+
+        vector<shared_ptr<runtime::Tensor>> results;
+        for (const shared_ptr<op::Result>& out : f->get_results())
+        {
+            auto tensor = backend->create_tensor(out->get_element_type(), out->get_shape());
+            result.bytes += tensor->get_size_in_bytes();
+            result.elements += tensor->get_element_count();
+            results.push_back(tensor);
+        }
+
+        shared_ptr<runtime::Executable> exec;
+        {
+            CodegenScope codegen(backend_name);
+            exec = backend->compile(f);
+        }
+
+        for (size_t i = 0; i < warmup_iterations; i++)
+        {
+            exec->call(results, args);
+        }
+
+        // Run at least `iterations` calls and keep going until min_milliseconds have elapsed so
+        // that very small kernels are not dominated by timer resolution.
+        stopwatch timer;
+        timer.start();
+        size_t count = 0;
+        do
+        {
+            exec->call(results, args);
+            count++;
+        } while (count < iterations || timer.get_nanoseconds() < min_milliseconds * 1e6);
+        timer.stop();
+
+        double ns = static_cast<double>(timer.get_nanoseconds()) / count;
+        result.iterations = count;
+        result.ns_per_call = ns;
+        result.ns_per_element = result.elements > 0 ? ns / result.elements : 0;
+        // bytes per nanosecond is GB/s, flops per nanosecond is GFLOP/s
+        result.gbps = result.bytes / ns;
+        result.gflops = bench_case.flops / ns;
+    }
+    catch (const exception& e)
+    {
+        result.error = e.what();
+    }
+    return result;
+}
+
+static string escape_json(const string& s)
+{
+    string rc;
+    for (char c : s)
+    {
+        switch (c)
+        {
+        case '"': rc += "\\\""; break;
+        case '\\': rc += "\\\\"; break;
+        case '\n': rc += "\\n"; break;
+        default: rc += c; break;
+        }
+    }
+    return rc;
+}
+
+static string escape_csv(const string& s)
+{
+    string rc = "\"";
+    for (char c : s)
+    {
+        rc += c;
+        if (c == '"')
+        {
+            rc += '"';
+        }
+    }
+    return rc + "\"";
+}
+
+static void write_csv_header(ostream& out)
+{
+    out << "backend,op,config,element_type,elements,bytes,iterations,ns_per_call,ns_per_element,"
+           "gbps,gflops,error\n";
+}
+
+static void write_csv(ostream& out, const OpBenchResult& r)
+{
+    out << r.backend << "," << r.op << "," << escape_csv(r.config) << "," << r.element_type
+        << "," << r.elements << "," << r.bytes << "," << r.iterations << "," << r.ns_per_call
+        << "," << r.ns_per_element << "," << r.gbps << "," << r.gflops << ","
+        << escape_csv(r.error) << "\n";
+}
+
+static void write_json(ostream& out, const OpBenchResult& r, bool first)
+{
+    out << (first ? "" : ",\n") << "  {\"backend\": \"" << r.backend << "\", \"op\": \"" << r.op
+        << "\", \"config\": \"" << escape_json(r.config) << "\", \"element_type\": \""
+        << r.element_type << "\", \"elements\": " << r.elements << ", \"bytes\": " << r.bytes
+        << ", \"iterations\": " << r.iterations << ", \"ns_per_call\": " << r.ns_per_call
+        << ", \"ns_per_element\": " << r.ns_per_element << ", \"gbps\": " << r.gbps
+        << ", \"gflops\": " << r.gflops;
+    if (!r.error.empty())
+    {
+        out << ", \"error\": \"" << escape_json(r.error) << "\"";
+    }
+    out << "}";
+}
+
+static element::Type parse_element_type(const string& name)
+{
+    for (const element::Type* type : element::Type::get_known_types())
+    {
+        if (type->c_type_string() == name || type->get_type_name() == name)
+        {
+            return *type;
+        }
+    }
+    throw runtime_error("Unknown element type '" + name + "'");
+}
+
+int main(int argc, char** argv)
+{
+    vector<string> backends{"INTERPRETER", "CPU"};
+    vector<string> type_names{"f32"};
+    set<string> op_filter;
+    string format = "csv";
+    string output_file;
+    size_t iterations = 10;
+    size_t warmup_iterations = 2;
+    double min_milliseconds = 100;
+    OpBenchSize size = OpBenchSize::MEDIUM;
+    bool list = false;
+    bool failed = false;
+
+    configure_static_backends();
+    for (int i = 1; i < argc; i++)
+    {
+        string arg = argv[i];
+        bool has_value = i + 1 < argc;
+        if ((arg == "-b" || arg == "--backends") && has_value)
+        {
+            backends = split(argv[++i], ',', true);
+        }
+        else if ((arg == "-t" || arg == "--types") && has_value)
+        {
+            type_names = split(argv[++i], ',', true);
+        }
+        else if ((arg == "--op") && has_value)
+        {
+            for (const string& op : split(argv[++i], ',', true))
+            {
+                op_filter.insert(op);
+            }
+        }
+        else if ((arg == "-s" || arg == "--size") && has_value)
+        {
+            string value = argv[++i];
+            if (value == "small")
+            {
+                size = OpBenchSize::SMALL;
+            }
+            else if (value == "medium")
+            {
+                size = OpBenchSize::MEDIUM;
+            }
+            else if (value == "large")
+            {
+                size = OpBenchSize::LARGE;
+            }
+            else
+            {
+                cout << "Invalid size '" << value << "'\n";
+                failed = true;
+            }
+        }
+        else if ((arg == "-i" || arg == "--iterations") && has_value)
+        {
+            iterations = strtoul(argv[++i], nullptr, 10);
+        }
+        else if ((arg == "-w" || arg == "--warmup_iterations") && has_value)
+        {
+            warmup_iterations = strtoul(argv[++i], nullptr, 10);
+        }
+        else if ((arg == "--min_time") && has_value)
+        {
+            min_milliseconds = strtod(argv[++i], nullptr);
+        }
+        else if ((arg == "--format") && has_value)
+        {
+            format = argv[++i];
+            if (format != "csv" && format != "json")
+            {
+                cout << "Invalid format '" << format << "'\n";
+                failed = true;
+            }
+        }
+        else if ((arg == "-o" || arg == "--output") && has_value)
+        {
+            output_file = argv[++i];
+        }
+        else if (arg == "--list")
+        {
+            list = true;
+        }
+        else
+        {
+            cout << "Unknown option: " << arg << endl;
+            failed = true;
+        }
+    }
+
+    vector<element::Type> types;
+    try
+    {
+        for (const string& name : type_names)
+        {
+            types.push_back(parse_element_type(name));
+        }
+    }
+    catch (const exception& e)
+    {
+        cout << e.what() << endl;
+        failed = true;
+    }
+
+    if (failed)
+    {
+        cout << R"###(
+DESCRIPTION
+    Benchmark every op with a registered benchmark case on the given backends.
+
+SYNOPSIS
+        op_bench [-b <backends>] [-t <types>] [--op <ops>] [--format csv|json]
+
+OPTIONS
+        -b|--backends             Comma separated backend list (default: INTERPRETER,CPU).
+                                  Use CPU:codegen for the CPU code generator.
+        -t|--types                Comma separated element types (default: f32)
+        --op                      Comma separated list of ops to run (default: all)
+        -s|--size                 Problem size: small, medium or large (default: medium)
+        -i|--iterations           Minimum timed iterations per case (default: 10)
+        -w|--warmup_iterations    Untimed iterations per case (default: 2)
+        --min_time                Minimum timed milliseconds per case (default: 100)
+        --format                  Output format: csv or json (default: csv)
+        -o|--output               Write results to a file instead of stdout
+        --list                    List the benchmark cases and the ops without a case.
+                                  Fails if an op, or one given with --op, has no case.
+)###";
+        return 1;
+    }
+
+    vector<OpBenchCase> cases;
+    for (OpBenchCase& bench_case : make_op_bench_cases(types, size))
+    {
+        if (op_filter.empty() || op_filter.count(bench_case.op) != 0)
+        {
+            cases.push_back(move(bench_case));
+        }
+    }
+
+    if (list)
+    {
+        set<string> covered;
+        for (const OpBenchCase& bench_case : cases)
+        {
+            cout << bench_case.op << " " << bench_case.config << " "
+                 << bench_case.element_type.c_type_string() << "\n";
+            covered.insert(bench_case.op);
+        }
+        vector<string> all_ops = get_all_op_names();
+        if (!op_filter.empty())
+        {
+            all_ops.assign(op_filter.begin(), op_filter.end());
+        }
+        cout << "\n" << covered.size() << " of " << all_ops.size() << " ops have benchmark cases\n";
+        cout << "Ops without a benchmark case:\n";
+        size_t missing = 0;
+        for (const string& op : all_ops)
+        {
+            if (covered.count(op) == 0)
+            {
+                cout << "    " << op << "\n";
+                missing++;
+            }
+        }
+        // The listing doubles as a coverage check
+        return missing == 0 ? 0 : 1;
+    }
+
+    ofstream file_out;
+    if (!output_file.empty())
+    {
+        file_out.open(output_file);
+        if (!file_out)
+        {
+            cout << "Failed to open " << output_file << endl;
+            return 1;
+        }
+    }
+    ostream& out = output_file.empty() ? cout : file_out;
+    out << setprecision(6);
+
+    set_denormals_flush_to_zero();
+    if (format == "csv")
+    {
+        write_csv_header(out);
+    }
+    else
+    {
+        out << "[\n";
+    }
+
+    int rc = 0;
+    bool first = true;
+    for (const string& backend_name : backends)
+    {
+        shared_ptr<runtime::Backend> backend;
+        try
+        {
+            backend = runtime::Backend::create(backend_name);
+        }
+        catch (const exception& e)
+        {
+            cerr << "Failed to create backend " << backend_name << ": " << e.what() << endl;
+            rc = 1;
+            continue;
+        }
+        for (const OpBenchCase& bench_case : cases)
+        {
+            OpBenchResult result = run_case(
+                bench_case, backend_name, backend, iterations, warmup_iterations, min_milliseconds);
+            if (format == "csv")
+            {
+                write_csv(out, result);
+            }
+            else
+            {
+                write_json(out, result, first);
+            }
+            out.flush();
+            first = false;
+        }
+    }
+
+    if (format == "json")
+    {
+        out << "\n]\n";
+    }
+    return rc;
+}
@@ -0,0 +1,785 @@
+//*****************************************************************************
+// Copyright 2017-2019 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#include <set>
+
+#include "ngraph/ops.hpp"
+#include "ngraph/util.hpp"
+#include "op_bench_cases.hpp"
+
+using namespace std;
+using namespace ngraph;
+
+namespace
+{
+    using UnaryBuilder = function<shared_ptr<Node>(const Output<Node>&)>;
+    using BinaryBuilder = function<shared_ptr<Node>(const Output<Node>&, const Output<Node>&)>;
+
+    bool is_real(const element::Type& type) { return type.is_real(); }
+    string shape_string(const Shape& shape) { return "{" + join(shape, ",") + "}"; }
+    shared_ptr<Function> make_unary_function(const element::Type& type,
+                                             const Shape& shape,
+                                             const UnaryBuilder& builder)
+    {
+        auto A = make_shared<op::Parameter>(type, shape);
+        return make_shared<Function>(builder(A), ParameterVector{A});
+    }
+
+    shared_ptr<Function> make_binary_function(const element::Type& type,
+                                              const Shape& shape,
+                                              const BinaryBuilder& builder)
+    {
+        auto A = make_shared<op::Parameter>(type, shape);
+        auto B = make_shared<op::Parameter>(type, shape);
+        return make_shared<Function>(builder(A, B), ParameterVector{A, B});
+    }
+
+    // The reduction axes input of the opset 1 reductions
+    shared_ptr<Node> axes_constant(const AxisSet& axes)
+    {
+        return op::Constant::create(element::i64, Shape{axes.size()}, axes.to_vector());
+    }
+
+    struct BenchShapes
+    {
+        vector<Shape> elementwise;
+        vector<Shape> reduction;
+        vector<Shape> matmul; // {M, K, N}
+        vector<Shape> image;  // {N, C, H, W}
+    };
+
+    BenchShapes get_shapes(OpBenchSize size)
+    {
+        BenchShapes shapes;
+        switch (size)
+        {
+        case OpBenchSize::SMALL:
+            shapes.elementwise = {Shape{1024}, Shape{32, 256}};
+            shapes.reduction = {Shape{32, 256}};
+            shapes.matmul = {Shape{32, 32, 32}, Shape{64, 256, 64}};
+            shapes.image = {Shape{1, 16, 28, 28}};
+            break;
+        case OpBenchSize::MEDIUM:
+            shapes.elementwise = {Shape{65536}, Shape{64, 1024}, Shape{8, 64, 56, 56}};
+            shapes.reduction = {Shape{64, 1024}, Shape{8, 64, 56, 56}};
+            shapes.matmul = {Shape{128, 128, 128}, Shape{256, 1024, 256}, Shape{1, 1024, 1024}};
+            shapes.image = {Shape{1, 64, 56, 56}, Shape{8, 32, 28, 28}};
+            break;
+        case OpBenchSize::LARGE:
+            shapes.elementwise = {Shape{4194304}, Shape{32, 256, 56, 56}};
+            shapes.reduction = {Shape{1024, 4096}, Shape{32, 256, 56, 56}};
+            shapes.matmul = {Shape{1024, 1024, 1024}, Shape{4096, 1024, 1024}};
+            shapes.image = {Shape{32, 64, 56, 56}, Shape{32, 256, 14, 14}};
+            break;
+        }
+        return shapes;
+    }
+
+    class CaseBuilder
+    {
+    public:
+        CaseBuilder(const vector<element::Type>& types, OpBenchSize size)
+            : m_types(types)
+            , m_shapes(get_shapes(size))
+        {
+        }
+
+        vector<OpBenchCase> build()
+        {
+            add_unary_cases();
+            add_binary_cases();
+            add_logical_cases();
+            add_reduction_cases();
+            add_matmul_cases();
+            add_image_cases();
+            add_data_movement_cases();
+            return m_cases;
+        }
+
+    private:
+        void add(const string& op,
+                 const string& config,
+                 const element::Type& type,
+                 function<shared_ptr<Function>()> make_function,
+                 double flops,
+                 vector<pair<double, double>> input_ranges = {})
+        {
+            m_cases.push_back(
+                OpBenchCase{op, config, type, make_function, flops, move(input_ranges)});
+        }
+
+        template <typename OP>
+        UnaryBuilder unary()
+        {
+            return [](const Output<Node>& a) { return make_shared<OP>(a); };
+        }
+
+        template <typename OP>
+        BinaryBuilder binary()
+        {
+            return [](const Output<Node>& a, const Output<Node>& b) {
+                return make_shared<OP>(a, b);
+            };
+        }
+
+        void add_unary_cases()
+        {
+            // Ops whose domain is restricted get an explicit input range.
+            struct UnaryOp
+            {
+                string name;
+                UnaryBuilder builder;
+                bool real_only;
+                pair<double, double> range;
+            };
+            vector<UnaryOp> ops{
+                {"Abs", unary<op::Abs>(), false, {-1, 1}},
+                {"Acos", unary<op::Acos>(), true, {-1, 1}},
+                {"Asin", unary<op::Asin>(), true, {-1, 1}},
+                {"Atan", unary<op::Atan>(), true, {-1, 1}},
+                {"Ceiling", unary<op::Ceiling>(), true, {-10, 10}},
+                {"Clamp",
+                 [](const Output<Node>& a) { return make_shared<op::Clamp>(a, -1.0, 1.0); },
+                 true,
+                 {-3, 3}},
+                {"Cos", unary<op::Cos>(), true, {-3, 3}},
+                {"Cosh", unary<op::Cosh>(), true, {-3, 3}},
+                {"Elu",
+                 [](const Output<Node>& a) { return make_shared<op::Elu>(a, 1.0); },
+                 true,
+                 {-3, 3}},
+                {"Erf", unary<op::Erf>(), true, {-3, 3}},
+                {"Exp", unary<op::Exp>(), true, {-3, 3}},
+                {"Floor", unary<op::Floor>(), true, {-10, 10}},
+                {"Gelu", unary<op::Gelu>(), true, {-3, 3}},
+                {"Log", unary<op::Log>(), true, {0.1, 10}},
+                {"Negative", unary<op::Negative>(), false, {-10, 10}},
+                {"Reciprocal", unary<op::Reciprocal>(), true, {0.1, 10}},
+                {"Relu", unary<op::Relu>(), false, {-10, 10}},
+                {"Sigmoid", unary<op::Sigmoid>(), true, {-3, 3}},
+                {"Sign", unary<op::Sign>(), false, {-10, 10}},
+                {"Sin", unary<op::Sin>(), true, {-3, 3}},
+                {"Sinh", unary<op::Sinh>(), true, {-3, 3}},
+                {"Sqrt", unary<op::Sqrt>(), true, {0, 10}},
+                {"Tan", unary<op::Tan>(), true, {-1, 1}},
+                {"Tanh", unary<op::Tanh>(), true, {-3, 3}},
+            };
+            for (const UnaryOp& u : ops)
+            {
+                for (const element::Type& type : m_types)
+                {
+                    if (u.real_only && !is_real(type))
+                    {
+                        continue;
+                    }
+                    for (const Shape& shape : m_shapes.elementwise)
+                    {
+                        UnaryBuilder builder = u.builder;
+                        add(u.name,
+                            shape_string(shape),
+                            type,
+                            [type, shape, builder]() {
+                                return make_unary_function(type, shape, builder);
+                            },
+                            shape_size(shape),
+                            {u.range});
+                    }
+                }
+            }
+        }
+
+        void add_binary_cases()
+        {
+            struct BinaryOp
+            {
+                string name;
+                BinaryBuilder builder;
+                bool real_only;
+                pair<double, double> range;
+            };
+            vector<BinaryOp> ops{
+                {"Add", binary<op::Add>(), false, {-10, 10}},
+                {"Atan2", binary<op::Atan2>(), true, {0.1, 10}},
+                {"Divide", binary<op::Divide>(), false, {1, 10}},
+                {"Equal", binary<op::Equal>(), false, {0, 4}},
+                {"Greater", binary<op::Greater>(), false, {-10, 10}},
+                {"GreaterEq", binary<op::GreaterEq>(), false, {-10, 10}},
+                {"GreaterEqual", binary<op::v1::GreaterEqual>(), false, {-10, 10}},
+                {"Less", binary<op::Less>(), false, {-10, 10}},
+                {"LessEq", binary<op::LessEq>(), false, {-10, 10}},
+                {"LessEqual", binary<op::v1::LessEqual>(), false, {-10, 10}},
+                {"Maximum", binary<op::Maximum>(), false, {-10, 10}},
+                {"Minimum", binary<op::Minimum>(), false, {-10, 10}},
+                {"Mod", binary<op::v1::Mod>(), false, {1, 10}},
+                {"Multiply", binary<op::Multiply>(), false, {-10, 10}},
+                {"NotEqual", binary<op::NotEqual>(), false, {0, 4}},
+                {"Power", binary<op::Power>(), true, {0.1, 2}},
+                {"PRelu", binary<op::PRelu>(), true, {-10, 10}},
+                {"SquaredDifference", binary<op::SquaredDifference>(), false, {-10, 10}},
+                {"Subtract", binary<op::Subtract>(), false, {-10, 10}},
+            };
+            for (const BinaryOp& b : ops)
+            {
+                for (const element::Type& type : m_types)
+                {
+                    if (b.real_only && !is_real(type))
+                    {
+                        continue;
+                    }
+                    for (const Shape& shape : m_shapes.elementwise)
+                    {
+                        BinaryBuilder builder = b.builder;
+                        add(b.name,
+                            shape_string(shape),
+                            type,
+                            [type, shape, builder]() {
+                                return make_binary_function(type, shape, builder);
+                            },
+                            shape_size(shape),
+                            {b.range, b.range});
+                    }
+                }
+            }
+
+            for (const element::Type& type : m_types)
+            {
+                for (const Shape& shape : m_shapes.elementwise)
+                {
+                    add("Select",
+                        shape_string(shape),
+                        type,
+                        [type, shape]() {
+                            auto C = make_shared<op::Parameter>(element::boolean, shape);
+                            auto A = make_shared<op::Parameter>(type, shape);
+                            auto B = make_shared<op::Parameter>(type, shape);
+                            return make_shared<Function>(make_shared<op::Select>(C, A, B),
+                                                         ParameterVector{C, A, B});
+                        },
+                        0,
+                        {{0, 1}});
+                }
+            }
+        }
+
+        void add_logical_cases()
+        {
+            // Logical ops only take boolean inputs, so they are benchmarked once regardless of
+            // the requested element types.
+            vector<pair<string, BinaryBuilder>> ops{{"And", binary<op::And>()},
+                                                    {"LogicalAnd", binary<op::v1::LogicalAnd>()},
+                                                    {"LogicalOr", binary<op::v1::LogicalOr>()},
+                                                    {"LogicalXor", binary<op::v1::LogicalXor>()},
+                                                    {"Or", binary<op::Or>()},
+                                                    {"Xor", binary<op::Xor>()}};
+            for (const Shape& shape : m_shapes.elementwise)
+            {
+                for (auto& b : ops)
+                {
+                    BinaryBuilder builder = b.second;
+                    add(b.first,
+                        shape_string(shape),
+                        element::boolean,
+                        [shape, builder]() {
+                            return make_binary_function(element::boolean, shape, builder);
+                        },
+                        shape_size(shape),
+                        {{0, 1}, {0, 1}});
+                }
+                add("Not",
+                    shape_string(shape),
+                    element::boolean,
+                    [shape]() {
+                        return make_unary_function(
+                            element::boolean, shape, [](const Output<Node>& a) {
+                                return make_shared<op::Not>(a);
+                            });
+                    },
+                    shape_size(shape),
+                    {{0, 1}});
+                add("LogicalNot",
+                    shape_string(shape),
+                    element::boolean,
+                    [shape]() {
+                        return make_unary_function(
+                            element::boolean, shape, [](const Output<Node>& a) {
+                                return make_shared<op::v1::LogicalNot>(a);
+                            });
+                    },
+                    shape_size(shape),
+                    {{0, 1}});
+            }
+        }
+
+        void add_reduction_cases()
+        {
+            using ReductionBuilder =
+                function<shared_ptr<Node>(const Output<Node>&, const AxisSet&)>;
+            vector<pair<string, ReductionBuilder>> ops{
+                {"Sum",
+                 [](const Output<Node>& a, const AxisSet& axes) {
+                     return make_shared<op::Sum>(a, axes);
+                 }},
+                {"Product",
+                 [](const Output<Node>& a, const AxisSet& axes) {
+                     return make_shared<op::Product>(a, axes);
+                 }},
+                {"Max",
+                 [](const Output<Node>& a, const AxisSet& axes) {
+                     return make_shared<op::Max>(a, axes);
+                 }},
+                {"Min",
+                 [](const Output<Node>& a, const AxisSet& axes) {
+                     return make_shared<op::Min>(a, axes);
+                 }},
+                {"ReduceProd",
+                 [](const Output<Node>& a, const AxisSet& axes) {
+                     return make_shared<op::v1::ReduceProd>(a, axes_constant(axes));
+                 }},
+                {"ReduceSum",
+                 [](const Output<Node>& a, const AxisSet& axes) {
+                     return make_shared<op::v1::ReduceSum>(a, axes_constant(axes));
+                 }},
+            };
+            for (const Shape& shape : m_shapes.reduction)
+            {
+                // Reduce over the innermost axis, the outermost axis and every axis, which covers
+                // the contiguous, strided and full reduction kernels.
+                vector<AxisSet> axis_sets{AxisSet{shape.size() - 1}, AxisSet{0}};
+                AxisSet all_axes;
+                for (size_t i = 0; i < shape.size(); i++)
+                {
+                    all_axes.insert(i);
+                }
+                axis_sets.push_back(all_axes);
+
+                for (const element::Type& type : m_types)
+                {
+                    for (auto& r : ops)
+                    {
+                        for (const AxisSet& axes : axis_sets)
+                        {
+                            ReductionBuilder builder = r.second;
+                            add(r.first,
+                                shape_string(shape) + " axes{" + join(axes, ",") + "}",
+                                type,
+                                [type, shape, axes, builder]() {
+                                    auto A = make_shared<op::Parameter>(type, shape);
+                                    return make_shared<Function>(builder(A, axes),
+                                                                 ParameterVector{A});
+                                },
+                                shape_size(shape),
+                                {{0.5, 1.5}});
+                        }
+                    }
+
+                    for (size_t axis : {size_t{0}, shape.size() - 1})
+                    {
+                        add("ArgMax",
+                            shape_string(shape) + " axis " + to_string(axis),
+                            type,
+                            [type, shape, axis]() {
+                                auto A = make_shared<op::Parameter>(type, shape);
+                                return make_shared<Function>(
+                                    make_shared<op::ArgMax>(A, axis, element::i32),
+                                    ParameterVector{A});
+                            },
+                            shape_size(shape));
+                        add("ArgMin",
+                            shape_string(shape) + " axis " + to_string(axis),
+                            type,
+                            [type, shape, axis]() {
+                                auto A = make_shared<op::Parameter>(type, shape);
+                                return make_shared<Function>(
+                                    make_shared<op::ArgMin>(A, axis, element::i32),
+                                    ParameterVector{A});
+                            },
+                            shape_size(shape));
+                    }
+
+                    if (is_real(type))
+                    {
+                        size_t axis = shape.size() - 1;
+                        add("Softmax",
+                            shape_string(shape) + " axis " + to_string(axis),
+                            type,
+                            [type, shape, axis]() {
+                                auto A = make_shared<op::Parameter>(type, shape);
+                                return make_shared<Function>(
+                                    make_shared<op::Softmax>(A, AxisSet{axis}),
+                                    ParameterVector{A});
+                            },
+                            5.0 * shape_size(shape),
+                            {{-3, 3}});
+                        add("LogSoftmax",
+                            shape_string(shape) + " axis " + to_string(axis),
+                            type,
+                            [type, shape, axis]() {
+                                auto A = make_shared<op::Parameter>(type, shape);
+                                return make_shared<Function>(
+                                    make_shared<op::LogSoftmax>(A, axis), ParameterVector{A});
+                            },
+                            5.0 * shape_size(shape),
+                            {{-3, 3}});
+                        add("TopK",
+                            shape_string(shape) + " k 8",
+                            type,
+                            [type, shape, axis]() {
+                                auto A = make_shared<op::Parameter>(type, shape);
+                                auto topk = make_shared<op::TopK>(A, axis, element::i32, 8, true);
+                                return make_shared<Function>(
+                                    OutputVector{topk->output(0), topk->output(1)},
+                                    ParameterVector{A});
+                            },
+                            shape_size(shape));
+                    }
+                }
+
+                AxisSet last_axis{shape.size() - 1};
+                add("All",
+                    shape_string(shape) + " axes{" + join(last_axis, ",") + "}",
+                    element::boolean,
+                    [shape, last_axis]() {
+                        auto A = make_shared<op::Parameter>(element::boolean, shape);
+                        return make_shared<Function>(make_shared<op::All>(A, last_axis),
+                                                     ParameterVector{A});
+                    },
+                    shape_size(shape),
+                    {{0, 1}});
+                add("Any",
+                    shape_string(shape) + " axes{" + join(last_axis, ",") + "}",
+                    element::boolean,
+                    [shape, last_axis]() {
+                        auto A = make_shared<op::Parameter>(element::boolean, shape);
+                        return make_shared<Function>(make_shared<op::Any>(A, last_axis),
+                                                     ParameterVector{A});
+                    },
+                    shape_size(shape),
+                    {{0, 1}});
+            }
+        }
+
+        void add_matmul_cases()
+        {
+            for (const element::Type& type : m_types)
+            {
+                for (const Shape& mkn : m_shapes.matmul)
+                {
+                    size_t m = mkn[0];
+                    size_t k = mkn[1];
+                    size_t n = mkn[2];
+                    string config = "M " + to_string(m) + " K " + to_string(k) + " N " +
+                                    to_string(n);
+                    add("Dot",
+                        config,
+                        type,
+                        [type, m, k, n]() {
+                            auto A = make_shared<op::Parameter>(type, Shape{m, k});
+                            auto B = make_shared<op::Parameter>(type, Shape{k, n});
+                            return make_shared<Function>(make_shared<op::Dot>(A, B),
+                                                         ParameterVector{A, B});
+                        },
+                        2.0 * m * k * n,
+                        {{-1, 1}, {-1, 1}});
+                    // Decomposed into a transposing Reshape and a Dot
+                    add("MatMul",
+                        config + " transpose_b",
+                        type,
+                        [type, m, k, n]() {
+                            auto A = make_shared<op::Parameter>(type, Shape{m, k});
+                            auto B = make_shared<op::Parameter>(type, Shape{n, k});
+                            return make_shared<Function>(make_shared<op::MatMul>(A, B, false, true),
+                                                         ParameterVector{A, B});
+                        },
+                        2.0 * m * k * n,
+                        {{-1, 1}, {-1, 1}});
+                    if (is_real(type))
+                    {
+                        size_t batch = 8;
+                        add("BatchMatMul",
+                            "batch " + to_string(batch) + " " + config,
+                            type,
+                            [type, batch, m, k, n]() {
+                                auto A = make_shared<op::Parameter>(type, Shape{batch, m, k});
+                                auto B = make_shared<op::Parameter>(type, Shape{batch, k, n});
+                                return make_shared<Function>(make_shared<op::BatchMatMul>(A, B),
+                                                             ParameterVector{A, B});
+                            },
+                            2.0 * batch * m * k * n,
+                            {{-1, 1}, {-1, 1}});
+                    }
+                }
+            }
+        }
+
+        void add_image_cases()
+        {
+            for (const element::Type& type : m_types)
+            {
+                if (!is_real(type))
+                {
+                    continue;
+                }
+                for (const Shape& nchw : m_shapes.image)
+                {
+                    size_t batch = nchw[0];
+                    size_t channels = nchw[1];
+                    size_t height = nchw[2];
+                    size_t width = nchw[3];
+                    for (size_t kernel : {size_t{1}, size_t{3}})
+                    {
+                        size_t pad = kernel / 2;
+                        Shape filter{channels, channels, kernel, kernel};
+                        add("Convolution",
+                            shape_string(nchw) + " filter " + shape_string(filter),
+                            type,
+                            [type, nchw, filter, pad]() {
+                                auto data = make_shared<op::Parameter>(type, nchw);
+                                auto weights = make_shared<op::Parameter>(type, filter);
+                                auto conv = make_shared<op::Convolution>(
+                                    data,
+                                    weights,
+                                    Strides{1, 1},
+                                    Strides{1, 1},
+                                    CoordinateDiff{static_cast<ptrdiff_t>(pad),
+                                                   static_cast<ptrdiff_t>(pad)},
+                                    CoordinateDiff{static_cast<ptrdiff_t>(pad),
+                                                   static_cast<ptrdiff_t>(pad)});
+                                return make_shared<Function>(conv, ParameterVector{data, weights});
+                            },
+                            2.0 * batch * channels * height * width * channels * kernel * kernel,
+                            {{-1, 1}, {-1, 1}});
+                    }
+
+                    Shape window{3, 3};
+                    Strides strides{2, 2};
+                    double pool_flops =
+                        static_cast<double>(shape_size(nchw)) / 4 * shape_size(window);
+                    add("MaxPool",
+                        shape_string(nchw) + " window {3,3} stride {2,2}",
+                        type,
+                        [type, nchw, window, strides]() {
+                            auto A = make_shared<op::Parameter>(type, nchw);
+                            return make_shared<Function>(
+                                make_shared<op::MaxPool>(A, window, strides), ParameterVector{A});
+                        },
+                        pool_flops);
+                    add("AvgPool",
+                        shape_string(nchw) + " window {3,3} stride {2,2}",
+                        type,
+                        [type, nchw, window, strides]() {
+                            auto A = make_shared<op::Parameter>(type, nchw);
+                            return make_shared<Function>(
+                                make_shared<op::AvgPool>(A, window, strides), ParameterVector{A});
+                        },
+                        pool_flops);
+
+                    add("BatchNormInference",
+                        shape_string(nchw),
+                        type,
+                        [type, nchw, channels]() {
+                            auto input = make_shared<op::Parameter>(type, nchw);
+                            auto gamma = make_shared<op::Parameter>(type, Shape{channels});
+                            auto beta = make_shared<op::Parameter>(type, Shape{channels});
+                            auto mean = make_shared<op::Parameter>(type, Shape{channels});
+                            auto variance = make_shared<op::Parameter>(type, Shape{channels});
+                            auto bn = make_shared<op::BatchNormInference>(
+                                input, gamma, beta, mean, variance, 0.001);
+                            return make_shared<Function>(
+                                bn, ParameterVector{input, gamma, beta, mean, variance});
+                        },
+                        4.0 * shape_size(nchw),
+                        {{-1, 1}, {0.5, 1.5}, {-1, 1}, {-1, 1}, {0.5, 1.5}});
+                }
+            }
+        }
+
+        void add_data_movement_cases()
+        {
+            for (const element::Type& type : m_types)
+            {
+                for (const Shape& shape : m_shapes.reduction)
+                {
+                    string config = shape_string(shape);
+                    size_t rank = shape.size();
+
+                    add("Concat",
+                        config + " x3 axis " + to_string(rank - 1),
+                        type,
+                        [type, shape, rank]() {
+                            auto A = make_shared<op::Parameter>(type, shape);
+                            auto B = make_shared<op::Parameter>(type, shape);
+                            auto C = make_shared<op::Parameter>(type, shape);
+                            return make_shared<Function>(
+                                make_shared<op::Concat>(NodeVector{A, B, C}, rank - 1),
+                                ParameterVector{A, B, C});
+                        },
+                        0);
+
+                    Coordinate lower(rank, 0);
+                    Coordinate upper(shape);
+                    upper[rank - 1] = shape[rank - 1] / 2;
+                    add("Slice",
+                        config + " upper " + shape_string(upper),
+                        type,
+                        [type, shape, lower, upper]() {
+                            auto A = make_shared<op::Parameter>(type, shape);
+                            return make_shared<Function>(make_shared<op::Slice>(A, lower, upper),
+                                                         ParameterVector{A});
+                        },
+                        0);
+
+                    // Full transpose, the most expensive reshape
+                    AxisVector order;
+                    Shape transposed;
+                    for (size_t i = rank; i > 0; i--)
+                    {
+                        order.push_back(i - 1);
+                        transposed.push_back(shape[i - 1]);
+                    }
+                    add("Reshape",
+                        config + " order {" + join(order, ",") + "}",
+                        type,
+                        [type, shape, order, transposed]() {
+                            auto A = make_shared<op::Parameter>(type, shape);
+                            return make_shared<Function>(
+                                make_shared<op::Reshape>(A, order, transposed),
+                                ParameterVector{A});
+                        },
+                        0);
+
+                    Shape broadcast_shape{4};
+                    broadcast_shape.insert(broadcast_shape.end(), shape.begin(), shape.end());
+                    add("Broadcast",
+                        config + " to " + shape_string(broadcast_shape),
+                        type,
+                        [type, shape, broadcast_shape]() {
+                            auto A = make_shared<op::Parameter>(type, shape);
+                            return make_shared<Function>(
+                                make_shared<op::Broadcast>(A, broadcast_shape, AxisSet{0}),
+                                ParameterVector{A});
+                        },
+                        0);
+
+                    add("Reverse",
+                        config + " axes{" + to_string(rank - 1) + "}",
+                        type,
+                        [type, shape, rank]() {
+                            auto A = make_shared<op::Parameter>(type, shape);
+                            return make_shared<Function>(
+                                make_shared<op::Reverse>(A, AxisSet{rank - 1}),
+                                ParameterVector{A});
+                        },
+                        0);
+
+                    CoordinateDiff padding(rank, 1);
+                    add("Pad",
+                        config + " padding 1",
+                        type,
+                        [type, shape, padding]() {
+                            auto A = make_shared<op::Parameter>(type, shape);
+                            auto value = make_shared<op::Parameter>(type, Shape{});
+                            return make_shared<Function>(
+                                make_shared<op::Pad>(A, value, padding, padding),
+                                ParameterVector{A, value});
+                        },
+                        0);
+
+                    element::Type convert_type = is_real(type) ? element::i32 : element::f32;
+                    add("Convert",
+                        config + " to " + convert_type.c_type_string(),
+                        type,
+                        [type, shape, convert_type]() {
+                            auto A = make_shared<op::Parameter>(type, shape);
+                            return make_shared<Function>(
+                                make_shared<op::Convert>(A, convert_type), ParameterVector{A});
+                        },
+                        shape_size(shape));
+
+                    size_t rows = shape[0];
+                    Shape indices_shape{rows};
+                    add("Gather",
+                        config + " indices " + shape_string(indices_shape),
+                        type,
+                        [type, shape, indices_shape]() {
+                            auto params = make_shared<op::Parameter>(type, shape);
+                            auto indices = make_shared<op::Parameter>(element::i32, indices_shape);
+                            return make_shared<Function>(make_shared<op::Gather>(params, indices),
+                                                         ParameterVector{params, indices});
+                        },
+                        0,
+                        {{-1, 1}, {0, static_cast<double>(rows - 1)}});
+
+                    Shape tiled = shape;
+                    tiled[0] *= 2;
+                    add("Tile",
+                        config + " repeats 2",
+                        type,
+                        [type, shape, rank]() {
+                            vector<int64_t> repeat_values(rank, 1);
+                            repeat_values[0] = 2;
+                            auto A = make_shared<op::Parameter>(type, shape);
+                            auto repeats =
+                                op::Constant::create(element::i64, Shape{rank}, repeat_values);
+                            return make_shared<Function>(make_shared<op::Tile>(A, repeats),
+                                                         ParameterVector{A});
+                        },
+                        0);
+                }
+
+                // OneHot only accepts integral indices
+                for (const Shape& shape : m_shapes.elementwise)
+                {
+                    if (is_real(type))
+                    {
+                        break;
+                    }
+                    size_t depth = 16;
+                    Shape one_hot_shape = shape;
+                    one_hot_shape.push_back(depth);
+                    add("OneHot",
+                        shape_string(shape) + " depth " + to_string(depth),
+                        type,
+                        [type, shape, one_hot_shape]() {
+                            auto A = make_shared<op::Parameter>(type, shape);
+                            return make_shared<Function>(
+                                make_shared<op::OneHot>(A, one_hot_shape, shape.size()),
+                                ParameterVector{A});
+                        },
+                        0,
+                        {{0, static_cast<double>(depth - 1)}});
+                }
+            }
+        }
+
+        vector<element::Type> m_types;
+        BenchShapes m_shapes;
+        vector<OpBenchCase> m_cases;
+    };
+}
+
+vector<OpBenchCase> make_op_bench_cases(const vector<element::Type>& types, OpBenchSize size)
+{
+    return CaseBuilder(types, size).build();
+}
+
+vector<string> get_all_op_names()
+{
+    set<string> names;
+#define NGRAPH_OP(NAME, NAMESPACE, VERSION) names.insert(#NAME);
+#include "ngraph/op/op_version_tbl.hpp"
+#undef NGRAPH_OP
+    return vector<string>(names.begin(), names.end());
+}
@@ -0,0 +1,61 @@
+//*****************************************************************************
+// Copyright 2017-2019 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#pragma once
+
+#include <functional>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "ngraph/function.hpp"
+#include "ngraph/type/element_type.hpp"
+
+/// \brief A single op benchmark: one op type, one input configuration and one element type.
+///
+/// Functions are produced on demand by make_function because several backends (CPU in
+/// particular) run their passes in place on the Function they compile, so every backend needs
+/// its own copy.
+struct OpBenchCase
+{
+    /// Op type name as reported by Node::description()
+    std::string op;
+    /// Human readable description of the input shapes and attributes
+    std::string config;
+    ngraph::element::Type element_type;
+    std::function<std::shared_ptr<ngraph::Function>()> make_function;
+    /// Number of arithmetic operations performed by one execution, 0 for data movement ops
+    double flops;
+    /// Optional [min, max] range used to initialize each parameter. Parameters without an entry
+    /// use the default range for their element type.
+    std::vector<std::pair<double, double>> input_ranges;
+};
+
+enum class OpBenchSize
+{
+    SMALL,
+    MEDIUM,
+    LARGE
+};
+
+/// \brief Builds every benchmark case known to op_bench for the given element types.
+///        Cases that do not support a requested element type are omitted.
+std::vector<OpBenchCase> make_op_bench_cases(const std::vector<ngraph::element::Type>& types,
+                                             OpBenchSize size);
+
+/// \brief Returns the name of every op in the op version table, for coverage reporting.
+std::vector<std::string> get_all_op_names();
@@ -13,8 +13,11 @@
 // See the License for the specific language governing permissions and
 // limitations under the License.
 //*****************************************************************************
+#include <algorithm>
+#include <cstdlib>
 #include <fstream>
 #include <iostream>
+#include <limits>
 #include <random>
 #include <string>
 #include <tuple>
@@ -41,12 +44,14 @@ DESCRIPTION
     Run an ONNX model
 
 SYNOPSIS
-        run_onnx_model -m|--model <model file> [-i|--input <input file>]  [-b|--backend <backend name>]
+        run_onnx_model -m|--model <model file> [-i|--input <input file>]  [-b|--backend <backend name>] [--import-repeat <count>] [--import-threads <count>]
 
 OPTIONS
         -m or --model    Path to ONNX protobuf file with extension .onnx or .prototext  
         -i or --input    Path to a raw binary file with an array of input data. If not provided, model will be executed with random data.
         -b or --backend  nGraph backend name, such as INTERPRETER, CPU, GPU, NNP, PlaidML, INTELGPU, where available. Default backend: CPU
+        --import-repeat  Number of times the model is imported to measure the import time. The fastest and the average time are reported. Default: 1
+        --import-threads Number of threads importing the model. Default: NGRAPH_ONNX_IMPORT_THREADS, or 1
 
 )###";
 }
@@ -129,6 +134,25 @@ vector<shared_ptr<runtime::Tensor>> make_outputs(std::shared_ptr<runtime::Backen
     return outputs;
 }
 
+// Peak resident set size of the process in kB, or 0 if it is unknown.
+size_t get_peak_resident_kb()
+{
+    size_t peak = 0;
+#ifdef __linux__
+    ifstream status("/proc/self/status");
+    string line;
+    while (getline(status, line))
+    {
+        if (line.compare(0, 6, "VmHWM:") == 0)
+        {
+            peak = strtoul(line.c_str() + 6, nullptr, 10);
+            break;
+        }
+    }
+#endif
+    return peak;
+}
+
 // Validate provided arguments and split them into options and values.
 std::tuple<string, string> validate_argument(string arg, string arg2)
 {
@@ -226,6 +250,7 @@ int main(int argc, char** argv)
     vector<string> input_paths{};
     string model;
     string backend_type = "CPU";
+    size_t import_repeat = 1;
     vector<shared_ptr<runtime::Tensor>> inputs;
     vector<shared_ptr<runtime::Tensor>> outputs;
     std::shared_ptr<ngraph::Function> function;
@@ -254,6 +279,14 @@ int main(int argc, char** argv)
         {
             input_paths.push_back(arg2);
         }
+        else if (arg == "--import-repeat")
+        {
+            import_repeat = max<size_t>(1, stoul(arg2));
+        }
+        else if (arg == "--import-threads")
+        {
+            ngraph::onnx_import::set_import_thread_count(max<size_t>(1, stoul(arg2)));
+        }
         else if (arg == "-h" || arg == "--help")
         {
             help();
@@ -264,8 +297,25 @@ int main(int argc, char** argv)
     ifstream f(model);
     if (f)
     {
-        function = ngraph::onnx_import::import_onnx_model(model);
+        stopwatch import_timer;
+        size_t fastest_import = numeric_limits<size_t>::max();
+        for (size_t i = 0; i < import_repeat; i++)
+        {
+            function = nullptr;
+            import_timer.start();
+            function = ngraph::onnx_import::import_onnx_model(model);
+            import_timer.stop();
+            fastest_import = min(fastest_import, import_timer.get_milliseconds());
+        }
         cout << "Model file path:" << model << endl;
+        cout << "Import time:" << fastest_import << " ms";
+        if (import_repeat > 1)
+        {
+            cout << " (fastest of " << import_repeat << ", average "
+                 << import_timer.get_total_milliseconds() / import_repeat << " ms)";
+        }
+        cout << endl;
+        cout << "Peak memory after import:" << get_peak_resident_kb() << " kB" << endl;
     }
     else
     {
@@ -0,0 +1,247 @@
+//*****************************************************************************
+// Copyright 2017-2019 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#include <algorithm>
+#include <functional>
+#include <memory>
+
+#ifndef _WIN32
+#include <unistd.h>
+#endif
+
+#include "gtest/gtest.h"
+#include "ngraph/distributed.hpp"
+#include "ngraph/distributed/shared_memory.hpp"
+#include "ngraph/ngraph.hpp"
+#include "ngraph/pass/allreduce_bucketing.hpp"
+#include "ngraph/pass/manager.hpp"
+#include "util/test_tools.hpp"
+
+using namespace ngraph;
+using namespace std;
+
+// Every weight is updated with the all-reduced gradient of its own
+static shared_ptr<Function> make_update(const vector<Shape>& shapes)
+{
+    ParameterVector weights;
+    NodeVector updates;
+    for (auto& shape : shapes)
+    {
+        auto weight = make_shared<op::Parameter>(element::f32, shape);
+        auto gradient = make_shared<op::Multiply>(weight, weight);
+        auto reduced = make_shared<op::AllReduce>(gradient);
+        updates.push_back(make_shared<op::Subtract>(weight, reduced));
+        weights.push_back(weight);
+    }
+    return make_shared<Function>(updates, weights);
+}
+
+static void run_bucketing(const shared_ptr<Function>& f, size_t bucket_bytes)
+{
+    pass::Manager pass_manager;
+    pass_manager.register_pass<pass::AllReduceBucketing>(bucket_bytes);
+    pass_manager.run_passes(f);
+}
+
+TEST(allreduce_bucketing, fuse_small_allreduces)
+{
+    auto f = make_update({Shape{2, 3}, Shape{4}, Shape{}});
+    run_bucketing(f, 1024);
+
+    ASSERT_EQ(count_ops_of_type<op::AllReduce>(f), 1);
+    ASSERT_EQ(count_ops_of_type<op::Concat>(f), 1);
+    EXPECT_EQ(f->get_output_shape(0), (Shape{2, 3}));
+    EXPECT_EQ(f->get_output_shape(1), (Shape{4}));
+    EXPECT_EQ(f->get_output_shape(2), (Shape{}));
+    for (auto& node : f->get_ops())
+    {
+        if (is_type<op::AllReduce>(node))
+        {
+            EXPECT_EQ(node->get_output_shape(0), (Shape{11}));
+        }
+    }
+}
+
+TEST(allreduce_bucketing, bucket_size_limit)
+{
+    // Four gradients of 64 bytes in buckets of 128 bytes
+    auto f = make_update({Shape{16}, Shape{16}, Shape{16}, Shape{16}});
+    run_bucketing(f, 128);
+
+    EXPECT_EQ(count_ops_of_type<op::AllReduce>(f), 2);
+    EXPECT_EQ(count_ops_of_type<op::Concat>(f), 2);
+}
+
+TEST(allreduce_bucketing, large_allreduce_not_fused)
+{
+    auto f = make_update({Shape{64}, Shape{4}});
+    run_bucketing(f, 128);
+
+    EXPECT_EQ(count_ops_of_type<op::AllReduce>(f), 2);
+    EXPECT_EQ(count_ops_of_type<op::Concat>(f), 0);
+}
+
+TEST(allreduce_bucketing, dependent_allreduces_not_fused)
+{
+    auto A = make_shared<op::Parameter>(element::f32, Shape{4});
+    auto B = make_shared<op::Parameter>(element::f32, Shape{4});
+    auto first = make_shared<op::AllReduce>(A);
+    auto second = make_shared<op::AllReduce>(make_shared<op::Add>(first, B));
+    auto f = make_shared<Function>(NodeVector{second}, ParameterVector{A, B});
+    run_bucketing(f, 1024);
+
+    EXPECT_EQ(count_ops_of_type<op::AllReduce>(f), 2);
+    EXPECT_EQ(count_ops_of_type<op::Concat>(f), 0);
+}
+
+TEST(allreduce_bucketing, different_reduce_types_not_fused)
+{
+    auto A = make_shared<op::Parameter>(element::f32, Shape{4});
+    auto B = make_shared<op::Parameter>(element::f32, Shape{4});
+    auto sum = make_shared<op::AllReduce>(A, reduction::Type::SUM);
+    auto max = make_shared<op::AllReduce>(B, reduction::Type::MAX);
+    auto f = make_shared<Function>(NodeVector{sum, max}, ParameterVector{A, B});
+    run_bucketing(f, 1024);
+
+    EXPECT_EQ(count_ops_of_type<op::AllReduce>(f), 2);
+    EXPECT_EQ(count_ops_of_type<op::Concat>(f), 0);
+}
+
+TEST(allreduce_bucketing, consumers_run_after_next_bucket)
+{
+    auto f = make_update({Shape{16}, Shape{16}, Shape{16}, Shape{16}});
+    run_bucketing(f, 128);
+
+    // Both buckets are started before any weight is updated
+    auto ops = f->get_ordered_ops();
+    auto is_all_reduce = [](const shared_ptr<Node>& node) {
+        return is_type<op::AllReduce>(node);
+    };
+    auto is_update = [](const shared_ptr<Node>& node) { return is_type<op::Subtract>(node); };
+    auto second_all_reduce = find_if(
+        next(find_if(ops.begin(), ops.end(), is_all_reduce)), ops.end(), is_all_reduce);
+    ASSERT_NE(second_all_reduce, ops.end());
+    EXPECT_EQ(find_if(ops.begin(), second_all_reduce, is_update), second_all_reduce);
+}
+
+#ifndef _WIN32
+// Installs a distributed interface and restores the previous one, even if a test fails
+class DistributedInterfaceScope
+{
+public:
+    DistributedInterfaceScope(DistributedInterface* distributed_interface)
+        : m_previous(set_distributed_interface(
+              unique_ptr<DistributedInterface>(distributed_interface)))
+    {
+    }
+    ~DistributedInterfaceScope() { set_distributed_interface(move(m_previous)); }
+
+private:
+    unique_ptr<DistributedInterface> m_previous;
+};
+
+// Runs `body` in a group of `size` processes connected by shared memory
+static void run_on_ranks(int size, function<void(int rank)> body)
+{
+    auto comm = new distributed::SharedMemoryDistributedInterface(size, 256);
+    int rank = comm->fork_ranks();
+    DistributedInterfaceScope scope(comm);
+    if (rank != 0)
+    {
+        bool success = true;
+        try
+        {
+            body(rank);
+        }
+        catch (...)
+        {
+            success = false;
+        }
+        _exit(success && !::testing::Test::HasFailure() ? 0 : 1);
+    }
+    body(rank);
+    EXPECT_TRUE(comm->join_ranks());
+}
+
+TEST(allreduce_bucketing, shared_memory_async_collectives)
+{
+    run_on_ranks(3, [](int rank) {
+        auto comm = get_distributed_interface();
+        ASSERT_EQ(comm->get_size(), 3);
+        ASSERT_EQ(comm->get_rank(), rank);
+
+        // Larger than the shared buffer of 256 bytes
+        vector<float> gradients(100, static_cast<float>(rank + 1));
+        vector<float> sums(100);
+        vector<double> values(10, rank);
+        vector<int32_t> maxima{rank, -rank, 7};
+        auto sum_request = comm->all_reduce_async(
+            gradients.data(), sums.data(), element::f32, reduction::Type::SUM, sums.size());
+        auto broadcast_request = comm->broadcast_async(values.data(), element::f64, 10, 2);
+        auto max_request = comm->all_reduce_async(
+            maxima.data(), maxima.data(), element::i32, reduction::Type::MAX, maxima.size());
+        // The input can be reused as soon as the collective is started
+        fill(gradients.begin(), gradients.end(), 0.0f);
+
+        max_request->wait();
+        sum_request->wait();
+        broadcast_request->wait();
+        sum_request->wait();
+        EXPECT_EQ(sums, vector<float>(100, 6.0f));
+        EXPECT_EQ(values, vector<double>(10, 2.0));
+        EXPECT_EQ(maxima, (vector<int32_t>{2, 0, 7}));
+    });
+}
+
+#ifdef NGRAPH_INTERPRETER_ENABLE
+TEST(allreduce_bucketing, bucketed_update)
+{
+    vector<Shape> shapes{Shape{2, 3}, Shape{4}, Shape{}, Shape{40}};
+    run_on_ranks(3, [&](int rank) {
+        auto f = make_update(shapes);
+        run_bucketing(f, 64);
+        // The last gradient is larger than a bucket
+        ASSERT_EQ(count_ops_of_type<op::AllReduce>(f), 2);
+
+        auto backend = runtime::Backend::create("INTERPRETER");
+        vector<shared_ptr<runtime::Tensor>> weights;
+        vector<shared_ptr<runtime::Tensor>> updates;
+        vector<vector<float>> expected;
+        for (auto& shape : shapes)
+        {
+            vector<float> weight(shape_size(shape));
+            vector<float> update(weight.size());
+            for (size_t i = 0; i < weight.size(); i++)
+            {
+                weight[i] = static_cast<float>(i + rank);
+                // The squares of i, i + 1 and i + 2 are summed over the ranks
+                update[i] = weight[i] - (3 * i * i + 6 * i + 5);
+            }
+            weights.push_back(backend->create_tensor(element::f32, shape));
+            copy_data(weights.back(), weight);
+            updates.push_back(backend->create_tensor(element::f32, shape));
+            expected.push_back(update);
+        }
+        auto handle = backend->compile(f);
+        handle->call_with_validate(updates, weights);
+        for (size_t i = 0; i < shapes.size(); i++)
+        {
+            EXPECT_EQ(read_vector<float>(updates[i]), expected[i]);
+        }
+    });
+}
+#endif
+#endif
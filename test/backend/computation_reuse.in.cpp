@@ -14,6 +14,8 @@
 // limitations under the License.
 //*****************************************************************************
 
+#include <thread>
+
 #include "gtest/gtest.h"
 #include "ngraph/ngraph.hpp"
 #include "util/all_close.hpp"
@@ -71,3 +73,44 @@ NGRAPH_TEST(${BACKEND_NAME}, computation_reuse)
     exec->call_with_validate({result}, {a, b});
     EXPECT_TRUE(test::all_close_f(rv_saved, read_vector<float>(result)));
 }
+
+NGRAPH_TEST(${BACKEND_NAME}, computation_reuse_from_threads)
+{
+    Shape shape{64, 64};
+    auto A = make_shared<op::Parameter>(element::f32, shape);
+    auto B = make_shared<op::Parameter>(element::f32, shape);
+    auto C = make_shared<op::Parameter>(element::f32, shape);
+    auto f = make_shared<Function>((A + B) * C - A, ParameterVector{A, B, C});
+
+    auto backend = runtime::Backend::create("${BACKEND_NAME}");
+    auto exec = backend->compile(f);
+
+    // Each thread calls the same executable with its own tensors, the intermediate results of
+    // concurrent calls must not mix
+    auto run = [&](float value, vector<float>* errors) {
+        auto a = backend->create_tensor(element::f32, shape);
+        auto b = backend->create_tensor(element::f32, shape);
+        auto c = backend->create_tensor(element::f32, shape);
+        auto result = backend->create_tensor(element::f32, shape);
+        copy_data(a, vector<float>(shape_size(shape), value));
+        copy_data(b, vector<float>(shape_size(shape), 1.0f));
+        copy_data(c, vector<float>(shape_size(shape), 2.0f));
+        vector<float> expected(shape_size(shape), (value + 1.0f) * 2.0f - value);
+        for (size_t i = 0; i < 200; i++)
+        {
+            exec->call_with_validate({result}, {a, b, c});
+            if (read_vector<float>(result) != expected)
+            {
+                errors->push_back(value);
+            }
+        }
+    };
+    vector<float> first_errors;
+    vector<float> second_errors;
+    thread first(run, 3.0f, &first_errors);
+    thread second(run, 5.0f, &second_errors);
+    first.join();
+    second.join();
+    EXPECT_TRUE(first_errors.empty());
+    EXPECT_TRUE(second_errors.empty());
+}
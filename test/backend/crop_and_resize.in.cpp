@@ -0,0 +1,142 @@
+//*****************************************************************************
+// Copyright 2017-2019 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#include <string>
+#include <vector>
+
+#include "gtest/gtest.h"
+#include "ngraph/ngraph.hpp"
+#include "util/all_close.hpp"
+#include "util/all_close_f.hpp"
+#include "util/random.hpp"
+#include "util/test_control.hpp"
+#include "util/test_tools.hpp"
+
+using namespace std;
+using namespace ngraph;
+
+static string s_manifest = "${MANIFEST}";
+
+static shared_ptr<Function> make_crop_and_resize(const Shape& image_shape,
+                                                 size_t num_boxes,
+                                                 const vector<int32_t>& crop_size,
+                                                 op::CropAndResize::ResizeMethod resize_method)
+{
+    auto image = make_shared<op::Parameter>(element::f32, image_shape);
+    auto boxes = make_shared<op::Parameter>(element::f32, Shape{num_boxes, 4});
+    auto box_indices = make_shared<op::Parameter>(element::i32, Shape{num_boxes});
+    auto crop = make_shared<op::CropAndResize>(
+        image,
+        boxes,
+        box_indices,
+        op::Constant::create(element::i32, Shape{2}, crop_size),
+        resize_method,
+        -1.0f);
+    return make_shared<Function>(crop, ParameterVector{image, boxes, box_indices});
+}
+
+static vector<float> run_crop_and_resize(const string& backend_name,
+                                         const Shape& image_shape,
+                                         const vector<float>& image_data,
+                                         const vector<float>& box_data,
+                                         const vector<int32_t>& index_data,
+                                         const vector<int32_t>& crop_size,
+                                         op::CropAndResize::ResizeMethod resize_method)
+{
+    size_t num_boxes = index_data.size();
+    auto f = make_crop_and_resize(image_shape, num_boxes, crop_size, resize_method);
+    auto backend = runtime::Backend::create(backend_name);
+    auto image = backend->create_tensor(element::f32, image_shape);
+    copy_data(image, image_data);
+    auto boxes = backend->create_tensor(element::f32, Shape{num_boxes, 4});
+    copy_data(boxes, box_data);
+    auto box_indices = backend->create_tensor(element::i32, Shape{num_boxes});
+    copy_data(box_indices, index_data);
+    auto result = backend->create_tensor(element::f32, f->get_output_shape(0));
+    backend->compile(f)->call_with_validate({result}, {image, boxes, box_indices});
+    return read_vector<float>(result);
+}
+
+NGRAPH_TEST(${BACKEND_NAME}, crop_and_resize)
+{
+    // The whole image, its top left quarter, and a box that is mostly outside of it
+    auto result = run_crop_and_resize("${BACKEND_NAME}",
+                                      Shape{1, 3, 3, 1},
+                                      vector<float>{0, 1, 2, 3, 4, 5, 6, 7, 8},
+                                      vector<float>{0, 0, 1, 1, 0, 0, 0.5f, 0.5f, -1, -1, 0, 0},
+                                      vector<int32_t>{0, 0, 0},
+                                      {2, 2},
+                                      op::CropAndResize::ResizeMethod::bilinear);
+    EXPECT_TRUE(test::all_close_f((vector<float>{0, 2, 6, 8, 0, 1, 3, 4, -1, -1, -1, 0}), result));
+}
+
+NGRAPH_TEST(${BACKEND_NAME}, crop_and_resize_random)
+{
+    // Random boxes, some of them partly outside of the images
+    Shape image_shape{2, 11, 13, 3};
+    test::Uniform<float> image_rng(0.0f, 1.0f);
+    test::Uniform<float> box_rng(-0.2f, 1.2f);
+    vector<float> image_data(shape_size(image_shape));
+    vector<float> box_data(4 * 6);
+    image_rng.initialize(image_data);
+    box_rng.initialize(box_data);
+    vector<int32_t> index_data{0, 1, 1, 0, 1, 0};
+    for (auto resize_method :
+         {op::CropAndResize::ResizeMethod::bilinear, op::CropAndResize::ResizeMethod::nearest})
+    {
+        auto int_result = run_crop_and_resize(
+            "INTERPRETER", image_shape, image_data, box_data, index_data, {5, 7}, resize_method);
+        auto backend_result = run_crop_and_resize("${BACKEND_NAME}",
+                                                  image_shape,
+                                                  image_data,
+                                                  box_data,
+                                                  index_data,
+                                                  {5, 7},
+                                                  resize_method);
+        EXPECT_TRUE(test::all_close(backend_result, int_result));
+    }
+}
+
+NGRAPH_TEST(${BACKEND_NAME}, crop_and_resize_unsupported_box_indices)
+{
+    auto image = make_shared<op::Parameter>(element::f32, Shape{1, 3, 3, 1});
+    auto boxes = make_shared<op::Parameter>(element::f32, Shape{1, 4});
+    auto box_indices = make_shared<op::Parameter>(element::i16, Shape{1});
+    auto crop = make_shared<op::CropAndResize>(image,
+                                               boxes,
+                                               box_indices,
+                                               op::Constant::create(element::i32, Shape{2}, {2, 2}),
+                                               op::CropAndResize::ResizeMethod::bilinear,
+                                               0.0f);
+    auto f = make_shared<Function>(crop, ParameterVector{image, boxes, box_indices});
+
+    auto backend = runtime::Backend::create("${BACKEND_NAME}");
+    auto image_tensor = backend->create_tensor(element::f32, Shape{1, 3, 3, 1});
+    auto boxes_tensor = backend->create_tensor(element::f32, Shape{1, 4});
+    auto box_indices_tensor = backend->create_tensor(element::i16, Shape{1});
+    auto result = backend->create_tensor(element::f32, f->get_output_shape(0));
+    // The error names the type it does not support
+    try
+    {
+        backend->compile(f)->call_with_validate(
+            {result}, {image_tensor, boxes_tensor, box_indices_tensor});
+        FAIL() << "CropAndResize with i16 box indices did not throw";
+    }
+    catch (const ngraph_error& error)
+    {
+        EXPECT_NE(string(error.what()).find("i16"), string::npos) << error.what();
+    }
+}
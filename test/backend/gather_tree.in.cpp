@@ -0,0 +1,101 @@
+//*****************************************************************************
+// Copyright 2017-2019 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#include <cmath>
+#include <string>
+#include <vector>
+
+#include "gtest/gtest.h"
+#include "ngraph/ngraph.hpp"
+#include "util/random.hpp"
+#include "util/test_control.hpp"
+#include "util/test_tools.hpp"
+
+using namespace std;
+using namespace ngraph;
+
+static string s_manifest = "${MANIFEST}";
+
+static shared_ptr<Function> make_gather_tree(const element::Type& type, const Shape& shape)
+{
+    auto step_ids = make_shared<op::Parameter>(type, shape);
+    auto parent_ids = make_shared<op::Parameter>(type, shape);
+    auto max_seq_len = make_shared<op::Parameter>(type, Shape{shape[1]});
+    auto end_token = make_shared<op::Parameter>(type, Shape{});
+    auto gather_tree =
+        make_shared<op::v1::GatherTree>(step_ids, parent_ids, max_seq_len, end_token);
+    return make_shared<Function>(gather_tree,
+                                 ParameterVector{step_ids, parent_ids, max_seq_len, end_token});
+}
+
+NGRAPH_TEST(${BACKEND_NAME}, gather_tree)
+{
+    // [max_time, batch_size, beam_width]
+    Shape shape{3, 2, 3};
+    auto f = make_gather_tree(element::i32, shape);
+    auto backend = runtime::Backend::create("${BACKEND_NAME}");
+    auto step_ids = backend->create_tensor(element::i32, shape);
+    copy_data(step_ids, vector<int32_t>{1, 2, 3, 1, 2, 3, 10, 5, 6, 4, 5, 6, 7, 8, 9, 7, 8, 9});
+    auto parent_ids = backend->create_tensor(element::i32, shape);
+    copy_data(parent_ids, vector<int32_t>{0, 0, 0, 0, 0, 0, 2, 1, 0, 2, 1, 0, 0, 0, 1, 0, 0, 1});
+    auto max_seq_len = backend->create_tensor(element::i32, Shape{2});
+    copy_data(max_seq_len, vector<int32_t>{3, 2});
+    auto end_token = backend->create_tensor(element::i32, Shape{});
+    copy_data(end_token, vector<int32_t>{10});
+    auto result = backend->create_tensor(element::i32, shape);
+
+    backend->compile(f)->call_with_validate({result},
+                                            {step_ids, parent_ids, max_seq_len, end_token});
+    // The first two beams of the first batch end at their second step, and the second batch
+    // is only two steps long
+    EXPECT_EQ((vector<int32_t>{3, 3, 2, 3, 2, 1, 10, 10, 5, 4, 5, 6, 10, 10, 9, 10, 10, 10}),
+              read_vector<int32_t>(result));
+}
+
+NGRAPH_TEST(${BACKEND_NAME}, gather_tree_random)
+{
+    Shape shape{37, 5, 8};
+    auto f = make_gather_tree(element::f32, shape);
+    test::Uniform<float> rng(0.0f, 1.0f);
+    vector<float> step_ids(shape_size(shape));
+    vector<float> parent_ids(shape_size(shape));
+    vector<float> max_seq_len(shape[1]);
+    rng.initialize(step_ids);
+    rng.initialize(parent_ids);
+    rng.initialize(max_seq_len);
+    for (auto& step_id : step_ids)
+    {
+        step_id = std::floor(step_id * 20);
+    }
+    for (auto& parent_id : parent_ids)
+    {
+        parent_id = std::floor(parent_id * shape[2]);
+    }
+    // Sequences shorter and longer than max_time, and an empty one
+    for (auto& length : max_seq_len)
+    {
+        length = std::floor(length * 50);
+    }
+    max_seq_len[0] = 0;
+    // An invalid parent of the last step of a full length beam
+    max_seq_len[1] = 37;
+    parent_ids[(36 * 5 + 1) * 8 + 3] = 9;
+
+    vector<vector<float>> args{step_ids, parent_ids, max_seq_len, vector<float>{4}};
+    auto int_results = execute(f, args, "INTERPRETER");
+    auto backend_results = execute(f, args, "${BACKEND_NAME}");
+    EXPECT_EQ(int_results.at(0), backend_results.at(0));
+}
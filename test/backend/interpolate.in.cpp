@@ -0,0 +1,102 @@
+//*****************************************************************************
+// Copyright 2017-2019 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#include <string>
+#include <vector>
+
+#include "gtest/gtest.h"
+#include "ngraph/ngraph.hpp"
+#include "util/all_close.hpp"
+#include "util/all_close_f.hpp"
+#include "util/random.hpp"
+#include "util/test_control.hpp"
+#include "util/test_tools.hpp"
+
+using namespace std;
+using namespace ngraph;
+
+static string s_manifest = "${MANIFEST}";
+
+static shared_ptr<Function> make_interpolate(const Shape& shape,
+                                             const AxisSet& axes,
+                                             const vector<int64_t>& sizes,
+                                             const string& mode,
+                                             bool align_corners)
+{
+    op::InterpolateAttrs attrs;
+    attrs.axes = axes;
+    attrs.mode = mode;
+    attrs.align_corners = align_corners;
+    auto A = make_shared<op::Parameter>(element::f32, shape);
+    auto output_shape = op::Constant::create(element::i64, Shape{sizes.size()}, sizes);
+    return make_shared<Function>(make_shared<op::Interpolate>(A, output_shape, attrs),
+                                 ParameterVector{A});
+}
+
+NGRAPH_TEST(${BACKEND_NAME}, interpolate)
+{
+    auto backend = runtime::Backend::create("${BACKEND_NAME}");
+    auto a = backend->create_tensor(element::f32, Shape{1, 1, 2, 2});
+    copy_data(a, vector<float>{1, 2, 3, 4});
+
+    auto linear = make_interpolate(Shape{1, 1, 2, 2}, AxisSet{2, 3}, {3, 3}, "linear", true);
+    auto result = backend->create_tensor(element::f32, Shape{1, 1, 3, 3});
+    backend->compile(linear)->call_with_validate({result}, {a});
+    EXPECT_TRUE(test::all_close_f(
+        (vector<float>{1, 1.5, 2, 2, 2.5, 3, 3, 3.5, 4}), read_vector<float>(result)));
+
+    auto nearest = make_interpolate(Shape{1, 1, 2, 2}, AxisSet{2, 3}, {4, 4}, "nearest", false);
+    result = backend->create_tensor(element::f32, Shape{1, 1, 4, 4});
+    backend->compile(nearest)->call_with_validate({result}, {a});
+    EXPECT_EQ((vector<float>{1, 1, 2, 2, 1, 1, 2, 2, 3, 3, 4, 4, 3, 3, 4, 4}),
+              read_vector<float>(result));
+}
+
+NGRAPH_TEST(${BACKEND_NAME}, interpolate_layouts)
+{
+    // NCHW, NHWC, a single axis, and interpolated axes around one that is not
+    vector<pair<Shape, AxisSet>> layouts{{Shape{2, 3, 7, 9}, AxisSet{2, 3}},
+                                         {Shape{2, 7, 9, 3}, AxisSet{1, 2}},
+                                         {Shape{4, 9}, AxisSet{1}},
+                                         {Shape{2, 7, 3, 9}, AxisSet{1, 3}}};
+    test::Uniform<float> rng(-1.0f, 1.0f);
+    for (auto& layout : layouts)
+    {
+        for (string mode : {"nearest", "linear", "cubic"})
+        {
+            for (bool align_corners : {true, false})
+            {
+                for (auto sizes : {vector<int64_t>{4, 13}, vector<int64_t>{12, 5}})
+                {
+                    sizes.resize(layout.second.size());
+                    auto f = make_interpolate(
+                        layout.first, layout.second, sizes, mode, align_corners);
+                    vector<vector<float>> args;
+                    for (auto& param : f->get_parameters())
+                    {
+                        vector<float> tensor_val(shape_size(param->get_shape()));
+                        rng.initialize(tensor_val);
+                        args.push_back(tensor_val);
+                    }
+                    auto int_results = execute(f, args, "INTERPRETER");
+                    auto backend_results = execute(f, args, "${BACKEND_NAME}");
+                    EXPECT_TRUE(test::all_close(backend_results.at(0), int_results.at(0)))
+                        << mode << " interpolation of " << layout.first;
+                }
+            }
+        }
+    }
+}
@@ -0,0 +1,216 @@
+//*****************************************************************************
+// Copyright 2017-2019 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#include <string>
+#include <vector>
+
+#include "gtest/gtest.h"
+#include "ngraph/ngraph.hpp"
+#include "util/random.hpp"
+#include "util/test_control.hpp"
+#include "util/test_tools.hpp"
+
+using namespace std;
+using namespace ngraph;
+
+static string s_manifest = "${MANIFEST}";
+
+static vector<int64_t>
+    run_non_max_suppression(const string& backend_name,
+                            const Shape& boxes_shape,
+                            const vector<float>& boxes,
+                            const Shape& scores_shape,
+                            const vector<float>& scores,
+                            int64_t max_output_boxes_per_class,
+                            float iou_threshold,
+                            float score_threshold,
+                            op::v1::NonMaxSuppression::BoxEncodingType box_encoding,
+                            bool sort_result_descending)
+{
+    auto B = make_shared<op::Parameter>(element::f32, boxes_shape);
+    auto S = make_shared<op::Parameter>(element::f32, scores_shape);
+    auto nms = make_shared<op::v1::NonMaxSuppression>(
+        B,
+        S,
+        op::Constant::create(element::i64, Shape{}, {max_output_boxes_per_class}),
+        op::Constant::create(element::f32, Shape{}, {iou_threshold}),
+        op::Constant::create(element::f32, Shape{}, {score_threshold}),
+        box_encoding,
+        sort_result_descending);
+    auto f = make_shared<Function>(nms, ParameterVector{B, S});
+
+    auto backend = runtime::Backend::create(backend_name);
+    auto boxes_tensor = backend->create_tensor(element::f32, boxes_shape);
+    copy_data(boxes_tensor, boxes);
+    auto scores_tensor = backend->create_tensor(element::f32, scores_shape);
+    copy_data(scores_tensor, scores);
+    auto result = backend->create_tensor(element::i64, nms->get_output_shape(0));
+    auto handle = backend->compile(f);
+    handle->call_with_validate({result}, {boxes_tensor, scores_tensor});
+    return read_vector<int64_t>(result);
+}
+
+NGRAPH_TEST(${BACKEND_NAME}, non_max_suppression)
+{
+    using BoxEncodingType = op::v1::NonMaxSuppression::BoxEncodingType;
+    vector<float> corner_boxes{0.0f, 0.0f, 1.0f, 1.0f, 0.0f, 0.1f, 1.0f, 1.1f, 0.0f, -0.1f, 1.0f,
+                               0.9f, 0.0f, 10.0f, 1.0f, 11.0f, 0.0f, 10.1f, 1.0f, 11.1f, 0.0f,
+                               100.0f, 1.0f, 101.0f};
+    // The same boxes with other diagonal corners, and as centers and sizes
+    vector<float> flipped_boxes{1.0f, 1.0f, 0.0f, 0.0f, 0.0f, 0.1f, 1.0f, 1.1f, 0.0f, 0.9f, 1.0f,
+                                -0.1f, 0.0f, 10.0f, 1.0f, 11.0f, 1.0f, 10.1f, 0.0f, 11.1f, 1.0f,
+                                101.0f, 0.0f, 100.0f};
+    vector<float> center_boxes{0.5f, 0.5f, 1.0f, 1.0f, 0.5f, 0.6f, 1.0f, 1.0f, 0.5f, 0.4f, 1.0f,
+                               1.0f, 0.5f, 10.5f, 1.0f, 1.0f, 0.5f, 10.6f, 1.0f, 1.0f, 0.5f, 100.5f,
+                               1.0f, 1.0f};
+    vector<float> scores{0.9f, 0.75f, 0.6f, 0.95f, 0.5f, 0.3f};
+    Shape boxes_shape{1, 6, 4};
+    Shape scores_shape{1, 1, 6};
+
+    EXPECT_EQ(run_non_max_suppression("${BACKEND_NAME}",
+                                      boxes_shape,
+                                      corner_boxes,
+                                      scores_shape,
+                                      scores,
+                                      3,
+                                      0.5f,
+                                      0.0f,
+                                      BoxEncodingType::CORNER,
+                                      true),
+              (vector<int64_t>{0, 0, 3, 0, 0, 0, 0, 0, 5}));
+    EXPECT_EQ(run_non_max_suppression("${BACKEND_NAME}",
+                                      boxes_shape,
+                                      flipped_boxes,
+                                      scores_shape,
+                                      scores,
+                                      3,
+                                      0.5f,
+                                      0.0f,
+                                      BoxEncodingType::CORNER,
+                                      true),
+              (vector<int64_t>{0, 0, 3, 0, 0, 0, 0, 0, 5}));
+    EXPECT_EQ(run_non_max_suppression("${BACKEND_NAME}",
+                                      boxes_shape,
+                                      center_boxes,
+                                      scores_shape,
+                                      scores,
+                                      3,
+                                      0.5f,
+                                      0.0f,
+                                      BoxEncodingType::CENTER,
+                                      true),
+              (vector<int64_t>{0, 0, 3, 0, 0, 0, 0, 0, 5}));
+    // Only two boxes score above the threshold
+    EXPECT_EQ(run_non_max_suppression("${BACKEND_NAME}",
+                                      boxes_shape,
+                                      corner_boxes,
+                                      scores_shape,
+                                      scores,
+                                      3,
+                                      0.5f,
+                                      0.4f,
+                                      BoxEncodingType::CORNER,
+                                      true),
+              (vector<int64_t>{0, 0, 3, 0, 0, 0, -1, -1, -1}));
+    EXPECT_EQ(run_non_max_suppression("${BACKEND_NAME}",
+                                      boxes_shape,
+                                      corner_boxes,
+                                      scores_shape,
+                                      scores,
+                                      0,
+                                      0.5f,
+                                      0.0f,
+                                      BoxEncodingType::CORNER,
+                                      true),
+              (vector<int64_t>{}));
+}
+
+NGRAPH_TEST(${BACKEND_NAME}, non_max_suppression_batches_and_classes)
+{
+    using BoxEncodingType = op::v1::NonMaxSuppression::BoxEncodingType;
+    Shape boxes_shape{2, 4, 4};
+    Shape scores_shape{2, 3, 4};
+    vector<float> boxes{0.0f, 0.0f, 1.0f, 1.0f, 0.0f, 0.1f, 1.0f, 1.1f, 0.0f, 10.0f, 1.0f, 11.0f,
+                        0.0f, 10.1f, 1.0f, 11.1f, 0.0f, 0.0f, 1.0f, 1.0f, 0.0f, 0.5f, 1.0f, 1.5f,
+                        0.0f, 1.0f, 1.0f, 2.0f, 0.0f, 0.9f, 1.0f, 1.9f};
+    vector<float> scores{0.9f, 0.8f, 0.7f, 0.6f, 0.1f, 0.2f, 0.3f, 0.4f, 0.5f, 0.5f, 0.5f, 0.5f,
+                         0.3f, 0.4f, 0.2f, 0.1f, 0.7f, 0.6f, 0.5f, 0.95f, 0.0f, 0.0f, 0.0f, 0.0f};
+
+    // At most min(4, 2 * 3) rows, so only the first ones are kept
+    EXPECT_EQ(run_non_max_suppression("${BACKEND_NAME}",
+                                      boxes_shape,
+                                      boxes,
+                                      scores_shape,
+                                      scores,
+                                      2,
+                                      0.5f,
+                                      0.0f,
+                                      BoxEncodingType::CORNER,
+                                      false),
+              (vector<int64_t>{0, 0, 0, 0, 0, 2, 0, 1, 3, 0, 1, 1}));
+    EXPECT_EQ(run_non_max_suppression("${BACKEND_NAME}",
+                                      boxes_shape,
+                                      boxes,
+                                      scores_shape,
+                                      scores,
+                                      2,
+                                      0.5f,
+                                      0.0f,
+                                      BoxEncodingType::CORNER,
+                                      true),
+              (vector<int64_t>{1, 1, 3, 0, 0, 0, 0, 0, 2, 1, 1, 0}));
+}
+
+// Many random boxes, on the CPU backend with the kernel that sorts candidates in chunks
+NGRAPH_TEST(${BACKEND_NAME}, non_max_suppression_random)
+{
+    using BoxEncodingType = op::v1::NonMaxSuppression::BoxEncodingType;
+    Shape boxes_shape{3, 1000, 4};
+    Shape scores_shape{3, 20, 1000};
+    test::Uniform<float> corner_rng(0.0f, 100.0f);
+    test::Uniform<float> score_rng(0.0f, 1.0f);
+    vector<float> boxes(shape_size(boxes_shape));
+    vector<float> scores(shape_size(scores_shape));
+    corner_rng.initialize(boxes);
+    score_rng.initialize(scores);
+    for (auto box_encoding : {BoxEncodingType::CORNER, BoxEncodingType::CENTER})
+    {
+        for (bool sort_result_descending : {true, false})
+        {
+            auto int_result = run_non_max_suppression("INTERPRETER",
+                                                      boxes_shape,
+                                                      boxes,
+                                                      scores_shape,
+                                                      scores,
+                                                      40,
+                                                      0.3f,
+                                                      0.2f,
+                                                      box_encoding,
+                                                      sort_result_descending);
+            auto backend_result = run_non_max_suppression("${BACKEND_NAME}",
+                                                          boxes_shape,
+                                                          boxes,
+                                                          scores_shape,
+                                                          scores,
+                                                          40,
+                                                          0.3f,
+                                                          0.2f,
+                                                          box_encoding,
+                                                          sort_result_descending);
+            EXPECT_EQ(backend_result, int_result);
+        }
+    }
+}
@@ -24,10 +24,21 @@
 #include "ngraph/codegen/execution_engine.hpp"
 #include "ngraph/file_util.hpp"
 #include "ngraph/log.hpp"
+#include "ngraph/op/add.hpp"
 #include "ngraph/op/concat.hpp"
+#include "ngraph/op/constant.hpp"
+#include "ngraph/op/convolution.hpp"
+#include "ngraph/op/max_pool.hpp"
+#include "ngraph/op/multiply.hpp"
+#include "ngraph/op/non_max_suppression.hpp"
+#include "ngraph/op/parameter.hpp"
+#include "ngraph/op/relu.hpp"
+#include "ngraph/op/softmax.hpp"
+#include "ngraph/op/sum.hpp"
 #include "ngraph/runtime/backend.hpp"
 #include "ngraph/serializer.hpp"
 #include "ngraph/util.hpp"
+#include "util/all_close.hpp"
 #include "util/random.hpp"
 #include "util/test_tools.hpp"
 
@@ -140,3 +151,185 @@ TEST(benchmark, concat_32x1x200_axis1_6)
         }
     }
 }
+
+//
+// Benchmarks NonMaxSuppression over the boxes of a detection model with 80 classes.
+//
+TEST(benchmark, non_max_suppression_1x80x15000)
+{
+    Shape boxes_shape{1, 15000, 4};
+    Shape scores_shape{1, 80, 15000};
+
+    test::Uniform<float> corner_rng(0.0f, 1000.0f);
+    test::Uniform<float> size_rng(10.0f, 100.0f);
+    test::Uniform<float> score_rng(0.0f, 1.0f);
+    vector<float> boxes(shape_size(boxes_shape));
+    vector<float> sizes(boxes.size() / 2);
+    corner_rng.initialize(boxes);
+    size_rng.initialize(sizes);
+    for (size_t i = 0; i < sizes.size(); i += 2)
+    {
+        boxes[2 * i + 2] = boxes[2 * i] + sizes[i];
+        boxes[2 * i + 3] = boxes[2 * i + 1] + sizes[i + 1];
+    }
+    // Most of the boxes have a low score for most of the classes
+    vector<float> scores(shape_size(scores_shape));
+    score_rng.initialize(scores);
+    for (auto& score : scores)
+    {
+        score = score * score * score;
+    }
+
+    vector<std::string> backend_names{"INTERPRETER", "CPU"};
+    vector<int> n_runs{10, 100};
+    vector<vector<int64_t>> results;
+    for (size_t i = 0; i < backend_names.size(); i++)
+    {
+        auto B = make_shared<op::Parameter>(element::f32, boxes_shape);
+        auto S = make_shared<op::Parameter>(element::f32, scores_shape);
+        auto nms = make_shared<op::v1::NonMaxSuppression>(
+            B,
+            S,
+            op::Constant::create(element::i64, Shape{}, {100}),
+            op::Constant::create(element::f32, Shape{}, {0.5f}),
+            op::Constant::create(element::f32, Shape{}, {0.05f}));
+        auto f = make_shared<Function>(nms, ParameterVector{B, S});
+
+        auto backend = runtime::Backend::create(backend_names[i]);
+        auto boxes_tensor = backend->create_tensor(element::f32, boxes_shape);
+        copy_data(boxes_tensor, boxes);
+        auto scores_tensor = backend->create_tensor(element::f32, scores_shape);
+        copy_data(scores_tensor, scores);
+        auto result = backend->create_tensor(element::i64, nms->get_output_shape(0));
+        auto handle = backend->compile(f);
+
+        std::cout << backend_names[i] << ": " << n_runs[i] << " tests in " << std::flush;
+        stopwatch sw;
+        sw.start();
+        for (int j = 0; j < n_runs[i]; j++)
+        {
+            handle->call_with_validate({result}, {boxes_tensor, scores_tensor});
+        }
+        sw.stop();
+        std::cout << sw.get_milliseconds() << "ms (" << (sw.get_microseconds() / n_runs[i])
+                  << " us/test)" << std::endl;
+        results.push_back(read_vector<int64_t>(result));
+    }
+
+    EXPECT_EQ(results[1], results[0]);
+}
+
+//
+// Benchmarks a small convolution, pooling and softmax network on the reference interpreter, the
+// OpenMP kernels of the generic CPU backend and the CPU backend.
+//
+TEST(benchmark, generic_cpu_conv_pool_softmax_4x32x28x28)
+{
+    Shape data_shape{4, 32, 28, 28};
+    Shape filters_shape{64, 32, 3, 3};
+    test::Uniform<float> rng(-1.0f, 1.0f);
+    vector<float> data(shape_size(data_shape));
+    vector<float> filters(shape_size(filters_shape));
+    rng.initialize(data);
+    rng.initialize(filters);
+
+    vector<std::string> backend_names{"INTERPRETER", "GCPU", "CPU"};
+    vector<int> n_runs{1, 10, 10};
+    vector<vector<float>> results;
+    for (size_t i = 0; i < backend_names.size(); i++)
+    {
+        auto A = make_shared<op::Parameter>(element::f32, data_shape);
+        auto W = make_shared<op::Parameter>(element::f32, filters_shape);
+        auto conv = make_shared<op::Convolution>(A,
+                                                 W,
+                                                 Strides{1, 1},
+                                                 Strides{1, 1},
+                                                 CoordinateDiff{1, 1},
+                                                 CoordinateDiff{1, 1});
+        auto relu = make_shared<op::Relu>(conv);
+        auto pool = make_shared<op::MaxPool>(relu, Shape{2, 2}, Strides{2, 2});
+        auto sum = make_shared<op::Sum>(pool, AxisSet{2, 3});
+        auto softmax = make_shared<op::Softmax>(sum, AxisSet{1});
+        auto f = make_shared<Function>(softmax, ParameterVector{A, W});
+
+        auto backend = runtime::Backend::create(backend_names[i]);
+        auto data_tensor = backend->create_tensor(element::f32, data_shape);
+        copy_data(data_tensor, data);
+        auto filters_tensor = backend->create_tensor(element::f32, filters_shape);
+        copy_data(filters_tensor, filters);
+        auto result = backend->create_tensor(element::f32, softmax->get_output_shape(0));
+        auto handle = backend->compile(f);
+
+        std::cout << backend_names[i] << ": " << n_runs[i] << " tests in " << std::flush;
+        stopwatch sw;
+        sw.start();
+        for (int j = 0; j < n_runs[i]; j++)
+        {
+            handle->call_with_validate({result}, {data_tensor, filters_tensor});
+        }
+        sw.stop();
+        std::cout << sw.get_milliseconds() << "ms (" << (sw.get_microseconds() / n_runs[i])
+                  << " us/test)" << std::endl;
+        results.push_back(read_vector<float>(result));
+    }
+
+    EXPECT_TRUE(test::all_close(results[1], results[0]));
+    EXPECT_TRUE(test::all_close(results[2], results[0]));
+}
+
+// Per-call overhead of the interpreted backends on a chain of tiny ops
+TEST(benchmark, small_op_chain_1000x16)
+{
+    Shape shape{16};
+    size_t n_ops = 1000;
+    test::Uniform<float> rng(-1.0f, 1.0f);
+    vector<float> a(shape_size(shape));
+    vector<float> b(shape_size(shape));
+    rng.initialize(a);
+    rng.initialize(b);
+
+    vector<std::string> backend_names{"INTERPRETER", "GCPU"};
+    int n_runs = 1000;
+    vector<vector<float>> results;
+    for (auto backend_name : backend_names)
+    {
+        auto A = make_shared<op::Parameter>(element::f32, shape);
+        auto B = make_shared<op::Parameter>(element::f32, shape);
+        shared_ptr<Node> node = A;
+        for (size_t i = 0; i < n_ops; i++)
+        {
+            if (i % 2 == 0)
+            {
+                node = make_shared<op::Add>(node, B);
+            }
+            else
+            {
+                node = make_shared<op::Multiply>(node, B);
+            }
+        }
+        auto f = make_shared<Function>(node, ParameterVector{A, B});
+
+        auto backend = runtime::Backend::create(backend_name);
+        auto a_tensor = backend->create_tensor(element::f32, shape);
+        copy_data(a_tensor, a);
+        auto b_tensor = backend->create_tensor(element::f32, shape);
+        copy_data(b_tensor, b);
+        auto result = backend->create_tensor(element::f32, shape);
+        auto handle = backend->compile(f);
+
+        std::cout << backend_name << ": " << n_runs << " tests in " << std::flush;
+        stopwatch sw;
+        sw.start();
+        for (int j = 0; j < n_runs; j++)
+        {
+            handle->call_with_validate({result}, {a_tensor, b_tensor});
+        }
+        sw.stop();
+        std::cout << sw.get_milliseconds() << "ms (" << (sw.get_microseconds() / n_runs)
+                  << " us/test, " << (sw.get_microseconds() * 1000 / (n_runs * n_ops))
+                  << " ns/op)" << std::endl;
+        results.push_back(read_vector<float>(result));
+    }
+
+    EXPECT_EQ(results[1], results[0]);
+}
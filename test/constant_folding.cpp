@@ -17,7 +17,11 @@
 #include "ngraph/pass/constant_folding.hpp"
 #include "gtest/gtest.h"
 #include "ngraph/ngraph.hpp"
+#include "ngraph/pass/backend_constant_folding.hpp"
 #include "ngraph/pass/manager.hpp"
+#ifdef NGRAPH_INTERPRETER_ENABLE
+#include "ngraph/runtime/interpreter/int_backend.hpp"
+#endif
 #include "util/all_close_f.hpp"
 #include "util/test_tools.hpp"
 
@@ -2201,3 +2205,150 @@ TEST(constant_folding, pass_property)
     ASSERT_FALSE(pass->get_property(pass::PassProperty::REQUIRE_STATIC_SHAPE));
     ASSERT_TRUE(pass->get_property(pass::PassProperty::CHANGE_DYNAMIC_STATE));
 }
+
+#ifdef NGRAPH_INTERPRETER_ENABLE
+TEST(constant_folding, backend_dot_softmax)
+{
+    auto A = op::Constant::create(element::f32, Shape{2, 2}, {1, 2, 3, 4});
+    auto B = op::Constant::create(element::f32, Shape{2, 2}, {1, 0, 0, 1});
+    auto softmax = make_shared<op::Softmax>(make_shared<op::Dot>(A, B), AxisSet{1});
+    auto P = make_shared<op::Parameter>(element::f32, Shape{2, 2});
+    auto f = make_shared<Function>(make_shared<op::Add>(P, softmax), ParameterVector{P});
+
+    pass::Manager pass_manager;
+    pass_manager.register_pass<pass::BackendConstantFolding>();
+    pass_manager.run_passes(f);
+
+    ASSERT_EQ(count_ops_of_type<op::Dot>(f), 0);
+    ASSERT_EQ(count_ops_of_type<op::Softmax>(f), 0);
+    ASSERT_EQ(count_ops_of_type<op::Constant>(f), 1);
+
+    auto new_const =
+        as_type_ptr<op::Constant>(f->get_results().at(0)->get_argument(0)->get_argument(1));
+    ASSERT_TRUE(new_const);
+    float low = 1 / (1 + exp(1.0f));
+    vector<float> expected{low, 1 - low, low, 1 - low};
+    ASSERT_TRUE(test::all_close_f(expected, new_const->get_vector<float>()));
+}
+
+TEST(constant_folding, backend_independent_subgraphs)
+{
+    auto A = op::Constant::create(element::f32, Shape{3}, {1, -2, 3});
+    auto B = op::Constant::create(element::f32, Shape{3}, {-4, 5, -6});
+    auto P = make_shared<op::Parameter>(element::f32, Shape{3});
+    auto sum = make_shared<op::Add>(P, make_shared<op::Negative>(A));
+    auto f = make_shared<Function>(make_shared<op::Add>(sum, make_shared<op::Abs>(B)),
+                                   ParameterVector{P});
+
+    pass::Manager pass_manager;
+    pass_manager.register_pass<pass::BackendConstantFolding>();
+    pass_manager.run_passes(f);
+
+    ASSERT_EQ(count_ops_of_type<op::Negative>(f), 0);
+    ASSERT_EQ(count_ops_of_type<op::Abs>(f), 0);
+    ASSERT_EQ(count_ops_of_type<op::Constant>(f), 2);
+
+    auto add = f->get_results().at(0)->get_argument(0);
+    auto negative = as_type_ptr<op::Constant>(add->get_argument(0)->get_argument(1));
+    auto abs = as_type_ptr<op::Constant>(add->get_argument(1));
+    ASSERT_TRUE(negative);
+    ASSERT_TRUE(abs);
+    ASSERT_EQ((vector<float>{-1, 2, -3}), negative->get_vector<float>());
+    ASSERT_EQ((vector<float>{4, 5, 6}), abs->get_vector<float>());
+}
+
+TEST(constant_folding, backend_size_cap)
+{
+    // Broadcasting the scalar to 64 elements would grow the model past the cap, but its sum is
+    // small
+    auto A = op::Constant::create(element::f32, Shape{}, {2});
+    auto P = make_shared<op::Parameter>(element::f32, Shape{64});
+    auto broadcast = make_shared<op::Broadcast>(A, Shape{64}, AxisSet{0});
+    auto sum = make_shared<op::Sum>(make_shared<op::Broadcast>(A, Shape{64}, AxisSet{0}),
+                                    AxisSet{0});
+    auto f = make_shared<Function>(NodeVector{make_shared<op::Add>(P, broadcast), sum},
+                                   ParameterVector{P});
+
+    pass::Manager pass_manager;
+    pass_manager.register_pass<pass::BackendConstantFolding>("INTERPRETER", 16);
+    pass_manager.run_passes(f);
+
+    ASSERT_EQ(count_ops_of_type<op::Broadcast>(f), 1);
+    ASSERT_EQ(count_ops_of_type<op::Sum>(f), 0);
+
+    auto new_const = as_type_ptr<op::Constant>(f->get_results().at(1)->get_argument(0));
+    ASSERT_TRUE(new_const);
+    ASSERT_EQ((vector<float>{128}), new_const->get_vector<float>());
+}
+
+TEST(constant_folding, backend_unsupported_op)
+{
+    auto A = op::Constant::create(element::f32, Shape{2, 2}, {1, 2, 3, 4});
+    auto B = op::Constant::create(element::f32, Shape{2, 2}, {1, 0, 0, 1});
+    auto f = make_shared<Function>(make_shared<op::Dot>(make_shared<op::Negative>(A), B),
+                                   ParameterVector{});
+
+    auto backend = make_shared<runtime::interpreter::INTBackend>(vector<string>{"Dot"});
+    pass::Manager pass_manager;
+    pass_manager.register_pass<pass::BackendConstantFolding>(backend);
+    pass_manager.run_passes(f);
+
+    ASSERT_EQ(count_ops_of_type<op::Negative>(f), 0);
+    ASSERT_EQ(count_ops_of_type<op::Dot>(f), 1);
+
+    auto new_const =
+        as_type_ptr<op::Constant>(f->get_results().at(0)->get_argument(0)->get_argument(0));
+    ASSERT_TRUE(new_const);
+    ASSERT_EQ((vector<float>{-1, -2, -3, -4}), new_const->get_vector<float>());
+}
+
+TEST(constant_folding, backend_distributed_op)
+{
+    auto A = op::Constant::create(element::f32, Shape{2}, {1, 2});
+    auto f = make_shared<Function>(make_shared<op::AllReduce>(make_shared<op::Negative>(A)),
+                                   ParameterVector{});
+
+    pass::Manager pass_manager;
+    pass_manager.register_pass<pass::BackendConstantFolding>();
+    pass_manager.run_passes(f);
+
+    ASSERT_EQ(count_ops_of_type<op::Negative>(f), 0);
+    ASSERT_EQ(count_ops_of_type<op::AllReduce>(f), 1);
+}
+
+namespace
+{
+    // Fails to compile functions with an Abs in them
+    class NoAbsBackend : public runtime::interpreter::INTBackend
+    {
+    public:
+        shared_ptr<runtime::Executable> compile(shared_ptr<Function> function,
+                                                bool enable_performance_data = false) override
+        {
+            if (count_ops_of_type<op::Abs>(function) > 0)
+            {
+                throw ngraph_error("Abs is not supported");
+            }
+            return INTBackend::compile(function, enable_performance_data);
+        }
+    };
+}
+
+TEST(constant_folding, backend_failed_subgraph)
+{
+    auto A = op::Constant::create(element::f32, Shape{3}, {1, -2, 3});
+    auto B = op::Constant::create(element::f32, Shape{3}, {-4, 5, -6});
+    auto P = make_shared<op::Parameter>(element::f32, Shape{3});
+    auto sum = make_shared<op::Add>(P, make_shared<op::Negative>(A));
+    auto f = make_shared<Function>(make_shared<op::Add>(sum, make_shared<op::Abs>(B)),
+                                   ParameterVector{P});
+
+    pass::Manager pass_manager;
+    pass_manager.register_pass<pass::BackendConstantFolding>(make_shared<NoAbsBackend>());
+    pass_manager.run_passes(f);
+
+    ASSERT_EQ(count_ops_of_type<op::Negative>(f), 0);
+    ASSERT_EQ(count_ops_of_type<op::Abs>(f), 1);
+    ASSERT_EQ(count_ops_of_type<op::Constant>(f), 2);
+}
+#endif
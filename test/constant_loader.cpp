@@ -0,0 +1,182 @@
+//*****************************************************************************
+// Copyright 2017-2019 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#include <cstring>
+#include <fstream>
+
+#include "gtest/gtest.h"
+
+#include "ngraph/file_util.hpp"
+#include "ngraph/ngraph.hpp"
+#include "ngraph/runtime/constant_loader.hpp"
+#include "ngraph/serializer.hpp"
+#include "util/test_tools.hpp"
+
+using namespace std;
+using namespace ngraph;
+
+namespace
+{
+    // Loads a copy of a vector, counting how often it is loaded
+    class VectorLoader : public runtime::ConstantLoader
+    {
+    public:
+        VectorLoader(const vector<float>& values)
+            : ConstantLoader(values.size() * sizeof(float))
+            , m_values(values)
+        {
+        }
+
+        size_t get_load_count() const { return m_load_count; }
+    protected:
+        void load(void* data) override
+        {
+            memcpy(data, m_values.data(), get_size());
+            m_load_count++;
+        }
+
+    private:
+        vector<float> m_values;
+        size_t m_load_count = 0;
+    };
+
+    // Removes a file when leaving the scope, even if the test fails
+    class TempFile
+    {
+    public:
+        TempFile(const string& path)
+            : m_path(path)
+        {
+        }
+
+        ~TempFile() { file_util::remove_file(m_path); }
+        const string& get_path() const { return m_path; }
+    private:
+        string m_path;
+    };
+}
+
+TEST(constant_loader, load_on_first_use)
+{
+    runtime::ConstantLoader::reset_stats();
+    auto loader = make_shared<VectorLoader>(vector<float>{1, 2, 3, 4});
+    auto c = make_shared<op::Constant>(element::f32, Shape{2, 2}, loader);
+    EXPECT_FALSE(c->is_loaded());
+    EXPECT_EQ(c->get_shape(), (Shape{2, 2}));
+    EXPECT_EQ(loader->get_load_count(), 0);
+
+    // Clones share the loaded data
+    auto clone = static_pointer_cast<op::Constant>(c->copy_with_new_inputs({}));
+    EXPECT_FALSE(clone->is_loaded());
+    EXPECT_EQ((vector<float>{1, 2, 3, 4}), c->get_vector<float>());
+    EXPECT_TRUE(c->is_loaded());
+    EXPECT_FALSE(c->get_all_data_elements_bitwise_identical());
+    EXPECT_EQ(c->get_data_ptr(), clone->get_data_ptr());
+    EXPECT_EQ(loader->get_load_count(), 1);
+
+    auto stats = runtime::ConstantLoader::get_stats();
+    EXPECT_EQ(stats.constants_declared, 1);
+    EXPECT_EQ(stats.bytes_declared, 4 * sizeof(float));
+    EXPECT_EQ(stats.constants_loaded, 1);
+    EXPECT_EQ(stats.bytes_loaded, 4 * sizeof(float));
+}
+
+TEST(constant_loader, clone_function)
+{
+    // Only the data of the Constants that are read is loaded
+    runtime::ConstantLoader::reset_stats();
+    Shape shape{4};
+    auto A = make_shared<op::Parameter>(element::f32, shape);
+    auto B = make_shared<op::Constant>(
+        element::f32, shape, make_shared<VectorLoader>(vector<float>{1, 2, 3, 4}));
+    auto C = make_shared<op::Constant>(
+        element::f32, shape, make_shared<VectorLoader>(vector<float>{5, 6, 7, 8}));
+    auto f = make_shared<Function>(make_shared<op::Add>(make_shared<op::Add>(A, B), C),
+                                   ParameterVector{A});
+    auto g = clone_function(*f);
+    EXPECT_EQ(runtime::ConstantLoader::get_stats().constants_loaded, 0);
+
+    auto add = g->get_results().at(0)->get_argument(0);
+    auto clone_of_c = as_type_ptr<op::Constant>(add->get_argument(1));
+    ASSERT_TRUE(clone_of_c);
+    EXPECT_EQ((vector<float>{5, 6, 7, 8}), clone_of_c->get_vector<float>());
+    EXPECT_FALSE(C->is_loaded());
+
+    auto stats = runtime::ConstantLoader::get_stats();
+    EXPECT_EQ(stats.constants_declared, 2);
+    EXPECT_EQ(stats.bytes_declared, 8 * sizeof(float));
+    EXPECT_EQ(stats.constants_loaded, 1);
+    EXPECT_EQ(stats.bytes_loaded, 4 * sizeof(float));
+}
+
+TEST(constant_loader, file)
+{
+    TempFile tmp_file("constant_loader.bin");
+    vector<float> values{1, 2, 3, 4, 5, 6};
+    {
+        ofstream out(tmp_file.get_path(), ios_base::binary);
+        out.write("header", 6);
+        out.write(reinterpret_cast<const char*>(values.data()), values.size() * sizeof(float));
+    }
+    auto c = make_shared<op::Constant>(
+        element::f32,
+        Shape{2, 3},
+        make_shared<runtime::FileConstantLoader>(
+            tmp_file.get_path(), 6, values.size() * sizeof(float)));
+    EXPECT_EQ(values, c->get_vector<float>());
+
+    // Reading past the end of the file fails
+    auto past_end = make_shared<op::Constant>(
+        element::f32,
+        Shape{2, 3},
+        make_shared<runtime::FileConstantLoader>(
+            tmp_file.get_path(), 12, values.size() * sizeof(float)));
+    EXPECT_THROW(past_end->get_data_ptr(), ngraph_error);
+}
+
+TEST(constant_loader, deserialize_cpio)
+{
+    // The Constants of an archive deserialized from its path are read on first use
+    TempFile tmp_file("constant_loader.cpio");
+    Shape shape{2, 2};
+    auto A = make_shared<op::Parameter>(element::f32, shape);
+    auto B = op::Constant::create(element::f32, shape, {1, 2, 3, 4});
+    auto C = op::Constant::create(element::i32, Shape{3}, {5, 6, 7});
+    auto f = make_shared<Function>(NodeVector{make_shared<op::Add>(A, B), C}, ParameterVector{A});
+    serialize_to_cpio(tmp_file.get_path(), f);
+
+    auto g = deserialize(tmp_file.get_path());
+    ASSERT_NE(g, nullptr);
+    auto add = g->get_results().at(0)->get_argument(0);
+    auto b = as_type_ptr<op::Constant>(add->get_argument(1));
+    auto c = as_type_ptr<op::Constant>(g->get_results().at(1)->get_argument(0));
+    ASSERT_TRUE(b);
+    ASSERT_TRUE(c);
+    EXPECT_FALSE(b->is_loaded());
+    EXPECT_FALSE(c->is_loaded());
+
+    EXPECT_EQ((vector<float>{1, 2, 3, 4}), b->get_vector<float>());
+    EXPECT_TRUE(b->is_loaded());
+    EXPECT_FALSE(c->is_loaded());
+    EXPECT_EQ((vector<int32_t>{5, 6, 7}), c->get_vector<int32_t>());
+    EXPECT_TRUE(c->is_loaded());
+}
+
+TEST(constant_loader, loader_too_small)
+{
+    EXPECT_ANY_THROW(make_shared<op::Constant>(
+        element::f32, Shape{8}, make_shared<VectorLoader>(vector<float>{1, 2, 3, 4})));
+}
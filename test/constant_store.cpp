@@ -0,0 +1,206 @@
+//*****************************************************************************
+// Copyright 2017-2019 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#include <cstring>
+
+#ifndef _WIN32
+#include <sys/wait.h>
+#include <unistd.h>
+#endif
+
+#include "gtest/gtest.h"
+
+#include "ngraph/ngraph.hpp"
+#include "ngraph/runtime/constant_store.hpp"
+
+using namespace std;
+using namespace ngraph;
+
+namespace
+{
+    // The store is process wide, restore its state so other tests are not affected
+    class ConstantStoreScope
+    {
+    public:
+        ConstantStoreScope(const string& prefix = "")
+            : m_enabled(runtime::ConstantStore::get().is_enabled())
+            , m_prefix(runtime::ConstantStore::get().get_shared_memory_prefix())
+        {
+            runtime::ConstantStore::get().set_enabled(true);
+            runtime::ConstantStore::get().set_shared_memory_prefix(prefix);
+            runtime::ConstantStore::get().reset_stats();
+        }
+        ~ConstantStoreScope()
+        {
+            runtime::ConstantStore::get().remove_shared_memory_segments();
+            runtime::ConstantStore::get().set_enabled(m_enabled);
+            runtime::ConstantStore::get().set_shared_memory_prefix(m_prefix);
+        }
+
+    private:
+        bool m_enabled;
+        string m_prefix;
+    };
+
+    // Exposes the protected write path, like the Constant subclasses that fill their data
+    class WritableConstant : public op::Constant
+    {
+    public:
+        WritableConstant(const element::Type& type, const Shape& shape, const void* data)
+            : Constant(type, shape, data)
+        {
+        }
+        template <typename T>
+        void write(const vector<T>& values)
+        {
+            write_values(values);
+        }
+    };
+}
+
+TEST(constant_store, identical_constants_share_data)
+{
+    ConstantStoreScope scope;
+    vector<float> values(1000);
+    for (size_t i = 0; i < values.size(); i++)
+    {
+        values[i] = i * 0.5f;
+    }
+    auto c1 = op::Constant::create(element::f32, Shape{10, 100}, values);
+    auto c2 = op::Constant::create(element::f32, Shape{10, 100}, values);
+    auto c3 = make_shared<op::Constant>(element::f32, Shape{1000}, values.data());
+    values[999] = -1;
+    auto c4 = op::Constant::create(element::f32, Shape{10, 100}, values);
+
+    EXPECT_EQ(c1->get_data_ptr(), c2->get_data_ptr());
+    EXPECT_EQ(c1->get_data_ptr(), c3->get_data_ptr());
+    EXPECT_NE(c1->get_data_ptr(), c4->get_data_ptr());
+    EXPECT_EQ(c4->get_vector<float>()[999], -1);
+
+    auto stats = runtime::ConstantStore::get().get_stats();
+    EXPECT_EQ(stats.lookups, 4);
+    EXPECT_EQ(stats.hits, 2);
+    EXPECT_EQ(stats.bytes_deduplicated, 2 * 1000 * sizeof(float));
+}
+
+TEST(constant_store, clones_share_data)
+{
+    ConstantStoreScope scope;
+    auto A = make_shared<op::Parameter>(element::f32, Shape{2, 2});
+    auto C = op::Constant::create(element::f32, Shape{2, 2}, {1, 2, 3, 4});
+    auto f = make_shared<Function>(make_shared<op::Add>(A, C), ParameterVector{A});
+    auto g = clone_function(*f);
+
+    for (auto node : g->get_ops())
+    {
+        if (auto constant = as_type_ptr<op::Constant>(node))
+        {
+            EXPECT_EQ(constant->get_data_ptr(), C->get_data_ptr());
+        }
+    }
+}
+
+TEST(constant_store, buffers_released_with_last_constant)
+{
+    ConstantStoreScope scope;
+    size_t before = runtime::ConstantStore::get().get_buffer_count();
+    {
+        auto c1 = op::Constant::create(element::i64, Shape{3}, {1234567, 7654321, 42});
+        auto c2 = op::Constant::create(element::i64, Shape{3}, {1234567, 7654321, 42});
+        EXPECT_EQ(runtime::ConstantStore::get().get_buffer_count(), before + 1);
+    }
+    EXPECT_EQ(runtime::ConstantStore::get().get_buffer_count(), before);
+}
+
+#ifndef _WIN32
+TEST(constant_store, shared_memory)
+{
+    ConstantStoreScope scope("ngraph_test_" + to_string(getpid()));
+    vector<int32_t> values{1, 2, 3, 4, 5, 6, 7, 8};
+    auto c1 = op::Constant::create(element::i32, Shape{8}, values);
+    auto c2 = op::Constant::create(element::i32, Shape{2, 4}, values);
+
+    EXPECT_EQ(c1->get_data_ptr(), c2->get_data_ptr());
+    EXPECT_EQ(c1->get_vector<int32_t>(), values);
+    size_t segments = runtime::ConstantStore::get().get_stats().shared_memory_segments;
+    // Shared memory may be unavailable in a sandbox, in which case private memory is used
+    if (segments == 0)
+    {
+        return;
+    }
+    EXPECT_EQ(segments, 1);
+
+    // A second process drops its copies of the Constants, so it cannot reuse the parent's
+    // mapping. The segment already exists, so the store can only count a new one by mapping
+    // it rather than publishing its own.
+    pid_t child = fork();
+    ASSERT_GE(child, 0);
+    if (child == 0)
+    {
+        c1.reset();
+        c2.reset();
+        auto c3 = op::Constant::create(element::i32, Shape{8}, values);
+        bool mapped = runtime::ConstantStore::get().get_stats().shared_memory_segments == 2 &&
+                      c3->get_vector<int32_t>() == values;
+        _exit(mapped ? 0 : 1);
+    }
+    int status = 0;
+    ASSERT_EQ(waitpid(child, &status, 0), child);
+    ASSERT_TRUE(WIFEXITED(status));
+    EXPECT_EQ(WEXITSTATUS(status), 0);
+}
+
+TEST(constant_store, write_to_shared_memory_constant)
+{
+    ConstantStoreScope scope("ngraph_test_" + to_string(getpid()));
+    vector<int32_t> values{1, 2, 3, 4, 5, 6, 7, 8};
+    auto c1 = make_shared<WritableConstant>(element::i32, Shape{8}, values.data());
+    const void* interned = c1->get_data_ptr();
+
+    // c1 is the only owner of a buffer the store may hand out again, and that may be a
+    // read-only mapping, so the write has to go to a copy
+    vector<int32_t> written{8, 7, 6, 5, 4, 3, 2, 1};
+    c1->write(written);
+    EXPECT_NE(c1->get_data_ptr(), interned);
+    EXPECT_EQ(c1->get_vector<int32_t>(), written);
+
+    // Written data is private, a second write reuses the copy
+    const void* copy = c1->get_data_ptr();
+    c1->write(values);
+    EXPECT_EQ(c1->get_data_ptr(), copy);
+
+    auto c2 = op::Constant::create(element::i32, Shape{8}, written);
+    EXPECT_EQ(c2->get_vector<int32_t>(), written);
+}
+#endif
+
+TEST(constant_store, write_to_interned_constant)
+{
+    ConstantStoreScope scope;
+    vector<int64_t> values{10, 20, 30};
+    auto c1 = make_shared<WritableConstant>(element::i64, Shape{3}, values.data());
+    auto c2 = op::Constant::create(element::i64, Shape{3}, values);
+    ASSERT_EQ(c1->get_data_ptr(), c2->get_data_ptr());
+
+    c1->write(vector<int64_t>{1, 2, 3});
+    EXPECT_EQ(c1->get_vector<int64_t>(), (vector<int64_t>{1, 2, 3}));
+    EXPECT_EQ(c2->get_vector<int64_t>(), values);
+
+    // The store still hands out the original bytes
+    c2.reset();
+    auto c3 = op::Constant::create(element::i64, Shape{3}, values);
+    EXPECT_EQ(c3->get_vector<int64_t>(), values);
+}
@@ -143,6 +143,34 @@ TEST(copy, constant)
     ASSERT_TRUE(node_cast->get_element_type() == et);
 }
 
+namespace
+{
+    class WritableConstant : public op::Constant
+    {
+    public:
+        using op::Constant::Constant;
+        void* get_writable_data() { return get_data_ptr_nc(); }
+    };
+}
+
+TEST(copy, constant_shares_data)
+{
+    auto node = make_shared<WritableConstant>(element::f32, Shape{4}, vector<float>{1, 2, 3, 4});
+    auto new_node = as_type_ptr<op::Constant>(node->copy_with_new_args(NodeVector{}));
+    ASSERT_NE(new_node, nullptr);
+    EXPECT_EQ(new_node->get_data_ptr(), node->get_data_ptr());
+
+    // Writing copies the shared data first, the copy keeps the original values
+    float* data = static_cast<float*>(node->get_writable_data());
+    data[0] = 10;
+    EXPECT_NE(new_node->get_data_ptr(), node->get_data_ptr());
+    EXPECT_EQ(node->get_vector<float>(), (vector<float>{10, 2, 3, 4}));
+    EXPECT_EQ(new_node->get_vector<float>(), (vector<float>{1, 2, 3, 4}));
+
+    // Unshared data is written in place
+    EXPECT_EQ(node->get_writable_data(), data);
+}
+
 TEST(copy, convert)
 {
     Shape shape;
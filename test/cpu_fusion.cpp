@@ -77,6 +77,7 @@
 #include "ngraph/runtime/cpu/op/sigmoid_mul.hpp"
 #include "ngraph/runtime/cpu/op/update_slice.hpp"
 #include "ngraph/runtime/cpu/pass/cpu_fusion.hpp"
+#include "ngraph/runtime/cpu/pass/cpu_horizontal_fusion.hpp"
 #include "ngraph/runtime/cpu/pass/cpu_mat_fusion.hpp"
 #include "ngraph/runtime/cpu/pass/cpu_post_layout_optimizations.hpp"
 #include "ngraph/runtime/cpu/pass/cpu_rnn_fusion.hpp"
@@ -994,6 +995,111 @@ TEST(cpu_fusion, conv_horizontal_fusion)
     ASSERT_EQ(cpu_cb, 1);
 }
 
+TEST(cpu_fusion, dot_horizontal_fusion)
+{
+    // Query, key and value projections of the same activations, the fused output of a single
+    // row is sliced into contiguous column blocks
+    auto make_function = []() {
+        auto X = std::make_shared<op::Parameter>(element::f32, Shape{1, 3});
+        ParameterVector params{X};
+        NodeVector projections;
+        for (size_t n : {2, 5, 1})
+        {
+            auto W = std::make_shared<op::Parameter>(element::f32, Shape{3, n});
+            auto b = std::make_shared<op::Parameter>(element::f32, Shape{n});
+            auto dot = std::make_shared<op::Dot>(X, W);
+            auto bias = std::make_shared<op::Broadcast>(b, dot->get_shape(), AxisSet{0});
+            projections.push_back(std::make_shared<op::Relu>(dot + bias));
+            params.push_back(W);
+            params.push_back(b);
+        }
+        return make_shared<Function>(projections, params);
+    };
+    auto int_f = make_function();
+    auto cpu_f = make_function();
+
+    test::Uniform<float> rng(-1.0f, 1.0f);
+    vector<vector<float>> args;
+    for (shared_ptr<op::Parameter> param : int_f->get_parameters())
+    {
+        vector<float> tensor_val(shape_size(param->get_shape()));
+        rng.initialize(tensor_val);
+        args.push_back(tensor_val);
+    }
+    auto int_results = execute(int_f, args, "INTERPRETER");
+    auto cpu_results = execute(cpu_f, args, "CPU");
+    for (size_t i = 0; i < cpu_results.size(); i++)
+    {
+        EXPECT_TRUE(test::all_close(cpu_results.at(i), int_results.at(i)));
+    }
+    ASSERT_EQ(count_ops_of_type<op::MatmulBias>(cpu_f), 1);
+}
+
+TEST(cpu_fusion, dot_horizontal_fusion_shared_rhs)
+{
+    // The weights come first, the fused output is sliced along its leading axis
+    auto make_function = []() {
+        auto X = std::make_shared<op::Parameter>(element::f32, Shape{3, 2, 4});
+        auto W1 = std::make_shared<op::Parameter>(element::f32, Shape{2, 3});
+        auto W2 = std::make_shared<op::Parameter>(element::f32, Shape{6, 3});
+        auto dot1 = std::make_shared<op::Dot>(W1, X);
+        auto dot2 = std::make_shared<op::Dot>(W2, X);
+        return make_shared<Function>(NodeVector{std::make_shared<op::Abs>(dot1), dot2},
+                                     ParameterVector{X, W1, W2});
+    };
+    auto int_f = make_function();
+    auto cpu_f = make_function();
+
+    test::Uniform<float> rng(-1.0f, 1.0f);
+    vector<vector<float>> args;
+    for (shared_ptr<op::Parameter> param : int_f->get_parameters())
+    {
+        vector<float> tensor_val(shape_size(param->get_shape()));
+        rng.initialize(tensor_val);
+        args.push_back(tensor_val);
+    }
+    auto int_results = execute(int_f, args, "INTERPRETER");
+    auto cpu_results = execute(cpu_f, args, "CPU");
+    for (size_t i = 0; i < cpu_results.size(); i++)
+    {
+        EXPECT_TRUE(test::all_close(cpu_results.at(i), int_results.at(i)));
+    }
+    ASSERT_EQ(count_ops_of_type<op::Dot>(cpu_f), 1);
+}
+
+TEST(cpu_fusion, dot_horizontal_fusion_strided_slices)
+{
+    // The column blocks of a fused output with several rows would be copied out
+    auto X = std::make_shared<op::Parameter>(element::f32, Shape{4, 3});
+    auto W1 = std::make_shared<op::Parameter>(element::f32, Shape{3, 2});
+    auto W2 = std::make_shared<op::Parameter>(element::f32, Shape{3, 5});
+    auto dot1 = std::make_shared<op::Dot>(X, W1);
+    auto dot2 = std::make_shared<op::Dot>(X, W2);
+    auto f = make_shared<Function>(NodeVector{dot1, dot2}, ParameterVector{X, W1, W2});
+
+    pass::Manager pass_manager;
+    pass_manager.register_pass<runtime::cpu::pass::CPUHorizontalFusion>();
+    pass_manager.run_passes(f);
+    ASSERT_EQ(count_ops_of_type<op::Dot>(f), 2);
+    ASSERT_EQ(count_ops_of_type<op::Concat>(f), 0);
+}
+
+TEST(cpu_fusion, dot_horizontal_fusion_dependent_weights)
+{
+    // The weights of the second Dot are computed by the first one, they cannot be fused
+    auto X = std::make_shared<op::Parameter>(element::f32, Shape{3, 3});
+    auto W = std::make_shared<op::Parameter>(element::f32, Shape{3, 3});
+    auto dot1 = std::make_shared<op::Dot>(W, X);
+    auto dot2 = std::make_shared<op::Dot>(dot1, X);
+    auto f = make_shared<Function>(NodeVector{dot1, dot2}, ParameterVector{X, W});
+
+    pass::Manager pass_manager;
+    pass_manager.register_pass<runtime::cpu::pass::CPUHorizontalFusion>();
+    pass_manager.run_passes(f);
+    ASSERT_EQ(count_ops_of_type<op::Dot>(f), 2);
+    ASSERT_EQ(count_ops_of_type<op::Concat>(f), 0);
+}
+
 // ConvolutionBiasAdd relies on an in-place fused MKLDNN kernel.
 // Need to ensure that it is fused only when in-place buffer allocation is feasible
 shared_ptr<Function> gen_conv_bias_add(bool param_input, bool result_output)
@@ -16,6 +16,7 @@
 
 #include <algorithm>
 #include <cstdio>
+#include <cstring>
 #include <iostream>
 #include <list>
 #include <memory>
@@ -24,6 +25,7 @@
 #include "gtest/gtest.h"
 #include "misc.hpp"
 #include "ngraph/autodiff/adjoints.hpp"
+#include "ngraph/distributed.hpp"
 #include "ngraph/file_util.hpp"
 #include "ngraph/graph_util.hpp"
 #include "ngraph/log.hpp"
@@ -40,9 +42,13 @@
 #include "ngraph/runtime/cpu/cpu_backend.hpp"
 #include "ngraph/runtime/cpu/cpu_builder.hpp"
 #include "ngraph/runtime/cpu/cpu_tensor_view.hpp"
+#include "ngraph/runtime/cpu/kernel/reduce_generic.hpp"
 #include "ngraph/runtime/cpu/mkldnn_utils.hpp"
 #include "ngraph/runtime/cpu/op/convert_layout.hpp"
 #include "ngraph/runtime/cpu/op/max_pool_with_indices.hpp"
+#include "ngraph/runtime/reference/argmax.hpp"
+#include "ngraph/runtime/reference/max.hpp"
+#include "ngraph/runtime/reference/sum.hpp"
 #include "ngraph/serializer.hpp"
 #include "ngraph/util.hpp"
 #include "util/all_close.hpp"
@@ -279,6 +285,89 @@ TEST(cpu_test, MLIR_DISABLE_TEST(reshape_layout_optimizations1))
     }
 }
 
+TEST(cpu_test, MLIR_DISABLE_TEST(shared_layout_conversion))
+{
+    // Both users of the convolution need its output in the native layout
+    auto make_function = []() -> std::shared_ptr<Function> {
+        auto A = make_shared<op::Parameter>(element::f32, Shape{1, 16, 2, 2});
+        auto B = make_shared<op::Parameter>(element::f32, Shape{32, 16, 1, 1});
+        auto conv = make_shared<op::Convolution>(A,
+                                                 B,
+                                                 Strides{1, 1},
+                                                 Strides{1, 1},
+                                                 CoordinateDiff{0, 0},
+                                                 CoordinateDiff{0, 0},
+                                                 Strides{1, 1});
+        auto sum1 = make_shared<op::Sum>(conv, AxisSet{1});
+        auto sum2 = make_shared<op::Sum>(conv, AxisSet{2, 3});
+        return make_shared<Function>(NodeVector{sum1, sum2}, ParameterVector{A, B});
+    };
+
+    auto cpu_f = make_function();
+    auto int_f = make_function();
+
+    test::Uniform<float> rng(-100.0f, 100.0f);
+    vector<vector<float>> args;
+    for (shared_ptr<op::Parameter> param : cpu_f->get_parameters())
+    {
+        vector<float> tensor_val(shape_size(param->get_shape()));
+        rng.initialize(tensor_val);
+        args.push_back(tensor_val);
+    }
+    auto int_results = execute(int_f, args, "INTERPRETER");
+    auto cpu_results = execute(cpu_f, args, "CPU");
+    // Two convert layouts for inputs and weights of convolution.
+    // One convert layout after convolution, shared by both sums
+    EXPECT_EQ(count_ops_of_type<runtime::cpu::op::ConvertLayout>(cpu_f), 3);
+    for (size_t i = 0; i < cpu_results.size(); i++)
+    {
+        EXPECT_TRUE(test::all_close(cpu_results.at(i), int_results.at(i), 1.0e-4f, 1.0e-4f));
+    }
+}
+
+TEST(cpu_test, MLIR_DISABLE_TEST(planned_eltwise_layout))
+{
+    // The add and relu run in the native layout, so the convolution output is reordered once.
+    // Keeping its MKLDNN layout would reorder both P and the relu output.
+    auto make_function = []() -> std::shared_ptr<Function> {
+        auto A = make_shared<op::Parameter>(element::f32, Shape{1, 16, 2, 2});
+        auto B = make_shared<op::Parameter>(element::f32, Shape{32, 16, 1, 1});
+        auto P = make_shared<op::Parameter>(element::f32, Shape{1, 32, 2, 2});
+        auto conv = make_shared<op::Convolution>(A,
+                                                 B,
+                                                 Strides{1, 1},
+                                                 Strides{1, 1},
+                                                 CoordinateDiff{0, 0},
+                                                 CoordinateDiff{0, 0},
+                                                 Strides{1, 1});
+        auto add = make_shared<op::Add>(conv, P);
+        auto relu = make_shared<op::Relu>(add);
+        auto sum = make_shared<op::Sum>(relu, AxisSet{1});
+        return make_shared<Function>(NodeVector{sum}, ParameterVector{A, B, P});
+    };
+
+    auto cpu_f = make_function();
+    auto int_f = make_function();
+
+    test::Uniform<float> rng(-100.0f, 100.0f);
+    vector<vector<float>> args;
+    for (shared_ptr<op::Parameter> param : cpu_f->get_parameters())
+    {
+        vector<float> tensor_val(shape_size(param->get_shape()));
+        rng.initialize(tensor_val);
+        args.push_back(tensor_val);
+    }
+    auto int_results = execute(int_f, args, "INTERPRETER");
+    auto cpu_results = execute(cpu_f, args, "CPU");
+    // Two convert layouts for inputs and weights of convolution.
+    // One convert layout after convolution
+    EXPECT_EQ(count_ops_of_type<runtime::cpu::op::ConvertLayout>(cpu_f), 3);
+    for (size_t i = 0; i < cpu_results.size(); i++)
+    {
+        EXPECT_TRUE(test::all_close(cpu_results.at(i), int_results.at(i), 1.0e-4f, 1.0e-4f));
+    }
+}
+
 TEST(cpu_test, MLIR_DISABLE_TEST(reshape_layout_optimizations2))
 {
     // ExpandDims - inner most and internal dims
@@ -2339,3 +2428,567 @@ TEST(cpu_test, one_hot_scalar_oob_in_3)
     handle->call_with_validate({result}, {a});
     EXPECT_EQ(r_data[3], 0);
 }
+
+TEST(cpu_test, reduce_non_contiguous_axes)
+{
+    Shape shape{2, 30, 8, 20, 4};
+    AxisSet axes{0, 2, 4};
+    auto make_function = [&]() -> std::shared_ptr<Function> {
+        auto A = make_shared<op::Parameter>(element::f32, shape);
+        return make_shared<Function>(NodeVector{make_shared<op::Sum>(A, axes),
+                                                make_shared<op::Max>(A, axes),
+                                                make_shared<op::Min>(A, axes),
+                                                make_shared<op::Product>(A, axes)},
+                                     ParameterVector{A});
+    };
+
+    test::Uniform<float> rng(0.999f, 1.001f);
+    vector<vector<float>> args;
+    vector<float> tensor_val(shape_size(shape));
+    rng.initialize(tensor_val);
+    args.push_back(tensor_val);
+    auto int_results = execute(make_function(), args, "INTERPRETER");
+    auto cpu_results = execute(make_function(), args, "CPU");
+    for (size_t i = 0; i < cpu_results.size(); i++)
+    {
+        EXPECT_TRUE(test::all_close(cpu_results.at(i), int_results.at(i), 1.0e-4f, 1.0e-4f));
+    }
+}
+
+TEST(cpu_test, reduce_generic_index_and_logical)
+{
+    Shape shape{3, 70, 5};
+    auto A = make_shared<op::Parameter>(element::i8, shape);
+    auto B = make_shared<op::Parameter>(element::boolean, shape);
+    auto f = make_shared<Function>(NodeVector{make_shared<op::ArgMax>(A, 1, element::i32),
+                                              make_shared<op::ArgMin>(A, 2, element::i64),
+                                              make_shared<op::Any>(B, AxisSet{0, 2}),
+                                              make_shared<op::All>(B, AxisSet{1})},
+                                   ParameterVector{A, B});
+
+    vector<int8_t> a(shape_size(shape));
+    vector<char> b(shape_size(shape));
+    for (size_t i = 0; i < a.size(); i++)
+    {
+        a[i] = static_cast<int8_t>((i * 37) % 11);
+        b[i] = (i % 13) != 0;
+    }
+
+    auto backend = runtime::Backend::create("CPU");
+    auto int_backend = runtime::Backend::create("INTERPRETER");
+    vector<vector<char>> results(2);
+    vector<vector<int32_t>> argmax_results(2);
+    vector<vector<int64_t>> argmin_results(2);
+    vector<vector<char>> all_results(2);
+    size_t i = 0;
+    for (auto& be : {backend, int_backend})
+    {
+        auto ta = be->create_tensor(element::i8, shape);
+        auto tb = be->create_tensor(element::boolean, shape);
+        copy_data(ta, a);
+        copy_data(tb, b);
+        auto r0 = be->create_tensor(element::i32, Shape{3, 5});
+        auto r1 = be->create_tensor(element::i64, Shape{3, 70});
+        auto r2 = be->create_tensor(element::boolean, Shape{70});
+        auto r3 = be->create_tensor(element::boolean, Shape{3, 5});
+        auto handle = be->compile(f);
+        handle->call_with_validate({r0, r1, r2, r3}, {ta, tb});
+        argmax_results[i] = read_vector<int32_t>(r0);
+        argmin_results[i] = read_vector<int64_t>(r1);
+        results[i] = read_vector<char>(r2);
+        all_results[i] = read_vector<char>(r3);
+        i++;
+    }
+    EXPECT_EQ(argmax_results[0], argmax_results[1]);
+    EXPECT_EQ(argmin_results[0], argmin_results[1]);
+    EXPECT_EQ(results[0], results[1]);
+    EXPECT_EQ(all_results[0], all_results[1]);
+}
+
+TEST(cpu_test, reduce_generic_accuracy)
+{
+    using runtime::cpu::kernel::ReductionAccuracy;
+    auto accuracy = runtime::cpu::kernel::get_reduction_accuracy();
+
+    // Small addends are lost when naively added to a large partial sum
+    vector<float> data(1 << 16, 0.1f);
+    data[0] = 1.0e7f;
+    double expected = 1.0e7 + 0.1 * (data.size() - 1);
+    for (auto mode :
+         {ReductionAccuracy::fast, ReductionAccuracy::pairwise, ReductionAccuracy::kahan})
+    {
+        runtime::cpu::kernel::set_reduction_accuracy(mode);
+        float sum = 0;
+        runtime::cpu::kernel::reduce_sum_generic<float>(
+            data.data(), &sum, Shape{data.size()}, AxisSet{0}, 0);
+        double tolerance = mode == ReductionAccuracy::fast ? 1.0e-4 : 1.0e-6;
+        EXPECT_NEAR(sum, expected, expected * tolerance);
+    }
+    runtime::cpu::kernel::set_reduction_accuracy(accuracy);
+}
+
+TEST(cpu_test, reduce_generic_split_reduction)
+{
+    namespace reduction = runtime::cpu::kernel::reduction;
+    // A pool of five threads and few outputs, so every reduction below splits its reduce loop
+    // into five chunks and merges them with an unpaired chunk left over at each tree level
+    const size_t threads = 5;
+    Eigen::ThreadPool pool(threads);
+    Eigen::ThreadPoolDevice device(&pool, threads);
+    size_t length = threads * reduction::s_min_chunk + 123;
+
+    // The reduced axis innermost, and outermost
+    vector<pair<Shape, size_t>> cases{{Shape{3, length}, 1}, {Shape{length, 2}, 0}};
+    for (auto& c : cases)
+    {
+        Shape shape = c.first;
+        AxisSet axes{c.second};
+        Shape out_shape = reduce(shape, axes);
+        runtime::cpu::kernel::ReductionPlan plan(shape, axes);
+        ASSERT_LT(shape_size(out_shape), threads);
+        ASSERT_EQ(plan.reduce_count / reduction::s_min_chunk, threads);
+
+        // Maxima repeat in every chunk, the first one has to win the merge
+        vector<int32_t> data(shape_size(shape));
+        vector<float> float_data(data.size());
+        for (size_t i = 0; i < data.size(); i++)
+        {
+            data[i] = static_cast<int32_t>((i * 7919) % 1000) - 500;
+            float_data[i] = data[i] * 0.25f;
+        }
+
+        vector<int32_t> sum(shape_size(out_shape));
+        vector<int32_t> expected_sum(sum.size());
+        reduction::reduce<reduction::FoldReduction<int32_t, reduction::Sum<int32_t>, false>,
+                          int32_t>(data.data(), sum.data(), plan, device);
+        runtime::reference::sum(data.data(), expected_sum.data(), shape, out_shape, axes);
+        EXPECT_EQ(sum, expected_sum);
+
+        vector<int32_t> max(shape_size(out_shape));
+        vector<int32_t> expected_max(max.size());
+        reduction::reduce<reduction::FoldReduction<int32_t, reduction::Max<int32_t>, false>,
+                          int32_t>(data.data(), max.data(), plan, device);
+        runtime::reference::max(data.data(), expected_max.data(), shape, out_shape, axes);
+        EXPECT_EQ(max, expected_max);
+
+        vector<int64_t> argmax(shape_size(out_shape));
+        vector<int64_t> expected_argmax(argmax.size());
+        reduction::reduce<reduction::ArgReduction<int32_t, reduction::Greater<int32_t>>,
+                          int64_t>(data.data(), argmax.data(), plan, device);
+        runtime::reference::argmax(
+            data.data(), expected_argmax.data(), shape, out_shape, c.second);
+        EXPECT_EQ(argmax, expected_argmax);
+
+        vector<float> float_sum(shape_size(out_shape));
+        vector<float> expected_float_sum(float_sum.size());
+        reduction::reduce<reduction::KahanSumReduction<float>, float>(
+            float_data.data(), float_sum.data(), plan, device);
+        runtime::reference::sum(
+            float_data.data(), expected_float_sum.data(), shape, out_shape, axes);
+        EXPECT_TRUE(test::all_close_f(float_sum, expected_float_sum));
+    }
+}
+
+namespace
+{
+    // Installs a distributed interface and restores the previous one, even if a test fails
+    class DistributedInterfaceScope
+    {
+    public:
+        DistributedInterfaceScope(DistributedInterface* distributed_interface)
+            : m_previous(set_distributed_interface(
+                  unique_ptr<DistributedInterface>(distributed_interface)))
+        {
+        }
+        ~DistributedInterfaceScope() { set_distributed_interface(move(m_previous)); }
+
+    private:
+        unique_ptr<DistributedInterface> m_previous;
+    };
+
+    // A group of one rank whose all-reduces only read their input and write their output when
+    // they are waited for
+    class DeferredDistributedInterface : public DistributedInterface
+    {
+    public:
+        class Request : public DistributedRequest
+        {
+        public:
+            Request(const void* in, void* out, size_t byte_size, size_t& pending)
+                : m_in(in)
+                , m_out(out)
+                , m_byte_size(byte_size)
+                , m_pending(pending)
+            {
+                m_pending++;
+            }
+
+            void wait() override
+            {
+                if (m_out)
+                {
+                    memmove(m_out, m_in, m_byte_size);
+                    m_out = nullptr;
+                    m_pending--;
+                }
+            }
+
+        private:
+            const void* m_in;
+            void* m_out;
+            size_t m_byte_size;
+            size_t& m_pending;
+        };
+
+        const string& get_name() const override { return m_name; }
+        int get_size() override { return 1; }
+        int get_rank() override { return 0; }
+        void log_print(const string& timestamp, const vector<char>& buf) override
+        {
+            printf("%s: %s\n", timestamp.c_str(), buf.data());
+        }
+        void all_reduce(void* in,
+                        void* out,
+                        element::Type_t element_type,
+                        reduction::Type reduce_type,
+                        size_t count) override
+        {
+            all_reduce_async(in, out, element_type, reduce_type, count)->wait();
+        }
+        void broadcast(void*, element::Type_t, size_t, int) override {}
+        void recv(void*, element::Type_t, size_t, int) override
+        {
+            throw ngraph_error("recv is not supported");
+        }
+        void send(const void*, element::Type_t, size_t, int) override
+        {
+            throw ngraph_error("send is not supported");
+        }
+        shared_ptr<DistributedRequest> all_reduce_async(void* in,
+                                                        void* out,
+                                                        element::Type_t element_type,
+                                                        reduction::Type /* reduce_type */,
+                                                        size_t count) override
+        {
+            m_started++;
+            return make_shared<Request>(
+                in, out, count * element::Type(element_type).size(), m_pending);
+        }
+
+        size_t m_started = 0;
+        size_t m_pending = 0;
+
+    private:
+        string m_name{"Deferred"};
+    };
+}
+
+TEST(cpu_test, allreduce_async)
+{
+    auto comm = new DeferredDistributedInterface();
+    DistributedInterfaceScope scope(comm);
+
+    // Small gradients are bucketed, the last one is reduced on its own
+    vector<Shape> shapes{Shape{2, 3}, Shape{4}, Shape{}, Shape{5, 1}, Shape{1 << 23}};
+    ParameterVector weights;
+    NodeVector updates;
+    for (auto& shape : shapes)
+    {
+        auto weight = make_shared<op::Parameter>(element::f32, shape);
+        auto gradient = make_shared<op::Multiply>(weight, weight);
+        auto reduced = make_shared<op::AllReduce>(gradient);
+        updates.push_back(make_shared<op::Subtract>(weight, reduced));
+        weights.push_back(weight);
+    }
+    auto f = make_shared<Function>(updates, weights);
+
+    auto backend = runtime::Backend::create("CPU");
+    auto handle = backend->compile(f);
+    vector<shared_ptr<runtime::Tensor>> weight_tensors;
+    vector<shared_ptr<runtime::Tensor>> update_tensors;
+    for (auto& shape : shapes)
+    {
+        weight_tensors.push_back(backend->create_tensor(element::f32, shape));
+        update_tensors.push_back(backend->create_tensor(element::f32, shape));
+    }
+    for (float value : {2.0f, 3.0f})
+    {
+        for (size_t i = 0; i < shapes.size(); i++)
+        {
+            copy_data(weight_tensors[i], vector<float>(shape_size(shapes[i]), value));
+        }
+        handle->call_with_validate(update_tensors, weight_tensors);
+        for (size_t i = 0; i < shapes.size(); i++)
+        {
+            EXPECT_EQ(read_vector<float>(update_tensors[i]),
+                      vector<float>(shape_size(shapes[i]), value - value * value));
+        }
+        EXPECT_EQ(comm->m_pending, 0);
+    }
+    EXPECT_GT(comm->m_started, 0);
+}
+
+TEST(cpu_test, allreduce_async_reuse_memory)
+{
+    auto comm = new DeferredDistributedInterface();
+    DistributedInterfaceScope scope(comm);
+
+    // The input of the all-reduce is freed once it is started, and the sum written to its memory
+    // must wait for the all-reduce to have read it
+    Shape shape{16};
+    auto W = make_shared<op::Parameter>(element::f32, shape);
+    auto X = make_shared<op::Parameter>(element::f32, shape);
+    auto reduced = make_shared<op::AllReduce>(make_shared<op::Multiply>(W, W));
+    auto sum = make_shared<op::Add>(X, X);
+    sum->add_control_dependency(reduced);
+    auto f = make_shared<Function>(make_shared<op::Subtract>(reduced, sum), ParameterVector{W, X});
+
+    auto backend = runtime::Backend::create("CPU");
+    ngraph::pass::PassConfig pass_config;
+    pass_config.set_pass_attribute("CPUMemoryAssignment::ReuseMemory", true);
+    auto handle = backend->compile(f, pass_config);
+    auto w = backend->create_tensor(element::f32, shape);
+    auto x = backend->create_tensor(element::f32, shape);
+    auto result = backend->create_tensor(element::f32, shape);
+    copy_data(w, vector<float>(shape_size(shape), 3));
+    copy_data(x, vector<float>(shape_size(shape), 1));
+    handle->call_with_validate({result}, {w, x});
+    EXPECT_EQ(read_vector<float>(result), vector<float>(shape_size(shape), 7));
+    EXPECT_EQ(comm->m_pending, 0);
+}
+
+TEST(cpu_test, tensor_iterator)
+{
+    const size_t N = 2; // Batch size
+    const size_t L = 6; // Sequence length
+    const size_t I = 3; // Input size
+    const size_t H = 4; // Hidden size
+    auto X = make_shared<op::Parameter>(element::f32, Shape{N, L, I});
+    auto WX = make_shared<op::Parameter>(element::f32, Shape{I, H});
+    auto WH = make_shared<op::Parameter>(element::f32, Shape{H, H});
+    auto H_init = make_shared<op::Parameter>(element::f32, Shape{N, 1, H});
+
+    auto make_cell = [&](const Output<Node>& x,
+                         const Output<Node>& h,
+                         const Output<Node>& wx,
+                         const Output<Node>& wh) {
+        auto x_2d = make_shared<op::Reshape>(x, AxisVector{0, 1, 2}, Shape{N, I});
+        auto h_2d = make_shared<op::Reshape>(h, AxisVector{0, 1, 2}, Shape{N, H});
+        auto sum = make_shared<op::Dot>(x_2d, wx) + make_shared<op::Dot>(h_2d, wh);
+        return make_shared<op::Reshape>(
+            make_shared<op::Tanh>(sum), AxisVector{0, 1}, Shape{N, 1, H});
+    };
+
+    // The sequence is read backwards
+    auto X_i = make_shared<op::Parameter>(element::f32, Shape{N, 1, I});
+    auto H_i = make_shared<op::Parameter>(element::f32, Shape{N, 1, H});
+    auto WX_body = make_shared<op::Parameter>(element::f32, Shape{I, H});
+    auto WH_body = make_shared<op::Parameter>(element::f32, Shape{H, H});
+    auto H_o = make_cell(X_i, H_i, WX_body, WH_body);
+    auto body = make_shared<op::TensorIterator::BodyLambda>(
+        OutputVector{H_o}, ParameterVector{X_i, H_i, WX_body, WH_body});
+    auto tensor_iterator = make_shared<op::TensorIterator>();
+    tensor_iterator->set_body(body);
+    tensor_iterator->set_sliced_input(X_i, X, -1, -1, 1, 0, 1);
+    tensor_iterator->set_merged_input(H_i, H_init, H_o);
+    tensor_iterator->set_invariant_input(WX_body, WX);
+    tensor_iterator->set_invariant_input(WH_body, WH);
+    auto last = tensor_iterator->get_iter_value(H_o, -1);
+    auto all = tensor_iterator->get_concatenated_slices(H_o, 0, 1, 1, -1, 1);
+    auto ti_f = make_shared<Function>(OutputVector{last, all}, ParameterVector{X, H_init, WX, WH});
+
+    // The same recurrence unrolled
+    Output<Node> h = H_init;
+    NodeVector hidden_states;
+    for (size_t i = 0; i < L; i++)
+    {
+        auto x = make_shared<op::Slice>(X, Coordinate{0, L - 1 - i, 0}, Coordinate{N, L - i, I});
+        h = make_cell(x, h, WX, WH);
+        hidden_states.push_back(h.get_node_shared_ptr());
+    }
+    auto unrolled_f =
+        make_shared<Function>(OutputVector{h, make_shared<op::Concat>(hidden_states, 1)},
+                              ParameterVector{X, H_init, WX, WH});
+
+    test::Uniform<float> rng(-1.0f, 1.0f);
+    vector<vector<float>> args;
+    for (shared_ptr<op::Parameter> param : unrolled_f->get_parameters())
+    {
+        vector<float> tensor_val(shape_size(param->get_shape()));
+        rng.initialize(tensor_val);
+        args.push_back(tensor_val);
+    }
+    auto int_results = execute(unrolled_f, args, "INTERPRETER");
+    auto cpu_results = execute(ti_f, args, "CPU");
+    for (size_t i = 0; i < cpu_results.size(); i++)
+    {
+        EXPECT_TRUE(test::all_close(cpu_results.at(i), int_results.at(i), 1.0e-5f, 1.0e-5f));
+    }
+}
+
+// Ops of the body that only depend on invariant inputs run on the first iteration only
+TEST(cpu_test, tensor_iterator_invariant_ops)
+{
+    const size_t N = 2; // Batch size
+    const size_t L = 5; // Sequence length
+    const size_t I = 3; // Input size
+    const size_t H = 4; // Hidden size
+    auto X = make_shared<op::Parameter>(element::f32, Shape{N, L, I});
+    auto WX = make_shared<op::Parameter>(element::f32, Shape{I, H});
+    auto WH = make_shared<op::Parameter>(element::f32, Shape{H, H});
+    auto H_init = make_shared<op::Parameter>(element::f32, Shape{N, 1, H});
+
+    auto make_cell = [&](const Output<Node>& x,
+                         const Output<Node>& h,
+                         const Output<Node>& wx,
+                         const Output<Node>& wh) {
+        auto x_2d = make_shared<op::Reshape>(x, AxisVector{0, 1, 2}, Shape{N, I});
+        auto h_2d = make_shared<op::Reshape>(h, AxisVector{0, 1, 2}, Shape{N, H});
+        // Both weights only depend on invariant inputs
+        auto wxh = make_shared<op::Dot>(wx, wh);
+        auto wh_half =
+            make_shared<op::Multiply>(wh, op::Constant::create(element::f32, Shape{H, H}, {0.5f}));
+        auto sum = make_shared<op::Dot>(x_2d, wxh) + make_shared<op::Dot>(h_2d, wh_half);
+        return make_shared<op::Reshape>(
+            make_shared<op::Tanh>(sum), AxisVector{0, 1}, Shape{N, 1, H});
+    };
+
+    auto X_i = make_shared<op::Parameter>(element::f32, Shape{N, 1, I});
+    auto H_i = make_shared<op::Parameter>(element::f32, Shape{N, 1, H});
+    auto WX_body = make_shared<op::Parameter>(element::f32, Shape{I, H});
+    auto WH_body = make_shared<op::Parameter>(element::f32, Shape{H, H});
+    auto H_o = make_cell(X_i, H_i, WX_body, WH_body);
+    auto body = make_shared<op::TensorIterator::BodyLambda>(
+        OutputVector{H_o}, ParameterVector{X_i, H_i, WX_body, WH_body});
+    auto tensor_iterator = make_shared<op::TensorIterator>();
+    tensor_iterator->set_body(body);
+    tensor_iterator->set_sliced_input(X_i, X, 0, 1, 1, -1, 1);
+    tensor_iterator->set_merged_input(H_i, H_init, H_o);
+    tensor_iterator->set_invariant_input(WX_body, WX);
+    tensor_iterator->set_invariant_input(WH_body, WH);
+    auto all = tensor_iterator->get_concatenated_slices(H_o, 0, 1, 1, -1, 1);
+    auto ti_f = make_shared<Function>(OutputVector{all}, ParameterVector{X, H_init, WX, WH});
+
+    Output<Node> h = H_init;
+    NodeVector hidden_states;
+    for (size_t i = 0; i < L; i++)
+    {
+        auto x = make_shared<op::Slice>(X, Coordinate{0, i, 0}, Coordinate{N, i + 1, I});
+        h = make_cell(x, h, WX, WH);
+        hidden_states.push_back(h.get_node_shared_ptr());
+    }
+    auto unrolled_f = make_shared<Function>(OutputVector{make_shared<op::Concat>(hidden_states, 1)},
+                                            ParameterVector{X, H_init, WX, WH});
+
+    test::Uniform<float> rng(-1.0f, 1.0f);
+    vector<vector<float>> args;
+    for (shared_ptr<op::Parameter> param : unrolled_f->get_parameters())
+    {
+        vector<float> tensor_val(shape_size(param->get_shape()));
+        rng.initialize(tensor_val);
+        args.push_back(tensor_val);
+    }
+    auto reuse_f = clone_function(*ti_f);
+    auto int_results = execute(unrolled_f, args, "INTERPRETER");
+    auto cpu_results = execute(ti_f, args, "CPU");
+    EXPECT_TRUE(test::all_close(cpu_results.at(0), int_results.at(0), 1.0e-5f, 1.0e-5f));
+
+    // The body is compiled with the pass config of the function. When it reuses memory, the
+    // outputs of the ops that only run on the first iteration must not be overwritten.
+    auto backend = runtime::Backend::create("CPU");
+    ngraph::pass::PassConfig pass_config;
+    pass_config.set_pass_attribute("CPUMemoryAssignment::ReuseMemory", true);
+    auto handle = backend->compile(reuse_f, pass_config);
+    vector<shared_ptr<runtime::Tensor>> inputs;
+    for (size_t i = 0; i < args.size(); i++)
+    {
+        auto& param = reuse_f->get_parameters().at(i);
+        inputs.push_back(backend->create_tensor(param->get_element_type(), param->get_shape()));
+        copy_data(inputs.back(), args[i]);
+    }
+    auto result = backend->create_tensor(element::f32, reuse_f->get_output_shape(0));
+    handle->call_with_validate({result}, inputs);
+    EXPECT_TRUE(test::all_close(read_vector<float>(result), int_results.at(0), 1.0e-5f, 1.0e-5f));
+}
+
+// A Convolution in the body may pick an MKLDNN blocked layout, its results must still be
+// written in the native layout
+TEST(cpu_test, tensor_iterator_convolution)
+{
+    const size_t L = 3;  // Sequence length
+    const size_t C = 8;  // Input channels
+    const size_t K = 16; // Output channels
+    auto X = make_shared<op::Parameter>(element::f32, Shape{L, C, 5, 5});
+    auto W = make_shared<op::Parameter>(element::f32, Shape{K, C, 3, 3});
+    auto S_init = make_shared<op::Parameter>(element::f32, Shape{1, K, 3, 3});
+
+    auto X_i = make_shared<op::Parameter>(element::f32, Shape{1, C, 5, 5});
+    auto W_body = make_shared<op::Parameter>(element::f32, Shape{K, C, 3, 3});
+    auto S_i = make_shared<op::Parameter>(element::f32, Shape{1, K, 3, 3});
+    auto conv = make_shared<op::Convolution>(X_i, W_body);
+    auto S_o = make_shared<op::Add>(S_i, conv);
+    auto body = make_shared<op::TensorIterator::BodyLambda>(
+        OutputVector{conv, S_o}, ParameterVector{X_i, W_body, S_i});
+    auto tensor_iterator = make_shared<op::TensorIterator>();
+    tensor_iterator->set_body(body);
+    tensor_iterator->set_sliced_input(X_i, X, 0, 1, 1, -1, 0);
+    tensor_iterator->set_invariant_input(W_body, W);
+    tensor_iterator->set_merged_input(S_i, S_init, S_o);
+    auto convs = tensor_iterator->get_concatenated_slices(conv, 0, 1, 1, -1, 0);
+    auto sum = tensor_iterator->get_iter_value(S_o, -1);
+    auto ti_f = make_shared<Function>(OutputVector{convs, sum}, ParameterVector{X, W, S_init});
+
+    Output<Node> s = S_init;
+    NodeVector unrolled_convs;
+    for (size_t i = 0; i < L; i++)
+    {
+        auto x = make_shared<op::Slice>(X, Coordinate{i, 0, 0, 0}, Coordinate{i + 1, C, 5, 5});
+        auto unrolled_conv = make_shared<op::Convolution>(x, W);
+        s = make_shared<op::Add>(s, unrolled_conv);
+        unrolled_convs.push_back(unrolled_conv);
+    }
+    auto unrolled_f =
+        make_shared<Function>(OutputVector{make_shared<op::Concat>(unrolled_convs, 0), s},
+                              ParameterVector{X, W, S_init});
+
+    test::Uniform<float> rng(-1.0f, 1.0f);
+    vector<vector<float>> args;
+    for (shared_ptr<op::Parameter> param : unrolled_f->get_parameters())
+    {
+        vector<float> tensor_val(shape_size(param->get_shape()));
+        rng.initialize(tensor_val);
+        args.push_back(tensor_val);
+    }
+    auto int_results = execute(unrolled_f, args, "INTERPRETER");
+    auto cpu_results = execute(ti_f, args, "CPU");
+    for (size_t i = 0; i < cpu_results.size(); i++)
+    {
+        EXPECT_TRUE(test::all_close(cpu_results.at(i), int_results.at(i), 1.0e-4f, 1.0e-4f));
+    }
+}
+
+TEST(cpu_test, is_supported_replaced_ops)
+{
+    // BroadcastLike and StopGradient have no builder, the passes replace them before the
+    // kernels are built
+    Shape shape{2, 3};
+    auto A = make_shared<op::Parameter>(element::f32, Shape{});
+    auto B = make_shared<op::Parameter>(element::f32, shape);
+    auto broadcast_like = make_shared<op::BroadcastLike>(A, B, AxisSet{});
+    auto stop_gradient = make_shared<op::StopGradient>(B);
+    auto f = make_shared<Function>(make_shared<op::Add>(broadcast_like, stop_gradient),
+                                   ParameterVector{A, B});
+
+    auto backend = runtime::Backend::create("CPU");
+    EXPECT_TRUE(backend->is_supported(*broadcast_like));
+    EXPECT_TRUE(backend->is_supported(*stop_gradient));
+
+    auto a = backend->create_tensor(element::f32, Shape{});
+    auto b = backend->create_tensor(element::f32, shape);
+    auto result = backend->create_tensor(element::f32, shape);
+    copy_data(a, vector<float>{1});
+    copy_data(b, vector<float>{10, 20, 30, 40, 50, 60});
+    backend->compile(f)->call_with_validate({result}, {a, b});
+    EXPECT_TRUE(
+        test::all_close_f((vector<float>{11, 21, 31, 41, 51, 61}), read_vector<float>(result)));
+}
@@ -0,0 +1,218 @@
+//*****************************************************************************
+// Copyright 2017-2019 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#include <thread>
+
+#include "gtest/gtest.h"
+#include "ngraph/ngraph.hpp"
+#include "ngraph/runtime/dynamic/dynamic_backend.hpp"
+#include "ngraph/runtime/hybrid/hybrid_backend.hpp"
+#include "ngraph/runtime/interpreter/int_backend.hpp"
+#include "util/all_close_f.hpp"
+#include "util/test_tools.hpp"
+
+using namespace std;
+using namespace ngraph;
+
+static shared_ptr<runtime::hybrid::HybridBackend> make_hybrid_backend()
+{
+    // Multiply only runs on the second backend
+    vector<shared_ptr<runtime::Backend>> backends{
+        make_shared<runtime::interpreter::INTBackend>(vector<string>{"Multiply"}),
+        make_shared<runtime::interpreter::INTBackend>()};
+    return make_shared<runtime::hybrid::HybridBackend>(backends);
+}
+
+TEST(hybrid_backend, split_by_placement)
+{
+    Shape shape{2, 2};
+    auto A = make_shared<op::Parameter>(element::f32, shape);
+    auto B = make_shared<op::Parameter>(element::f32, shape);
+    auto C = make_shared<op::Parameter>(element::f32, shape);
+    auto sum = make_shared<op::Add>(A, B);
+    auto product = make_shared<op::Multiply>(sum, C);
+    auto f = make_shared<Function>(NodeVector{make_shared<op::Subtract>(product, A), sum},
+                                   ParameterVector{A, B, C});
+
+    auto backend = make_hybrid_backend();
+    auto handle = backend->compile(f);
+    auto& sub_functions =
+        static_pointer_cast<runtime::hybrid::HybridExecutable>(handle)->get_sub_functions();
+    ASSERT_EQ(sub_functions.size(), 3);
+    EXPECT_EQ(sub_functions[0].placement, 0);
+    EXPECT_EQ(sub_functions[1].placement, 1);
+    EXPECT_EQ(sub_functions[2].placement, 0);
+    // The sum is both a result of the function and handed to the Multiply
+    EXPECT_EQ(sub_functions[0].result_slots.size(), 2);
+    EXPECT_EQ(sub_functions[1].function->get_parameters().size(), 2);
+
+    auto a = backend->create_tensor(element::f32, shape);
+    auto b = backend->create_tensor(element::f32, shape);
+    auto c = backend->create_tensor(element::f32, shape);
+    auto result = backend->create_tensor(element::f32, shape);
+    auto result_sum = backend->create_tensor(element::f32, shape);
+    copy_data(a, vector<float>{1, 2, 3, 4});
+    copy_data(b, vector<float>{5, 6, 7, 8});
+    copy_data(c, vector<float>{9, 10, 11, 12});
+
+    handle->call_with_validate({result, result_sum}, {a, b, c});
+    EXPECT_TRUE(test::all_close_f((vector<float>{53, 78, 107, 140}), read_vector<float>(result)));
+    EXPECT_TRUE(test::all_close_f((vector<float>{6, 8, 10, 12}), read_vector<float>(result_sum)));
+
+    // A second call with other tensors binds them in place of the first ones
+    auto other_a = backend->create_tensor(element::f32, shape);
+    copy_data(other_a, vector<float>{0, 0, 0, 0});
+    handle->call_with_validate({result, result_sum}, {other_a, b, c});
+    EXPECT_TRUE(test::all_close_f((vector<float>{45, 60, 77, 96}), read_vector<float>(result)));
+    EXPECT_TRUE(test::all_close_f((vector<float>{5, 6, 7, 8}), read_vector<float>(result_sum)));
+}
+
+TEST(hybrid_backend, merge_same_level)
+{
+    // Both branches are placed on the first backend before any placement change, so they share
+    // a part
+    Shape shape{4};
+    auto A = make_shared<op::Parameter>(element::f32, shape);
+    auto B = make_shared<op::Parameter>(element::f32, shape);
+    auto left = make_shared<op::Add>(A, B);
+    auto right = make_shared<op::Subtract>(A, B);
+    auto f = make_shared<Function>(make_shared<op::Multiply>(left, right), ParameterVector{A, B});
+
+    auto backend = make_hybrid_backend();
+    auto handle = backend->compile(f);
+    auto& sub_functions =
+        static_pointer_cast<runtime::hybrid::HybridExecutable>(handle)->get_sub_functions();
+    ASSERT_EQ(sub_functions.size(), 2);
+    EXPECT_EQ(sub_functions[0].function->get_results().size(), 2);
+
+    auto a = backend->create_tensor(element::f32, shape);
+    auto b = backend->create_tensor(element::f32, shape);
+    auto result = backend->create_tensor(element::f32, shape);
+    copy_data(a, vector<float>{1, 2, 3, 4});
+    copy_data(b, vector<float>{4, 3, 2, 1});
+    handle->call_with_validate({result}, {a, b});
+    EXPECT_TRUE(test::all_close_f((vector<float>{-15, -5, 5, 15}), read_vector<float>(result)));
+}
+
+TEST(hybrid_backend, staged_tensors)
+{
+    // Tensors of another backend are staged through host memory
+    Shape shape{2, 2};
+    auto A = make_shared<op::Parameter>(element::f32, shape);
+    auto B = make_shared<op::Parameter>(element::f32, shape);
+    auto f = make_shared<Function>(make_shared<op::Multiply>(make_shared<op::Add>(A, B), B),
+                                   ParameterVector{A, B});
+
+    auto backend = make_hybrid_backend();
+    auto handle = backend->compile(f, true);
+    auto tensor_backend = make_shared<runtime::interpreter::INTBackend>();
+    auto a = make_shared<runtime::dynamic::DynamicTensor>(element::f32, shape, tensor_backend);
+    auto b = backend->create_tensor(element::f32, shape);
+    auto result =
+        make_shared<runtime::dynamic::DynamicTensor>(element::f32, shape, tensor_backend);
+    a->make_storage(element::f32, shape);
+    result->make_storage(element::f32, shape);
+    copy_data(a, vector<float>{1, 2, 3, 4});
+    copy_data(b, vector<float>{5, 6, 7, 8});
+    handle->call_with_validate({result}, {a, b});
+    EXPECT_TRUE(test::all_close_f((vector<float>{30, 48, 70, 96}), read_vector<float>(result)));
+
+    // Staging the function's parameters and results, and the hand-off to the parts, are
+    // reported along with the ops
+    set<shared_ptr<const Node>> nodes;
+    for (auto& counter : handle->get_performance_data())
+    {
+        nodes.insert(counter.get_node());
+    }
+    EXPECT_EQ(nodes.count(handle->get_parameters()[0]), 1);
+    EXPECT_EQ(nodes.count(handle->get_parameters()[1]), 0);
+    EXPECT_EQ(nodes.count(handle->get_results()[0]), 1);
+    auto& sub_functions =
+        static_pointer_cast<runtime::hybrid::HybridExecutable>(handle)->get_sub_functions();
+    ASSERT_EQ(sub_functions.size(), 2);
+    EXPECT_EQ(nodes.count(sub_functions[1].function->get_parameters()[0]), 1);
+    EXPECT_EQ(nodes.count(sub_functions[1].function->get_parameters()[1]), 1);
+}
+
+TEST(hybrid_backend, call_from_threads)
+{
+    // The boundary slots are shared by the calls of the executable
+    Shape shape{32, 32};
+    auto A = make_shared<op::Parameter>(element::f32, shape);
+    auto B = make_shared<op::Parameter>(element::f32, shape);
+    auto f = make_shared<Function>(
+        make_shared<op::Subtract>(make_shared<op::Multiply>(make_shared<op::Add>(A, B), B), A),
+        ParameterVector{A, B});
+
+    auto backend = make_hybrid_backend();
+    auto handle = backend->compile(f);
+    auto run = [&](float value, vector<string>& errors) {
+        auto a = backend->create_tensor(element::f32, shape);
+        auto b = backend->create_tensor(element::f32, shape);
+        auto result = backend->create_tensor(element::f32, shape);
+        copy_data(a, vector<float>(shape_size(shape), value));
+        copy_data(b, vector<float>(shape_size(shape), 2));
+        vector<float> expected(shape_size(shape), (value + 2) * 2 - value);
+        for (size_t i = 0; i < 100; i++)
+        {
+            handle->call_with_validate({result}, {a, b});
+            if (!test::all_close_f(expected, read_vector<float>(result)))
+            {
+                errors.push_back("wrong result for " + to_string(value));
+                break;
+            }
+        }
+    };
+    vector<string> errors1;
+    vector<string> errors2;
+    thread thread1(run, 3.0f, ref(errors1));
+    thread thread2(run, 5.0f, ref(errors2));
+    thread1.join();
+    thread2.join();
+    EXPECT_TRUE(errors1.empty());
+    EXPECT_TRUE(errors2.empty());
+}
+
+TEST(hybrid_backend, create_by_name)
+{
+    Shape shape{2};
+    auto A = make_shared<op::Parameter>(element::f32, shape);
+    auto B = make_shared<op::Parameter>(element::f32, shape);
+    auto f = make_shared<Function>(make_shared<op::Add>(A, B), ParameterVector{A, B});
+
+    auto backend = runtime::Backend::create("HYBRID:INTERPRETER");
+    auto a = backend->create_tensor(element::f32, shape);
+    auto b = backend->create_tensor(element::f32, shape);
+    auto result = backend->create_tensor(element::f32, shape);
+    copy_data(a, vector<float>{1, 2});
+    copy_data(b, vector<float>{3, 4});
+    backend->compile(f)->call_with_validate({result}, {a, b});
+    EXPECT_TRUE(test::all_close_f((vector<float>{4, 6}), read_vector<float>(result)));
+}
+
+TEST(hybrid_backend, unsupported_op)
+{
+    Shape shape{2};
+    auto A = make_shared<op::Parameter>(element::f32, shape);
+    auto B = make_shared<op::Parameter>(element::f32, shape);
+    auto f = make_shared<Function>(make_shared<op::Multiply>(A, B), ParameterVector{A, B});
+
+    auto backend = make_shared<runtime::hybrid::HybridBackend>(
+        vector<shared_ptr<runtime::Backend>>{
+            make_shared<runtime::interpreter::INTBackend>(vector<string>{"Multiply"})});
+    EXPECT_FALSE(backend->is_supported(*f->get_results()[0]->get_argument(0)));
+    EXPECT_THROW(backend->compile(f), ngraph_error);
+}
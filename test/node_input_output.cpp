@@ -22,6 +22,7 @@
 #include "gtest/gtest.h"
 
 #include "ngraph/ngraph.hpp"
+#include "ngraph/variant.hpp"
 
 using namespace ngraph;
 using namespace std;
@@ -111,3 +112,81 @@ TEST(node_input_output, output_create_const)
 
     EXPECT_THROW(add->output(1), std::out_of_range);
 }
+
+namespace
+{
+    class GrowingOutputsOp : public op::Op
+    {
+    public:
+        static constexpr NodeTypeInfo type_info{"GrowingOutputsOp", 0};
+        const NodeTypeInfo& get_type_info() const override { return type_info; }
+        GrowingOutputsOp(const Output<Node>& arg)
+            : Op({arg})
+        {
+            constructor_validate_and_infer_types();
+        }
+
+        void validate_and_infer_types() override
+        {
+            for (size_t i = 0; i < get_output_size(); i++)
+            {
+                set_output_type(i, get_input_element_type(0), get_input_partial_shape(0));
+            }
+        }
+
+        void grow(size_t output_size)
+        {
+            set_output_size(output_size);
+            validate_and_infer_types();
+        }
+
+        shared_ptr<Node> copy_with_new_args(const NodeVector& new_args) const override
+        {
+            return make_shared<GrowingOutputsOp>(new_args.at(0));
+        }
+    };
+    constexpr NodeTypeInfo GrowingOutputsOp::type_info;
+}
+
+TEST(node_input_output, outputs_grow_after_use)
+{
+    auto x = make_shared<op::Parameter>(element::f32, Shape{2, 3});
+    auto grower = make_shared<GrowingOutputsOp>(x);
+    auto abs0 = make_shared<op::Abs>(grower->output(0));
+    auto neg0 = make_shared<op::Negative>(grower->output(0));
+
+    // Adding outputs relocates the existing output descriptors
+    grower->grow(16);
+    auto abs5 = make_shared<op::Abs>(grower->output(5));
+
+    EXPECT_EQ(abs0->input(0).get_source_output(), grower->output(0));
+    EXPECT_EQ(neg0->input(0).get_source_output(), grower->output(0));
+    EXPECT_EQ(abs5->input(0).get_source_output(), grower->output(5));
+    EXPECT_EQ(grower->output(0).get_target_inputs(),
+              (set<Input<Node>>{abs0->input(0), neg0->input(0)}));
+    EXPECT_EQ(grower->output(5).get_target_inputs(), set<Input<Node>>{abs5->input(0)});
+
+    auto y = make_shared<op::Parameter>(element::f32, Shape{2, 3});
+    for (auto& input : grower->output(0).get_target_inputs())
+    {
+        input.replace_source_output(y);
+    }
+    EXPECT_EQ(abs0->input(0).get_source_output(), y->output(0));
+    EXPECT_EQ(neg0->input(0).get_source_output(), y->output(0));
+    EXPECT_TRUE(grower->output(0).get_target_inputs().empty());
+}
+
+TEST(node_input_output, extras_allocated_on_use)
+{
+    auto x = make_shared<op::Parameter>(element::f32, Shape{2, 3});
+    const Node& const_x = *x;
+    EXPECT_TRUE(const_x.get_rt_info().empty());
+    EXPECT_TRUE(x->get_provenance_tags().empty());
+    EXPECT_TRUE(x->get_provenance_group_members().empty());
+    x->remove_provenance_tag("missing");
+
+    x->add_provenance_tag("tag");
+    x->get_rt_info()["key"] = make_shared<VariantWrapper<string>>("value");
+    EXPECT_EQ(x->get_provenance_tags(), (unordered_set<string>{"tag"}));
+    EXPECT_EQ(const_x.get_rt_info().size(), 1);
+}
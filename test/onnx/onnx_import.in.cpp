@@ -17,6 +17,7 @@
 #include <algorithm>
 #include <cmath>
 #include <cstdint>
+#include <cstdlib>
 #include <fstream>
 #include <iterator>
 #include <limits>
@@ -80,6 +81,73 @@ NGRAPH_TEST(onnx_${BACKEND_NAME}, output_names_check)
     }
 }
 
+// Names and friendly names of the ops of a function, with the instance ids in the names made
+// relative to the lowest id in the function so that two imports of one model can be compared
+static std::vector<std::string> get_relative_op_names(const std::shared_ptr<Function>& function)
+{
+    auto ops = function->get_ordered_ops();
+    std::size_t first_id = std::numeric_limits<std::size_t>::max();
+    for (const auto& op : ops)
+    {
+        first_id = std::min(first_id, op->get_instance_id());
+    }
+    std::vector<std::string> names;
+    for (const auto& op : ops)
+    {
+        std::string relative_name =
+            op->description() + "_" + std::to_string(op->get_instance_id() - first_id);
+        EXPECT_EQ(op->get_name(), op->description() + "_" + std::to_string(op->get_instance_id()));
+        names.push_back(relative_name);
+        names.push_back(op->get_friendly_name() == op->get_name() ? relative_name
+                                                                   : op->get_friendly_name());
+    }
+    return names;
+}
+
+NGRAPH_TEST(onnx_${BACKEND_NAME}, import_thread_count)
+{
+    // The thread count is process wide, restore the default even if the test fails
+    struct ImportThreadCountScope
+    {
+        ~ImportThreadCountScope() { onnx_import::set_import_thread_count(0); }
+    } scope;
+
+    auto model = file_util::path_join(SERIALIZED_ZOO, "onnx/parallel_branches.prototxt");
+    Inputs inputs{{1, 2}, {3, 4}, {-1, 5}, {2, -3}};
+    Outputs expected_outputs{{22, 40}, {11, 20}};
+
+    // Parallel import is opt-in
+    if (!std::getenv("NGRAPH_ONNX_IMPORT_THREADS"))
+    {
+        EXPECT_EQ(onnx_import::get_import_thread_count(), 1);
+    }
+
+    onnx_import::set_import_thread_count(1);
+    EXPECT_EQ(onnx_import::get_import_thread_count(), 1);
+    auto sequential = onnx_import::import_onnx_model(model);
+
+    onnx_import::set_import_thread_count(4);
+    EXPECT_EQ(onnx_import::get_import_thread_count(), 4);
+    auto parallel = onnx_import::import_onnx_model(model);
+
+    EXPECT_EQ(get_relative_op_names(sequential), get_relative_op_names(parallel));
+    for (const auto& function : {sequential, parallel})
+    {
+        EXPECT_EQ(function->get_output_op(0)->get_friendly_name(), "Z");
+        EXPECT_EQ(function->get_output_op(1)->get_friendly_name(), "Y1");
+        for (const auto& node : function->get_ops())
+        {
+            EXPECT_FALSE(node->is_validation_deferred());
+        }
+        Outputs outputs{execute(function, inputs, "${BACKEND_NAME}")};
+        ASSERT_EQ(outputs.size(), expected_outputs.size());
+        for (std::size_t i = 0; i < outputs.size(); ++i)
+        {
+            EXPECT_TRUE(test::all_close_f(expected_outputs[i], outputs[i]));
+        }
+    }
+}
+
 NGRAPH_TEST(onnx_${BACKEND_NAME}, model_add_abc)
 {
     auto function = onnx_import::import_onnx_model(
@@ -116,6 +184,39 @@ NGRAPH_TEST(onnx_${BACKEND_NAME}, model_add_abc_initializers)
     EXPECT_TRUE(test::all_close_f(expected_outputs.front(), outputs.front()));
 }
 
+NGRAPH_TEST(onnx_${BACKEND_NAME}, model_external_data)
+{
+    // A is mapped from offset 0 of data/tensor.data, B is read from the unaligned offset 16
+    auto function = onnx_import::import_onnx_model(
+        file_util::path_join(SERIALIZED_ZOO, "onnx/external_data.prototxt"));
+
+    Inputs inputs{{1, 2, 3, 4}};
+    Outputs expected_outputs{{7, 10, 13, 16}};
+
+    Outputs outputs{execute(function, inputs, "${BACKEND_NAME}")};
+    EXPECT_TRUE(test::all_close_f(expected_outputs.front(), outputs.front()));
+}
+
+NGRAPH_TEST(onnx_${BACKEND_NAME}, model_external_data_outside_model_directory)
+{
+    std::ifstream file{file_util::path_join(SERIALIZED_ZOO, "onnx/external_data.prototxt")};
+    std::stringstream model;
+    model << file.rdbuf();
+    const std::string location = "\"data/tensor.data\"";
+    for (const std::string& bad_location :
+         {"\"/tmp/tensor.data\"", "\"../tensor.data\"", "\"data/../../tensor.data\""})
+    {
+        std::string text = model.str();
+        for (auto pos = text.find(location); pos != std::string::npos;
+             pos = text.find(location, pos + bad_location.size()))
+        {
+            text.replace(pos, location.size(), bad_location);
+        }
+        std::istringstream stream{text};
+        EXPECT_THROW(onnx_import::import_onnx_model(stream), ngraph_error) << bad_location;
+    }
+}
+
 NGRAPH_TEST(onnx_${BACKEND_NAME}, model_override_op)
 {
     onnx_import::register_operator(
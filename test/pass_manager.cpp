@@ -67,3 +67,112 @@ TEST(pass_manager, serialize_with_revalidate_does_not_crash)
     auto graph = make_test_graph();
     pass_manager.run_passes(graph);
 }
+
+TEST(pass_manager, pass_profile)
+{
+    pass::Manager pass_manager;
+    pass_manager.set_per_pass_validation(false);
+    pass_manager.set_pass_profiling(true);
+    pass_manager.register_pass<DummyPass>();
+    pass_manager.register_pass<pass::Validate>();
+
+    auto graph = make_test_graph();
+    size_t node_count = graph->get_ops().size();
+    pass_manager.run_passes(graph);
+
+    const vector<pass::PassProfile>& profiles = pass_manager.get_pass_profiles();
+    ASSERT_EQ(profiles.size(), 2);
+    EXPECT_NE(profiles[0].name.find("DummyPass"), string::npos);
+    for (const pass::PassProfile& profile : profiles)
+    {
+        EXPECT_EQ(profile.nodes_before, node_count);
+        EXPECT_EQ(profile.nodes_after, node_count);
+        EXPECT_EQ(profile.nodes_visited, node_count);
+        EXPECT_EQ(profile.nodes_allocated, 0);
+    }
+}
+
+namespace
+{
+    class ThrowingPass : public pass::FunctionPass
+    {
+    public:
+        ThrowingPass()
+            : FunctionPass()
+        {
+        }
+        bool run_on_function(std::shared_ptr<ngraph::Function> /* f */) override
+        {
+            throw ngraph_error("ThrowingPass");
+        }
+    };
+}
+
+TEST(pass_manager, pass_profile_cleared_on_throw)
+{
+    pass::Manager pass_manager;
+    pass_manager.set_pass_profiling(true);
+    pass_manager.register_pass<ThrowingPass>();
+
+    EXPECT_THROW(pass_manager.run_passes(make_test_graph()), ngraph_error);
+    EXPECT_EQ(pass_manager.get_state().get_pass_profile(), nullptr);
+}
+
+TEST(pass_manager, compile_profiler_collects_all_managers)
+{
+    pass::CompileProfiler profiler;
+    {
+        pass::Manager pass_manager;
+        pass_manager.register_pass<DummyPass>();
+        pass_manager.run_passes(make_test_graph());
+    }
+    {
+        pass::Manager pass_manager;
+        pass_manager.register_pass<DummyPass>();
+        pass_manager.run_passes(make_test_graph());
+    }
+    // Per-pass validation adds a Validate pass after every registered pass
+    EXPECT_EQ(profiler.get_pass_profiles().size(), 4);
+    EXPECT_EQ(pass::CompileProfiler::get_active(), &profiler);
+}
+
+namespace
+{
+    // Runs a pass manager of its own, like a backend compiling a nested function
+    class NestingPass : public pass::FunctionPass
+    {
+    public:
+        NestingPass()
+            : FunctionPass()
+        {
+        }
+        bool run_on_function(std::shared_ptr<ngraph::Function> f) override
+        {
+            pass::Manager pass_manager;
+            pass_manager.set_per_pass_validation(false);
+            pass_manager.register_pass<DummyPass>();
+            pass_manager.run_passes(f);
+            return false;
+        }
+    };
+}
+
+TEST(pass_manager, compile_profiler_collects_nested_managers)
+{
+    pass::CompileProfiler profiler;
+    pass::Manager pass_manager;
+    pass_manager.set_per_pass_validation(false);
+    pass_manager.register_pass<NestingPass>();
+    pass_manager.run_passes(make_test_graph());
+
+    // The inner pass finishes, and is recorded, before the pass that ran it
+    const vector<pass::PassProfile>& profiles = profiler.get_pass_profiles();
+    ASSERT_EQ(profiles.size(), 2);
+    EXPECT_NE(profiles[0].name.find("DummyPass"), string::npos);
+    EXPECT_NE(profiles[1].name.find("NestingPass"), string::npos);
+    EXPECT_GE(profiles[1].microseconds, profiles[0].microseconds);
+
+    // The outer manager keeps only its own passes
+    ASSERT_EQ(pass_manager.get_pass_profiles().size(), 1);
+    EXPECT_NE(pass_manager.get_pass_profiles()[0].name.find("NestingPass"), string::npos);
+}
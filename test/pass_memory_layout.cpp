@@ -23,6 +23,7 @@
 
 #include "ngraph/ngraph.hpp"
 #include "ngraph/pass/dump_sorted.hpp"
+#include "ngraph/pass/in_place_elementwise.hpp"
 #include "ngraph/pass/liveness.hpp"
 #include "ngraph/pass/liveness.hpp"
 #include "ngraph/pass/manager.hpp"
@@ -232,3 +233,159 @@ TEST(memory_layout, constant)
     size_t temporary_pool_size = f->get_temporary_pool_size();
     EXPECT_EQ(4, temporary_pool_size);
 }
+
+TEST(memory_layout, in_place_elementwise)
+{
+    Shape shape{16};
+    auto P = make_shared<op::Parameter>(element::f32, shape);
+    auto neg = make_shared<op::Negative>(P);
+    auto abs = make_shared<op::Abs>(neg);
+    auto add = make_shared<op::Add>(abs, neg);
+    auto convert = make_shared<op::Convert>(add, element::i32);
+    auto f = make_shared<Function>(convert, ParameterVector{P});
+
+    pass::Manager pass_manager;
+    pass_manager.register_pass<pass::InPlaceElementwise>();
+    pass_manager.register_pass<pass::Liveness>();
+    pass_manager.register_pass<pass::MemoryLayout>();
+    pass_manager.run_passes(f);
+
+    auto get_pairs = [](const shared_ptr<op::Op>& op) {
+        auto op_annotations = op->get_op_annotations();
+        return op_annotations ? op_annotations->get_in_place_oi_pairs().size() : 0;
+    };
+    // Parameters are never overwritten and neg is still needed after abs
+    EXPECT_EQ(get_pairs(neg), 0);
+    EXPECT_EQ(get_pairs(abs), 0);
+    ASSERT_EQ(get_pairs(add), 1);
+    EXPECT_EQ(add->get_op_annotations()->get_in_place_oi_pairs()[0].input, 0);
+    EXPECT_EQ(get_pairs(convert), 1);
+
+    EXPECT_EQ(add->get_output_tensor().get_pool_offset(),
+              abs->get_output_tensor().get_pool_offset());
+    EXPECT_EQ(f->get_temporary_pool_size(), 2 * shape_size(shape) * sizeof(float));
+}
+
+TEST(memory_layout, aliased_in_place_outputs)
+{
+    // Both GetOutputElements reuse the buffer of the TopK values, and each frees it when the
+    // Add is done with it
+    Shape shape{2, 8};
+    auto P = make_shared<op::Parameter>(element::f32, shape);
+    auto topk = make_shared<op::TopK>(P, 1, element::i32, 4);
+    auto goe1 = make_shared<op::GetOutputElement>(topk, 1);
+    auto goe2 = make_shared<op::GetOutputElement>(topk, 1);
+    for (auto goe : {goe1, goe2})
+    {
+        auto op_annotations = make_shared<op::util::OpAnnotations>();
+        op_annotations->add_in_place_oi_pair({0, 0, false});
+        goe->set_op_annotations(op_annotations);
+    }
+    auto add = make_shared<op::Add>(goe1, goe2);
+    auto f = make_shared<Function>(add, ParameterVector{P});
+
+    pass::Manager pass_manager;
+    pass_manager.register_pass<pass::Liveness>();
+    pass_manager.register_pass<pass::MemoryLayout>();
+    pass_manager.run_passes(f);
+
+    size_t values_offset = topk->output(1).get_tensor().get_pool_offset();
+    EXPECT_EQ(goe1->get_output_tensor().get_pool_offset(), values_offset);
+    EXPECT_EQ(goe2->get_output_tensor().get_pool_offset(), values_offset);
+    EXPECT_NE(add->get_output_tensor().get_pool_offset(), values_offset);
+}
+
+TEST(memory_planner, free_aliased_buffer)
+{
+    // Two tensors alias a; it lives until the second one is freed, so c cannot take its place
+    for (auto s : {pass::MemoryPlanner::strategy::FIRST_FIT,
+                   pass::MemoryPlanner::strategy::GREEDY_BY_SIZE,
+                   pass::MemoryPlanner::strategy::GREEDY_BY_LIFETIME,
+                   pass::MemoryPlanner::strategy::BEST})
+    {
+        pass::MemoryPlanner planner(1, s);
+        size_t a = planner.allocate(10);
+        planner.free(a);
+        size_t c = planner.allocate(10);
+        planner.free(a);
+        planner.free(c);
+        planner.plan();
+        EXPECT_NE(planner.get_offset(a), planner.get_offset(c));
+        EXPECT_EQ(planner.get_lower_bound(), 20);
+    }
+}
+
+TEST(memory_planner, fragmentation)
+{
+    // b is live throughout; a is freed before c, which does not fit in a's place
+    auto make_plan = [](pass::MemoryPlanner::strategy s) {
+        auto planner = make_shared<pass::MemoryPlanner>(1, s);
+        size_t a = planner->allocate(10);
+        size_t b = planner->allocate(20);
+        planner->free(a);
+        size_t c = planner->allocate(20);
+        planner->free(b);
+        planner->free(c);
+        planner->plan();
+        return planner;
+    };
+
+    auto first_fit = make_plan(pass::MemoryPlanner::strategy::FIRST_FIT);
+    EXPECT_EQ(first_fit->get_lower_bound(), 40);
+    EXPECT_EQ(first_fit->max_allocated(), 50);
+    EXPECT_EQ(first_fit->get_offset(2), 30);
+
+    for (auto s : {pass::MemoryPlanner::strategy::GREEDY_BY_SIZE,
+                   pass::MemoryPlanner::strategy::BEST})
+    {
+        auto planner = make_plan(s);
+        EXPECT_EQ(planner->get_lower_bound(), 40);
+        EXPECT_EQ(planner->max_allocated(), 40);
+        EXPECT_NE(planner->get_offset(1), planner->get_offset(2));
+    }
+}
+
+TEST(memory_planner, no_overlap)
+{
+    // Random lifetimes, buffers live at the same time must not overlap in memory
+    for (auto s : {pass::MemoryPlanner::strategy::FIRST_FIT,
+                   pass::MemoryPlanner::strategy::GREEDY_BY_SIZE,
+                   pass::MemoryPlanner::strategy::GREEDY_BY_LIFETIME,
+                   pass::MemoryPlanner::strategy::BEST})
+    {
+        pass::MemoryPlanner planner(8, s);
+        vector<size_t> live;
+        vector<size_t> sizes;
+        vector<pair<size_t, size_t>> lifetimes;
+        size_t time = 0;
+        srand(1);
+        for (size_t i = 0; i < 200; i++)
+        {
+            sizes.push_back(pass::MemoryManager::align(rand() % 1000, 8));
+            live.push_back(planner.allocate(sizes.back()));
+            lifetimes.push_back({time++, numeric_limits<size_t>::max()});
+            while (!live.empty() && rand() % 3 == 0)
+            {
+                size_t index = rand() % live.size();
+                planner.free(live[index]);
+                lifetimes[live[index]].second = time++;
+                live.erase(live.begin() + index);
+            }
+        }
+        planner.plan();
+        EXPECT_GE(planner.max_allocated(), planner.get_lower_bound());
+        for (size_t i = 0; i < sizes.size(); i++)
+        {
+            EXPECT_LE(planner.get_offset(i) + sizes[i], planner.max_allocated());
+            for (size_t j = i + 1; j < sizes.size(); j++)
+            {
+                if (lifetimes[i].first < lifetimes[j].second &&
+                    lifetimes[j].first < lifetimes[i].second)
+                {
+                    EXPECT_TRUE(planner.get_offset(i) + sizes[i] <= planner.get_offset(j) ||
+                                planner.get_offset(j) + sizes[j] <= planner.get_offset(i));
+                }
+            }
+        }
+    }
+}
@@ -156,6 +156,27 @@ TEST(serialize, existing_models)
     }
 }
 
+TEST(serialize, stream_any_key_order)
+{
+    Shape shape{2, 2};
+    auto A = make_shared<op::Parameter>(element::f32, shape);
+    auto B = make_shared<op::Parameter>(element::f32, shape);
+    auto f = make_shared<Function>(make_shared<op::Add>(A, B) * A, ParameterVector{A, B}, "f");
+    json js = json::parse(serialize(f));
+
+    // The ops of a function are built while they are read, before its results and parameters
+    stringstream model;
+    model << "[{\"result\":" << js[0]["result"].dump()
+          << ",\"parameters\":" << js[0]["parameters"].dump() << ",\"ops\":" << js[0]["ops"].dump()
+          << ",\"name\":\"f\"}]";
+    shared_ptr<Function> g = deserialize(model);
+    ASSERT_NE(g, nullptr);
+    EXPECT_EQ(g->get_friendly_name(), "f");
+    EXPECT_EQ(g->get_parameters().size(), 2);
+    EXPECT_EQ(g->get_ops().size(), f->get_ops().size());
+    EXPECT_EQ(g->get_results().at(0)->get_argument(0)->description(), "Multiply");
+}
+
 TEST(serialize, default_value)
 {
     json j = {{"test1", 1}, {"test2", 2}};
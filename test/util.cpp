@@ -395,6 +395,86 @@ TEST(graph_util, test_subgraph_topological_sort_control_dependencies)
     ASSERT_EQ(expected, sorted);
 }
 
+TEST(graph_util, deferred_validation)
+{
+    Shape shape{2, 2};
+    auto A = make_shared<op::Parameter>(element::f32, shape);
+    shared_ptr<Node> add;
+    shared_ptr<Node> neg;
+    shared_ptr<Function> f;
+    {
+        DeferredValidation deferred;
+        EXPECT_TRUE(DeferredValidation::is_active());
+        add = make_shared<op::Add>(A, A);
+        neg = make_shared<op::Negative>(add);
+        EXPECT_TRUE(add->is_validation_deferred());
+        EXPECT_TRUE(neg->is_validation_deferred());
+        {
+            DeferredValidation validate(false);
+            EXPECT_FALSE(DeferredValidation::is_active());
+        }
+        EXPECT_TRUE(DeferredValidation::is_active());
+        f = make_shared<Function>(neg, ParameterVector{A});
+    }
+    EXPECT_FALSE(DeferredValidation::is_active());
+    EXPECT_FALSE(A->is_validation_deferred());
+    EXPECT_FALSE(add->is_validation_deferred());
+    EXPECT_FALSE(neg->is_validation_deferred());
+    EXPECT_EQ(neg->get_output_element_type(0), element::f32);
+    EXPECT_EQ(neg->get_output_shape(0), shape);
+
+    auto g = clone_function(*f);
+    EXPECT_EQ(g->get_output_shape(0), shape);
+    for (auto node : g->get_ops())
+    {
+        EXPECT_FALSE(node->is_validation_deferred());
+    }
+}
+
+TEST(graph_util, deferred_validation_on_demand)
+{
+    auto A = make_shared<op::Parameter>(element::f32, Shape{10});
+    DeferredValidation deferred;
+    auto abs = make_shared<op::Abs>(A);
+    auto topk = make_shared<op::TopK>(abs, 0, element::i32, 5, true);
+    EXPECT_TRUE(abs->is_validation_deferred());
+    EXPECT_TRUE(topk->is_validation_deferred());
+
+    // TopK only creates its second output when it is validated
+    auto convert = make_shared<op::Convert>(Output<Node>(topk, 1), element::f32);
+    EXPECT_FALSE(abs->is_validation_deferred());
+    EXPECT_FALSE(topk->is_validation_deferred());
+    EXPECT_TRUE(convert->is_validation_deferred());
+    EXPECT_EQ(convert->get_output_shape(0), (Shape{5}));
+    EXPECT_FALSE(convert->is_validation_deferred());
+}
+
+TEST(graph_util, deferred_validation_errors)
+{
+    auto A = make_shared<op::Parameter>(element::f32, Shape{2, 2});
+    auto B = make_shared<op::Parameter>(element::f32, Shape{3});
+    shared_ptr<Node> add;
+    {
+        DeferredValidation deferred;
+        EXPECT_NO_THROW(add = make_shared<op::Add>(A, B));
+    }
+    EXPECT_THROW(add->validate_if_deferred(), NodeValidationFailure);
+}
+
+TEST(graph_util, deferred_validation_without_constructor_validation)
+{
+    // Mod leaves validation to its Function
+    auto A = make_shared<op::Parameter>(element::i64, Shape{6});
+    auto B = make_shared<op::Parameter>(element::i64, Shape{6});
+    DeferredValidation deferred;
+    auto mod = make_shared<op::v1::Mod>(A, B);
+    EXPECT_TRUE(mod->is_validation_deferred());
+    auto f = make_shared<Function>(mod, ParameterVector{A, B});
+    EXPECT_FALSE(mod->is_validation_deferred());
+    EXPECT_EQ(f->get_output_element_type(0), element::i64);
+    EXPECT_EQ(f->get_output_shape(0), (Shape{6}));
+}
+
 TEST(util, enum_mask_construction)
 {
     enum class Type : uint32_t